@@ -484,6 +484,16 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             //! \ogs_file_param{prj__processes__process__jacobian_assembler}
             process_config.getConfigSubtreeOptional("jacobian_assembler"));
 
+        auto const number_of_assembly_threads =
+            //! \ogs_file_param{prj__processes__process__number_of_assembly_threads}
+            process_config.getConfigParameterOptional<int>(
+                "number_of_assembly_threads");
+
+        auto const cache_global_matrix_offsets =
+            //! \ogs_file_param{prj__processes__process__cache_global_matrix_offsets}
+            process_config.getConfigParameter<bool>(
+                "cache_global_matrix_offsets", false);
+
 #ifdef OGS_BUILD_PROCESS_GROUNDWATERFLOW
         if (type == "GROUNDWATER_FLOW")
         {
@@ -858,6 +868,12 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             OGS_FATAL("Unknown process type: %s", type.c_str());
         }
 
+        if (number_of_assembly_threads)
+        {
+            process->setNumberOfAssemblyThreads(*number_of_assembly_threads);
+        }
+        process->setCacheGlobalMatrixOffsets(cache_global_matrix_offsets);
+
         BaseLib::insertIfKeyUniqueElseError(_processes,
                                             name,
                                             std::move(process),
@@ -9,10 +9,17 @@
  *
  */
 
+#include "Metis.h"
+
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 
+#include <metis.h>
+
 #include "BaseLib/Error.h"
 #include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
 
 namespace ApplicationUtils
 {
@@ -96,4 +103,112 @@ void removeMetisPartitioningFiles(std::string const& file_name_base,
     std::remove((file_name_base + ".mesh.npart." + npartitions_str).c_str());
     std::remove((file_name_base + ".mesh.epart." + npartitions_str).c_str());
 }
+
+std::vector<long> computeElementWeights(
+    MeshLib::Mesh const& mesh, bool const weight_by_cell_type,
+    std::map<int, long> const& material_weights)
+{
+    auto const& elements = mesh.getElements();
+    std::vector<long> weights(elements.size(), 1);
+
+    if (weight_by_cell_type)
+    {
+        std::transform(begin(elements), end(elements), begin(weights),
+                       [](MeshLib::Element const* const e) {
+                           long const n = e->getNumberOfNodes();
+                           return n * n;
+                       });
+    }
+
+    if (material_weights.empty())
+    {
+        return weights;
+    }
+
+    auto const* const material_ids = MeshLib::materialIDs(mesh);
+    if (!material_ids)
+    {
+        OGS_FATAL(
+            "Material weights are given, but the mesh has no MaterialIDs.");
+    }
+    for (std::size_t i = 0; i < elements.size(); ++i)
+    {
+        auto const it = material_weights.find((*material_ids)[i]);
+        if (it != material_weights.end())
+        {
+            weights[i] *= it->second;
+        }
+    }
+    return weights;
+}
+
+std::vector<std::size_t> partitionMeshWithMetis(
+    MeshLib::Mesh const& mesh, long const number_of_partitions,
+    std::vector<long> const& element_weights)
+{
+    auto const& elements = mesh.getElements();
+
+    // Element-node connectivity in compressed row storage.
+    std::vector<idx_t> eptr;
+    eptr.reserve(elements.size() + 1);
+    eptr.push_back(0);
+    std::vector<idx_t> eind;
+    for (auto const* e : elements)
+    {
+        for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+        {
+            eind.push_back(static_cast<idx_t>(e->getNodeIndex(i)));
+        }
+        eptr.push_back(static_cast<idx_t>(eind.size()));
+    }
+
+    idx_t number_of_elements = static_cast<idx_t>(elements.size());
+    idx_t number_of_nodes = static_cast<idx_t>(mesh.getNumberOfNodes());
+    idx_t nparts = static_cast<idx_t>(number_of_partitions);
+    idx_t options[METIS_NOPTIONS];
+    METIS_SetDefaultOptions(options);
+    options[METIS_OPTION_NUMBERING] = 0;
+
+    idx_t objval;
+    std::vector<idx_t> element_partition_ids(elements.size());
+    std::vector<idx_t> node_partition_ids(mesh.getNumberOfNodes());
+
+    int status;
+    if (element_weights.empty())
+    {
+        status = METIS_PartMeshNodal(
+            &number_of_elements, &number_of_nodes, eptr.data(), eind.data(),
+            nullptr, nullptr, &nparts, nullptr, options, &objval,
+            element_partition_ids.data(), node_partition_ids.data());
+    }
+    else
+    {
+        if (element_weights.size() != elements.size())
+        {
+            OGS_FATAL(
+                "The number of element weights %d differs from the number of "
+                "elements %d.",
+                element_weights.size(), elements.size());
+        }
+        std::vector<idx_t> weights(begin(element_weights),
+                                   end(element_weights));
+        // Elements are adjacent in the dual graph if they share a face.
+        idx_t number_of_common_nodes =
+            static_cast<idx_t>(std::max(1u, mesh.getDimension()));
+        status = METIS_PartMeshDual(
+            &number_of_elements, &number_of_nodes, eptr.data(), eind.data(),
+            weights.data(), nullptr, &number_of_common_nodes, &nparts, nullptr,
+            options, &objval, element_partition_ids.data(),
+            node_partition_ids.data());
+    }
+
+    if (status != METIS_OK)
+    {
+        OGS_FATAL("METIS failed to partition the mesh, error code %d.",
+                  status);
+    }
+    INFO("METIS partitioning finished with an edge-cut of %d.", objval);
+
+    return {begin(node_partition_ids), end(node_partition_ids)};
+}
 }  // namespace ApplicationUtils
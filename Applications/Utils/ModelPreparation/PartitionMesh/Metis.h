@@ -11,12 +11,14 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
 namespace MeshLib
 {
 class Element;
+class Mesh;
 }
 
 namespace ApplicationUtils
@@ -41,4 +43,31 @@ std::vector<std::size_t> readMetisData(const std::string& file_name_base,
 void removeMetisPartitioningFiles(std::string const& file_name_base,
                                   long number_of_partitions);
 
+/// Computes element weights approximating the assembly cost of the elements.
+/// \param mesh The mesh.
+/// \param weight_by_cell_type If true, the weight of an element is the squared
+///                            number of its nodes, i.e. the number of entries
+///                            of its local matrix; otherwise it is one.
+/// \param material_weights Factors multiplying the weights of the elements with
+///                         the given material ids. Elements with other
+///                         material ids keep their weights.
+std::vector<long> computeElementWeights(
+    MeshLib::Mesh const& mesh, bool weight_by_cell_type,
+    std::map<int, long> const& material_weights);
+
+/// Partition the mesh nodes by calling the METIS library directly on the
+/// in-memory element-node connectivity; no METIS files are written.
+///
+/// Without element weights the nodal graph is partitioned, which gives the
+/// same result as running `mpmetis -gtype=nodal`. With element weights the
+/// dual graph, in which elements sharing a face are adjacent, is partitioned
+/// and the nodes are assigned to the partitions of their elements.
+/// \param mesh The mesh.
+/// \param number_of_partitions The number of partitions.
+/// \param element_weights Weights of the elements, or empty.
+/// \return The partition ids of the mesh nodes.
+std::vector<std::size_t> partitionMeshWithMetis(
+    MeshLib::Mesh const& mesh, long number_of_partitions,
+    std::vector<long> const& element_weights);
+
 }  // namespace ApplicationUtils
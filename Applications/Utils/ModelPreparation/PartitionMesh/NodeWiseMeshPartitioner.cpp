@@ -14,6 +14,9 @@
 
 #include "NodeWiseMeshPartitioner.h"
 
+#include <array>
+#include <cstdint>
+#include <fstream>
 #include <limits>
 #include <numeric>
 #include <unordered_map>
@@ -23,6 +26,7 @@
 #include "BaseLib/Error.h"
 #include "BaseLib/Stream.h"
 
+#include "MeshLib/IO/MPI_IO/PartitionedMeshFileFormat.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
 namespace ApplicationUtils
@@ -409,10 +413,21 @@ bool copyPropertyVector(MeshLib::Properties const& original_properties,
             pv->getMeshItemType());
     };
 
-    std::size_t position_offset(0);
-    for (auto p : partitions)
+    // The partitions' values are copied in parallel to their positions in the
+    // partitioned property vector.
+    std::vector<std::size_t> position_offsets(partitions.size() + 1, 0);
+    for (std::size_t i = 0; i < partitions.size(); ++i)
     {
-        position_offset += copy_property_vector_values(p, position_offset);
+        position_offsets[i + 1] =
+            position_offsets[i] +
+            partitions[i].numberOfMeshItems(pv->getMeshItemType());
+    }
+    auto const number_of_partitions =
+        static_cast<std::ptrdiff_t>(partitions.size());
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t i = 0; i < number_of_partitions; ++i)
+    {
+        copy_property_vector_values(partitions[i], position_offsets[i]);
     }
     return true;
 }
@@ -487,9 +502,13 @@ MeshLib::Properties partitionProperties(
 void NodeWiseMeshPartitioner::partitionByMETIS(
     const bool is_mixed_high_order_linear_elems)
 {
-    for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
+    INFO("Processing %d partitions ...", _partitions.size());
+    // The partitions are independent of each other.
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t part_id = 0;
+         part_id < static_cast<std::ptrdiff_t>(_partitions.size()); part_id++)
     {
-        INFO("Processing partition: %d", part_id);
+        DBUG("Processing partition: %d", part_id);
         processPartition(part_id, is_mixed_high_order_linear_elems);
     }
 
@@ -606,10 +625,15 @@ std::vector<Partition> NodeWiseMeshPartitioner::partitionOtherMesh(
             "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
 
     std::vector<Partition> partitions(_partitions.size());
-    for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
+    // The partitions are independent of each other.
+    auto const number_of_partitions =
+        static_cast<std::ptrdiff_t>(partitions.size());
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t p = 0; p < number_of_partitions; p++)
     {
+        auto const part_id = static_cast<std::size_t>(p);
         auto& partition = partitions[part_id];
-        INFO("Processing partition: %d", part_id);
+        DBUG("Processing partition: %d", part_id);
         {
             // Set the node numbers of base and all mesh nodes.
             partition.number_of_mesh_base_nodes = mesh.getNumberOfBaseNodes();
@@ -1030,6 +1054,224 @@ void NodeWiseMeshPartitioner::writeBinary(const std::string& file_name_base)
     writeNodesBinary(file_name_base, _partitions, _nodes_global_ids);
 }
 
+/// Writes \c number_of_bytes from \c data followed by zeros up to the padded
+/// size of the section of the single file binary format.
+void writePaddedBinary(std::ostream& os, void const* const data,
+                       std::uint64_t const number_of_bytes)
+{
+    os.write(reinterpret_cast<const char*>(data), number_of_bytes);
+    char const zeros[8] = {};
+    os.write(zeros,
+             MeshLib::IO::PartitionedMeshFileFormat::paddedSize(
+                 number_of_bytes) -
+                 number_of_bytes);
+}
+
+template <typename T>
+bool writePropertyVectorPartitionBinary(
+    MeshLib::Properties const& partitioned_properties, std::string const& name,
+    std::uint64_t const tuple_offset, std::uint64_t const number_of_tuples,
+    std::ostream& os)
+{
+    if (!partitioned_properties.existsPropertyVector<T>(name))
+    {
+        return false;
+    }
+
+    auto const* pv = partitioned_properties.getPropertyVector<T>(name);
+    std::uint64_t const number_of_components = pv->getNumberOfComponents();
+    MeshLib::IO::PartitionedMeshFileFormat::PropertyHeader const header{
+        static_cast<std::uint64_t>(pv->getMeshItemType()),
+        std::numeric_limits<T>::is_integer,
+        std::numeric_limits<T>::is_signed,
+        sizeof(T),
+        number_of_components,
+        number_of_tuples,
+        name.size()};
+    writePaddedBinary(os, &header, sizeof(header));
+    writePaddedBinary(os, name.data(), name.size());
+    writePaddedBinary(os, pv->data() + tuple_offset * number_of_components,
+                      number_of_tuples * number_of_components * sizeof(T));
+    return true;
+}
+
+/// Writes the data block of a partition in the single file binary format,
+/// see MeshLib::IO::PartitionedMeshFileFormat.
+void writePartitionBlockBinary(
+    std::ostream& os, Partition const& partition,
+    std::vector<std::size_t> const& global_node_ids,
+    MeshLib::Properties const& partitioned_properties,
+    std::vector<std::string> const& property_names,
+    std::array<std::uint64_t, 2> const& tuple_offsets)
+{
+    namespace Format = MeshLib::IO::PartitionedMeshFileFormat;
+
+    std::vector<const MeshLib::Element*> elements;
+    elements.reserve(partition.regular_elements.size() +
+                     partition.ghost_elements.size());
+    elements.insert(elements.end(), partition.regular_elements.begin(),
+                    partition.regular_elements.end());
+    elements.insert(elements.end(), partition.ghost_elements.begin(),
+                    partition.ghost_elements.end());
+
+    std::vector<std::uint64_t> element_offsets;
+    element_offsets.reserve(elements.size() + 1);
+    std::vector<std::uint8_t> cell_types;
+    cell_types.reserve(elements.size());
+    element_offsets.push_back(0);
+    for (auto const* e : elements)
+    {
+        element_offsets.push_back(element_offsets.back() +
+                                  e->getNumberOfNodes());
+        cell_types.push_back(static_cast<std::uint8_t>(e->getCellType()));
+    }
+
+    auto const local_node_ids = enumerateLocalNodeIds(partition.nodes);
+    std::vector<std::uint64_t> element_node_ids;
+    element_node_ids.reserve(element_offsets.back());
+    for (auto const* e : elements)
+    {
+        for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+        {
+            element_node_ids.push_back(
+                local_node_ids.at(e->getNode(i)->getID()));
+        }
+    }
+
+    Format::PartitionHeader const header{
+        partition.nodes.size(),
+        partition.number_of_base_nodes,
+        partition.regular_elements.size(),
+        partition.ghost_elements.size(),
+        partition.number_of_non_ghost_base_nodes,
+        partition.number_of_non_ghost_nodes,
+        partition.number_of_mesh_base_nodes,
+        partition.number_of_mesh_all_nodes,
+        element_node_ids.size(),
+        property_names.size()};
+    writePaddedBinary(os, &header, sizeof(header));
+
+    std::vector<std::uint64_t> node_ids;
+    node_ids.reserve(partition.nodes.size());
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * partition.nodes.size());
+    for (auto const* node : partition.nodes)
+    {
+        node_ids.push_back(global_node_ids[node->getID()]);
+        coordinates.insert(coordinates.end(), node->getCoords(),
+                           node->getCoords() + 3);
+    }
+    writePaddedBinary(os, node_ids.data(),
+                      node_ids.size() * sizeof(std::uint64_t));
+    writePaddedBinary(os, coordinates.data(),
+                      coordinates.size() * sizeof(double));
+    writePaddedBinary(os, element_offsets.data(),
+                      element_offsets.size() * sizeof(std::uint64_t));
+    writePaddedBinary(os, cell_types.data(),
+                      cell_types.size() * sizeof(std::uint8_t));
+    writePaddedBinary(os, element_node_ids.data(),
+                      element_node_ids.size() * sizeof(std::uint64_t));
+
+    applyToPropertyVectors(
+        property_names, [&](auto type, std::string const& name) {
+            if (!partitioned_properties.existsPropertyVector<decltype(type)>(
+                    name))
+            {
+                return false;
+            }
+            auto const item_type =
+                partitioned_properties.getPropertyVector<decltype(type)>(name)
+                    ->getMeshItemType();
+            int const i = item_type == MeshLib::MeshItemType::Node ? 0 : 1;
+            return writePropertyVectorPartitionBinary<decltype(type)>(
+                partitioned_properties, name, tuple_offsets[i],
+                partition.numberOfMeshItems(item_type), os);
+        });
+}
+
+/// Writes the partitions and their node and cell properties into a single file
+/// in the format described in MeshLib::IO::PartitionedMeshFileFormat.
+void writeSingleFileBinary(std::string const& file_name_base,
+                           std::vector<Partition> const& partitions,
+                           std::vector<std::size_t> const& global_node_ids,
+                           MeshLib::Properties const& partitioned_properties)
+{
+    namespace Format = MeshLib::IO::PartitionedMeshFileFormat;
+
+    auto const file_name = Format::fileName(file_name_base, partitions.size());
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        OGS_FATAL("Could not open file '%s' for output.", file_name.c_str());
+    }
+
+    Format::FileHeader header{{}, Format::version, Format::byte_order_mark,
+                              partitions.size()};
+    std::copy(std::begin(Format::magic), std::end(Format::magic),
+              header.magic);
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // The index is written after the partitions' sizes are known.
+    std::vector<Format::PartitionIndexEntry> index(partitions.size());
+    auto const index_position = os.tellp();
+    os.write(reinterpret_cast<const char*>(index.data()),
+             index.size() * sizeof(Format::PartitionIndexEntry));
+
+    std::vector<std::string> property_names =
+        partitioned_properties.getPropertyVectorNames(
+            MeshLib::MeshItemType::Node);
+    for (auto const& name : partitioned_properties.getPropertyVectorNames(
+             MeshLib::MeshItemType::Cell))
+    {
+        property_names.push_back(name);
+    }
+
+    // Offsets of the partition's node and cell tuples in the partitioned
+    // properties.
+    std::array<std::uint64_t, 2> tuple_offsets = {0, 0};
+    for (std::size_t i = 0; i < partitions.size(); ++i)
+    {
+        auto const& partition = partitions[i];
+        index[i].offset = static_cast<std::uint64_t>(os.tellp());
+        writePartitionBlockBinary(os, partition, global_node_ids,
+                                  partitioned_properties, property_names,
+                                  tuple_offsets);
+        index[i].size =
+            static_cast<std::uint64_t>(os.tellp()) - index[i].offset;
+
+        tuple_offsets[0] +=
+            partition.numberOfMeshItems(MeshLib::MeshItemType::Node);
+        tuple_offsets[1] +=
+            partition.numberOfMeshItems(MeshLib::MeshItemType::Cell);
+    }
+
+    os.seekp(index_position);
+    os.write(reinterpret_cast<const char*>(index.data()),
+             index.size() * sizeof(Format::PartitionIndexEntry));
+    if (!os)
+    {
+        OGS_FATAL("Could not write file '%s'.", file_name.c_str());
+    }
+}
+
+void NodeWiseMeshPartitioner::writeSingleFileBinary(
+    const std::string& file_name_base) const
+{
+    ApplicationUtils::writeSingleFileBinary(file_name_base, _partitions,
+                                            _nodes_global_ids,
+                                            _partitioned_properties);
+}
+
+void NodeWiseMeshPartitioner::writeOtherMeshSingleFileBinary(
+    std::string const& output_filename_base,
+    std::vector<Partition> const& partitions,
+    MeshLib::Properties const& partitioned_properties) const
+{
+    ApplicationUtils::writeSingleFileBinary(output_filename_base, partitions,
+                                            _nodes_global_ids,
+                                            partitioned_properties);
+}
+
 void NodeWiseMeshPartitioner::writeOtherMesh(
     std::string const& output_filename_base,
     std::vector<Partition> const& partitions,
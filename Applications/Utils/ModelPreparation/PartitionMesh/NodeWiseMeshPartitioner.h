@@ -105,11 +105,22 @@ public:
     /// \param file_name_base The prefix of the file name.
     void writeBinary(const std::string& file_name_base);
 
+    /// Write the partitions into a single binary file with a per-partition
+    /// index, which allows each process to read only its own partition; see
+    /// MeshLib::IO::PartitionedMeshFileFormat.
+    /// \param file_name_base The prefix of the file name.
+    void writeSingleFileBinary(const std::string& file_name_base) const;
+
     void writeOtherMesh(
         std::string const& output_filename_base,
         std::vector<Partition> const& partitions,
         MeshLib::Properties const& partitioned_properties) const;
 
+    void writeOtherMeshSingleFileBinary(
+        std::string const& output_filename_base,
+        std::vector<Partition> const& partitions,
+        MeshLib::Properties const& partitioned_properties) const;
+
     void resetPartitionIdsForNodes(
         std::vector<std::size_t>&& node_partition_ids)
     {
@@ -12,6 +12,8 @@
 
 */
 
+#include <map>
+
 #include <tclap/CmdLine.h>
 
 #ifdef WIN32
@@ -77,6 +79,28 @@ int main(int argc, char* argv[])
         false);
     cmd.add(exe_metis_flag);
 
+    TCLAP::SwitchArg lib_metis_flag(
+        "l", "lib_metis",
+        "Call the METIS library directly on the mesh in memory instead of "
+        "running mpmetis; no METIS files are written.",
+        false);
+    cmd.add(lib_metis_flag);
+
+    TCLAP::SwitchArg cell_type_weights_flag(
+        "", "cell_type_weights",
+        "Weight the elements by the squared number of their nodes, which "
+        "approximates their assembly cost. Requires --lib_metis.",
+        false);
+    cmd.add(cell_type_weights_flag);
+
+    TCLAP::MultiArg<std::string> material_weights_arg(
+        "", "material_weight",
+        "Multiply the weights of the elements with the given material id by "
+        "the given factor, e.g. --material_weight 1:4. Can be given multiple "
+        "times. Requires --lib_metis.",
+        false, "material_id:factor");
+    cmd.add(material_weights_arg);
+
     TCLAP::SwitchArg lh_elems_flag(
         "q", "lh_elements", "Mixed linear and high order elements.", false);
     cmd.add(lh_elems_flag);
@@ -84,6 +108,13 @@ int main(int argc, char* argv[])
     TCLAP::SwitchArg ascii_flag("a", "ascii", "Enable ASCII output.", false);
     cmd.add(ascii_flag);
 
+    TCLAP::SwitchArg single_file_flag(
+        "", "single-file",
+        "Write the binary output into a single file per mesh, which allows the "
+        "parallel reader to map only the data of its own partition.",
+        false);
+    cmd.add(single_file_flag);
+
     // All the remaining arguments are used as file names for boundary/subdomain
     // meshes.
     TCLAP::UnlabeledMultiArg<std::string> other_meshes_filenames_arg(
@@ -137,8 +168,41 @@ int main(int argc, char* argv[])
             "-np=1'.");
     }
 
+    std::map<int, long> material_weights;
+    for (auto const& weight : material_weights_arg.getValue())
+    {
+        auto const separator = weight.find(':');
+        if (separator == std::string::npos)
+        {
+            OGS_FATAL(
+                "The material weight '%s' is not of the form "
+                "material_id:factor.",
+                weight.c_str());
+        }
+        material_weights[std::stoi(weight.substr(0, separator))] =
+            std::stol(weight.substr(separator + 1));
+    }
+    bool const use_element_weights =
+        cell_type_weights_flag.getValue() || !material_weights.empty();
+    if (use_element_weights && !lib_metis_flag.getValue())
+    {
+        OGS_FATAL("Element weights can only be used with --lib_metis.");
+    }
+
+    if (lib_metis_flag.getValue())
+    {
+        INFO("Partitioning the mesh with the METIS library ...");
+        auto const element_weights =
+            use_element_weights
+                ? computeElementWeights(mesh_partitioner.mesh(),
+                                        cell_type_weights_flag.getValue(),
+                                        material_weights)
+                : std::vector<long>{};
+        mesh_partitioner.resetPartitionIdsForNodes(partitionMeshWithMetis(
+            mesh_partitioner.mesh(), num_partitions, element_weights));
+    }
     // Execute mpmetis via system(...)
-    if (exe_metis_flag.getValue())
+    else if (exe_metis_flag.getValue())
     {
         INFO("METIS is running ...");
         const std::string exe_name = argv[0];
@@ -158,11 +222,15 @@ int main(int argc, char* argv[])
             return EXIT_FAILURE;
         }
     }
-    mesh_partitioner.resetPartitionIdsForNodes(
-        readMetisData(input_file_name_wo_extension, num_partitions,
-                      mesh_partitioner.mesh().getNumberOfNodes()));
+    if (!lib_metis_flag.getValue())
+    {
+        mesh_partitioner.resetPartitionIdsForNodes(
+            readMetisData(input_file_name_wo_extension, num_partitions,
+                          mesh_partitioner.mesh().getNumberOfNodes()));
 
-    removeMetisPartitioningFiles(input_file_name_wo_extension, num_partitions);
+        removeMetisPartitioningFiles(input_file_name_wo_extension,
+                                     num_partitions);
+    }
 
     INFO("Partitioning the mesh in the node wise way ...");
     bool const is_mixed_high_order_linear_elems = lh_elems_flag.getValue();
@@ -193,8 +261,17 @@ int main(int argc, char* argv[])
             partitioned_properties.getPropertyVector<std::size_t>(
                 "bulk_element_ids", MeshLib::MeshItemType::Cell, 1),
             partitions);
-        mesh_partitioner.writeOtherMesh(output_file_name_wo_extension,
-                                        partitions, partitioned_properties);
+        if (single_file_flag.getValue())
+        {
+            mesh_partitioner.writeOtherMeshSingleFileBinary(
+                output_file_name_wo_extension, partitions,
+                partitioned_properties);
+        }
+        else
+        {
+            mesh_partitioner.writeOtherMesh(output_file_name_wo_extension,
+                                            partitions, partitioned_properties);
+        }
     }
 
     if (ascii_flag.getValue())
@@ -202,6 +279,11 @@ int main(int argc, char* argv[])
         INFO("Write the data of partitions into ASCII files ...");
         mesh_partitioner.writeASCII(output_file_name_wo_extension);
     }
+    else if (single_file_flag.getValue())
+    {
+        INFO("Write the data of partitions into a single binary file ...");
+        mesh_partitioner.writeSingleFileBinary(output_file_name_wo_extension);
+    }
     else
     {
         INFO("Write the data of partitions into binary files ...");
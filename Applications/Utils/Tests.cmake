@@ -184,6 +184,52 @@ AddTest(
               2Dmesh_POINT5_partitioned_node_properties_val3.bin
 )
 
+# The single file output is checked against the multi file binary output by
+# the MPITest_MeshLib.NodePartitionedMeshReaderSingleFileBinary unit test.
+AddTest(
+    NAME partmesh_2Dmesh_3partitions_single_file
+    PATH NodePartitionedMesh/partmesh_2Dmesh_3partitions
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -m -n 3 -i 2Dmesh.vtu --single-file
+                    -o ${Data_BINARY_DIR}/NodePartitionedMesh/partmesh_2Dmesh_3partitions --
+                    2Dmesh_PLY_EAST.vtu
+                    2Dmesh_PLY_WEST.vtu
+                    2Dmesh_PLY_NORTH.vtu
+                    2Dmesh_PLY_SOUTH.vtu
+                    2Dmesh_POINT4.vtu
+                    2Dmesh_POINT5.vtu
+    REQUIREMENTS NOT (OGS_USE_MPI OR APPLE)
+)
+
+# The METIS library partitions the same as mpmetis, so the output is compared
+# to the reference files of the ascii test. The output is written into a
+# subdirectory to not interfere with the ascii test.
+file(MAKE_DIRECTORY
+    ${Data_BINARY_DIR}/NodePartitionedMesh/partmesh_2Dmesh_3partitions/lib_metis)
+AddTest(
+    NAME partmesh_2Dmesh_3partitions_lib_metis
+    PATH NodePartitionedMesh/partmesh_2Dmesh_3partitions
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -a -l -n 3 -i 2Dmesh.vtu -o ${Data_BINARY_DIR}/NodePartitionedMesh/partmesh_2Dmesh_3partitions/lib_metis
+    REQUIREMENTS NOT (OGS_USE_MPI OR APPLE)
+    TESTER diff
+    DIFF_DATA lib_metis/2Dmesh_partitioned_elems_3.msh
+              lib_metis/2Dmesh_partitioned_cfg3.msh
+              lib_metis/2Dmesh_partitioned_nodes_3.msh
+)
+
+# Partitioning weighted by the element types and the materials. There are no
+# reference files for the weighted partitions.
+AddTest(
+    NAME partmesh_tm_q_quad_3partitions_element_weights
+    PATH ThermoMechanics
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -l -n 3 -i tm_q_quad.vtu --cell_type_weights
+                    --material_weight 0:2 --material_weight 1:4
+                    -o ${Data_BINARY_DIR}/ThermoMechanics
+    REQUIREMENTS NOT OGS_USE_MPI
+)
+
 # Regression test for https://github.com/ufz/ogs/issues/1845 fixed in
 # https://github.com/ufz/ogs/pull/2237
 # checkMesh crashed when encountered Line3 element.
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <vector>
@@ -70,6 +71,51 @@ T readBinaryValue(std::istream& in)
     return v;
 }
 
+/**
+ * \brief write the size and the entries of a vector as binary into the given
+ * output stream
+ *
+ * \tparam T    trivially copyable data type of the entries
+ * \param out   output stream, have to be opened in binary mode
+ * \param vec   vector to be written
+ */
+template <typename T>
+void writeVectorBinary(std::ostream& out, std::vector<T> const& vec)
+{
+    writeValueBinary(out, static_cast<std::uint64_t>(vec.size()));
+    out.write(reinterpret_cast<const char*>(vec.data()),
+              sizeof(T) * vec.size());
+}
+
+/// Reads a vector written by writeVectorBinary() from the given input stream.
+template <typename T>
+std::vector<T> readBinaryVector(std::istream& in)
+{
+    auto const size = readBinaryValue<std::uint64_t>(in);
+    if (!in)
+    {
+        return {};
+    }
+    std::vector<T> vec(size);
+    in.read(reinterpret_cast<char*>(vec.data()), sizeof(T) * size);
+    return vec;
+}
+
+/// Writes \c n values starting at \c data as binary into the given output
+/// stream without a size prefix, e.g. the entries of a fixed size vector.
+template <typename T>
+void writeValuesBinary(std::ostream& out, T const* data, std::size_t const n)
+{
+    out.write(reinterpret_cast<const char*>(data), sizeof(T) * n);
+}
+
+/// Reads \c n values written by writeValuesBinary() into \c data.
+template <typename T>
+void readBinaryValues(std::istream& in, T* data, std::size_t const n)
+{
+    in.read(reinterpret_cast<char*>(data), sizeof(T) * n);
+}
+
 template <typename T>
 std::vector<T> readBinaryArray(std::string const& filename, std::size_t const n)
 {
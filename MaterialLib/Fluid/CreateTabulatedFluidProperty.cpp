@@ -0,0 +1,103 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CreateTabulatedFluidProperty.h"
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property,
+    TabulationVariable const variable)
+{
+    TabulationGrid grid;
+    //! \ogs_file_param{material__fluid__tabulation__temperature_min}
+    grid.T_min = config.getConfigParameter<double>("temperature_min");
+    //! \ogs_file_param{material__fluid__tabulation__temperature_max}
+    grid.T_max = config.getConfigParameter<double>("temperature_max");
+    grid.number_of_temperature_points =
+        //! \ogs_file_param{material__fluid__tabulation__number_of_temperature_points}
+        config.getConfigParameter<std::size_t>("number_of_temperature_points");
+    grid.variable = variable;
+    if (variable == TabulationVariable::Pressure)
+    {
+        //! \ogs_file_param{material__fluid__tabulation__pressure_min}
+        grid.x_min = config.getConfigParameter<double>("pressure_min");
+        //! \ogs_file_param{material__fluid__tabulation__pressure_max}
+        grid.x_max = config.getConfigParameter<double>("pressure_max");
+        grid.number_of_x_points =
+            //! \ogs_file_param{material__fluid__tabulation__number_of_pressure_points}
+            config.getConfigParameter<std::size_t>("number_of_pressure_points");
+    }
+    else
+    {
+        //! \ogs_file_param{material__fluid__tabulation__density_min}
+        grid.x_min = config.getConfigParameter<double>("density_min");
+        //! \ogs_file_param{material__fluid__tabulation__density_max}
+        grid.x_max = config.getConfigParameter<double>("density_max");
+        grid.number_of_x_points =
+            //! \ogs_file_param{material__fluid__tabulation__number_of_density_points}
+            config.getConfigParameter<std::size_t>("number_of_density_points");
+    }
+
+    auto const interpolation_str =
+        //! \ogs_file_param{material__fluid__tabulation__interpolation}
+        config.getConfigParameter<std::string>("interpolation", "Bicubic");
+    TabulationInterpolation interpolation;
+    if (interpolation_str == "Bicubic")
+    {
+        interpolation = TabulationInterpolation::Bicubic;
+    }
+    else if (interpolation_str == "Bilinear")
+    {
+        interpolation = TabulationInterpolation::Bilinear;
+    }
+    else
+    {
+        OGS_FATAL(
+            "Unknown interpolation `%s' of a tabulated fluid property. The "
+            "available interpolations are Bicubic and Bilinear.",
+            interpolation_str.c_str());
+    }
+
+    auto const file_name =
+        //! \ogs_file_param{material__fluid__tabulation__file}
+        config.getConfigParameter<std::string>("file", "");
+
+    auto const max_relative_error =
+        //! \ogs_file_param{material__fluid__tabulation__max_relative_error}
+        config.getConfigParameterOptional<double>("max_relative_error");
+
+    auto tabulated_property = std::make_unique<TabulatedFluidProperty>(
+        std::move(property), grid, interpolation, file_name);
+
+    auto const relative_error =
+        tabulated_property->estimateMaximumRelativeError();
+    INFO("%s: estimated maximum relative interpolation error %g.",
+         tabulated_property->getName().c_str(), relative_error);
+    if (max_relative_error && relative_error > *max_relative_error)
+    {
+        OGS_FATAL(
+            "%s: the estimated maximum relative interpolation error %g "
+            "exceeds the prescribed maximum %g. Use more grid points.",
+            tabulated_property->getName().c_str(), relative_error,
+            *max_relative_error);
+    }
+
+    return tabulated_property;
+}
+}  // namespace Fluid
+}  // namespace MaterialLib
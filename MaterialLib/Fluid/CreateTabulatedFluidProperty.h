@@ -0,0 +1,36 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "FluidProperty.h"
+#include "TabulatedFluidProperty.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// Wraps the given property into a TabulatedFluidProperty.
+/// \param config  ConfigTree object which has a tag of `<tabulation>`
+/// \param property  the property to be tabulated.
+/// \param variable  the variable besides the temperature the property depends
+///                  on. It selects the grid parameters read from \c config.
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property,
+    TabulationVariable const variable);
+}  // namespace Fluid
+}  // namespace MaterialLib
@@ -23,6 +23,7 @@
 #include "WaterDensityIAPWSIF97Region1.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 
 namespace MaterialLib
 {
@@ -164,7 +165,18 @@ std::unique_ptr<FluidProperty> createFluidDensityModel(
     }
     if (type == "WaterDensityIAPWSIF97Region1")
     {
-        return std::make_unique<WaterDensityIAPWSIF97Region1>();
+        //! \ogs_file_param{material__fluid__density__type}
+        config.checkConfigParameter("type", "WaterDensityIAPWSIF97Region1");
+        auto density = std::make_unique<WaterDensityIAPWSIF97Region1>();
+        if (auto const tabulation_config =
+                //! \ogs_file_param{material__fluid__density__WaterDensityIAPWSIF97Region1__tabulation}
+            config.getConfigSubtreeOptional("tabulation"))
+        {
+            return createTabulatedFluidProperty(*tabulation_config,
+                                                std::move(density),
+                                                TabulationVariable::Pressure);
+        }
+        return density;
     }
 
     OGS_FATAL(
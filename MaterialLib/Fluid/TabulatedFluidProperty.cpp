@@ -0,0 +1,414 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TabulatedFluidProperty.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace
+{
+char const file_header[] = "OGS fluid property table";
+std::uint32_t const file_version = 2;
+
+/// Cubic Hermite basis functions on [0, 1] and their derivatives. The first
+/// two interpolate the values at 0 and 1, the last two the derivatives.
+void hermiteBasis(double const t, std::array<double, 4>& h,
+                  std::array<double, 4>& dh)
+{
+    double const t2 = t * t;
+    double const t3 = t2 * t;
+    h = {{2 * t3 - 3 * t2 + 1, -2 * t3 + 3 * t2, t3 - 2 * t2 + t, t3 - t2}};
+    dh = {{6 * t2 - 6 * t, -6 * t2 + 6 * t, 3 * t2 - 4 * t + 1,
+           3 * t2 - 2 * t}};
+}
+
+/// Returns the index of the cell containing x and the local coordinate of x
+/// in [0, 1] within that cell.
+std::pair<std::size_t, double> locate(double const x, double const x_min,
+                                      double const dx,
+                                      std::size_t const number_of_points)
+{
+    double const position = (x - x_min) / dx;
+    auto const i = std::min(static_cast<std::size_t>(position),
+                            number_of_points - 2);
+    return {i, position - i};
+}
+
+/// Returns the index of the given variable in the property variable array.
+int variableIndex(MaterialLib::Fluid::TabulationVariable const variable)
+{
+    using MaterialLib::Fluid::PropertyVariableType;
+    return static_cast<int>(
+        variable == MaterialLib::Fluid::TabulationVariable::Pressure
+            ? PropertyVariableType::p
+            : PropertyVariableType::rho);
+}
+
+char const* variableName(MaterialLib::Fluid::TabulationVariable const variable)
+{
+    return variable == MaterialLib::Fluid::TabulationVariable::Pressure
+               ? "pressure"
+               : "density";
+}
+
+template <typename T>
+void writeBinary(std::ofstream& os, T const& value)
+{
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+void readBinary(std::ifstream& is, T& value)
+{
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+}  // namespace
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+TabulatedFluidProperty::TabulatedFluidProperty(
+    std::unique_ptr<FluidProperty>&& property,
+    TabulationGrid const& grid,
+    TabulationInterpolation const interpolation,
+    std::string const& file_name)
+    : _property(std::move(property)),
+      _grid(grid),
+      _interpolation(interpolation),
+      _x_index(variableIndex(grid.variable)),
+      _dT((grid.T_max - grid.T_min) / (grid.number_of_temperature_points - 1)),
+      _dx((grid.x_max - grid.x_min) / (grid.number_of_x_points - 1))
+{
+    if (grid.number_of_temperature_points < 2 || grid.number_of_x_points < 2)
+    {
+        OGS_FATAL(
+            "The tabulation grid needs at least two points in each direction.");
+    }
+    if (!(grid.T_min < grid.T_max) || !(grid.x_min < grid.x_max))
+    {
+        OGS_FATAL(
+            "The tabulation grid's minimum temperature and %s must be less "
+            "than the maximum values.",
+            variableName(grid.variable));
+    }
+
+    if (!file_name.empty() && readTable(file_name))
+    {
+        INFO("Read the table of the property `%s' from file `%s'.",
+             _property->getName().c_str(), file_name.c_str());
+        return;
+    }
+
+    tabulate();
+
+    if (!file_name.empty())
+    {
+        writeTable(file_name);
+    }
+}
+
+double TabulatedFluidProperty::getValue(const ArrayType& var_vals) const
+{
+    double const T = var_vals[static_cast<int>(PropertyVariableType::T)];
+    double const x = var_vals[_x_index];
+    if (!isInside(T, x))
+    {
+        return _property->getValue(var_vals);
+    }
+    return interpolate(T, x)[0];
+}
+
+double TabulatedFluidProperty::getdValue(const ArrayType& var_vals,
+                                         const PropertyVariableType var) const
+{
+    double const T = var_vals[static_cast<int>(PropertyVariableType::T)];
+    double const x = var_vals[_x_index];
+    if (!isInside(T, x))
+    {
+        return _property->getdValue(var_vals, var);
+    }
+
+    if (var == PropertyVariableType::T)
+    {
+        return interpolate(T, x)[1];
+    }
+    // The pressure and the density share their index.
+    if (static_cast<int>(var) == _x_index)
+    {
+        return interpolate(T, x)[2];
+    }
+    return 0.0;
+}
+
+double TabulatedFluidProperty::estimateMaximumRelativeError() const
+{
+    double max_error = 0;
+    ArrayType vars = {};
+    for (std::size_t i = 0; i + 1 < _grid.number_of_temperature_points; ++i)
+    {
+        for (std::size_t j = 0; j + 1 < _grid.number_of_x_points; ++j)
+        {
+            vars[static_cast<int>(PropertyVariableType::T)] =
+                _grid.T_min + (i + 0.5) * _dT;
+            vars[_x_index] = _grid.x_min + (j + 0.5) * _dx;
+            double const exact = _property->getValue(vars);
+            double const error = std::abs(getValue(vars) - exact);
+            max_error = std::max(
+                max_error,
+                exact != 0 ? error / std::abs(exact) : error);
+        }
+    }
+    return max_error;
+}
+
+bool TabulatedFluidProperty::isInside(double const T, double const x) const
+{
+    return T >= _grid.T_min && T <= _grid.T_max && x >= _grid.x_min &&
+           x <= _grid.x_max;
+}
+
+TabulatedFluidProperty::Interpolant TabulatedFluidProperty::interpolate(
+    double const T, double const x) const
+{
+    auto const cell_T =
+        locate(T, _grid.T_min, _dT, _grid.number_of_temperature_points);
+    auto const cell_x = locate(x, _grid.x_min, _dx, _grid.number_of_x_points);
+
+    if (_interpolation == TabulationInterpolation::Bilinear)
+    {
+        return interpolateBilinear(cell_T.first, cell_x.first, cell_T.second,
+                                   cell_x.second);
+    }
+    return interpolateBicubic(cell_T.first, cell_x.first, cell_T.second,
+                              cell_x.second);
+}
+
+TabulatedFluidProperty::Interpolant TabulatedFluidProperty::interpolateBilinear(
+    std::size_t const i, std::size_t const j, double const t,
+    double const s) const
+{
+    std::array<double, 4> const weights = {
+        {(1 - t) * (1 - s), t * (1 - s), (1 - t) * s, t * s}};
+    std::array<std::size_t, 4> const indices = {
+        {index(i, j), index(i + 1, j), index(i, j + 1), index(i + 1, j + 1)}};
+
+    Interpolant result = {{0, 0, 0}};
+    for (int k = 0; k < 4; ++k)
+    {
+        result[0] += weights[k] * _values[indices[k]];
+        result[1] += weights[k] * _dvalues_dT[indices[k]];
+        result[2] += weights[k] * _dvalues_dx[indices[k]];
+    }
+    return result;
+}
+
+TabulatedFluidProperty::Interpolant TabulatedFluidProperty::interpolateBicubic(
+    std::size_t const i, std::size_t const j, double const t,
+    double const s) const
+{
+    std::array<double, 4> h_t;
+    std::array<double, 4> dh_t;
+    std::array<double, 4> h_s;
+    std::array<double, 4> dh_s;
+    hermiteBasis(t, h_t, dh_t);
+    hermiteBasis(s, h_s, dh_s);
+
+    Interpolant result = {{0, 0, 0}};
+    for (int a = 0; a < 2; ++a)
+    {
+        for (int b = 0; b < 2; ++b)
+        {
+            auto const k = index(i + a, j + b);
+            // Values and derivatives scaled to the unit cell.
+            double const f = _values[k];
+            double const f_t = _dT * _dvalues_dT[k];
+            double const f_s = _dx * _dvalues_dx[k];
+            double const f_ts = _dT * _dx * _d2values_dTdx[k];
+
+            // Basis functions for the values (a, b) and for the derivatives
+            // (2 + a, 2 + b).
+            result[0] += h_t[a] * h_s[b] * f + h_t[2 + a] * h_s[b] * f_t +
+                         h_t[a] * h_s[2 + b] * f_s +
+                         h_t[2 + a] * h_s[2 + b] * f_ts;
+            result[1] += dh_t[a] * h_s[b] * f + dh_t[2 + a] * h_s[b] * f_t +
+                         dh_t[a] * h_s[2 + b] * f_s +
+                         dh_t[2 + a] * h_s[2 + b] * f_ts;
+            result[2] += h_t[a] * dh_s[b] * f + h_t[2 + a] * dh_s[b] * f_t +
+                         h_t[a] * dh_s[2 + b] * f_s +
+                         h_t[2 + a] * dh_s[2 + b] * f_ts;
+        }
+    }
+    result[1] /= _dT;
+    result[2] /= _dx;
+    return result;
+}
+
+void TabulatedFluidProperty::tabulate()
+{
+    auto const n_T = _grid.number_of_temperature_points;
+    auto const n_x = _grid.number_of_x_points;
+    _values.resize(n_T * n_x);
+    _dvalues_dT.resize(n_T * n_x);
+    _dvalues_dx.resize(n_T * n_x);
+    _d2values_dTdx.resize(n_T * n_x);
+
+    INFO("Tabulating the property `%s' on a temperature-%s grid of %d x %d "
+         "points.",
+         _property->getName().c_str(), variableName(_grid.variable),
+         static_cast<int>(n_T), static_cast<int>(n_x));
+
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n_T); ++i)
+    {
+        ArrayType vars = {};
+        vars[static_cast<int>(PropertyVariableType::T)] =
+            _grid.T_min + i * _dT;
+        for (std::size_t j = 0; j < n_x; ++j)
+        {
+            vars[_x_index] = _grid.x_min + j * _dx;
+            auto const k = index(i, j);
+            _values[k] = _property->getValue(vars);
+            _dvalues_dT[k] =
+                _property->getdValue(vars, PropertyVariableType::T);
+            _dvalues_dx[k] = _property->getdValue(
+                vars, static_cast<PropertyVariableType>(_x_index));
+        }
+    }
+
+    // The mixed derivatives are approximated by finite differences of the
+    // derivatives with respect to the second variable in temperature
+    // direction.
+    for (std::size_t i = 0; i < n_T; ++i)
+    {
+        auto const i_minus = i == 0 ? 0 : i - 1;
+        auto const i_plus = i == n_T - 1 ? n_T - 1 : i + 1;
+        for (std::size_t j = 0; j < n_x; ++j)
+        {
+            _d2values_dTdx[index(i, j)] =
+                (_dvalues_dx[index(i_plus, j)] -
+                 _dvalues_dx[index(i_minus, j)]) /
+                ((i_plus - i_minus) * _dT);
+        }
+    }
+}
+
+bool TabulatedFluidProperty::readTable(std::string const& file_name)
+{
+    std::ifstream is(file_name, std::ios::binary);
+    if (!is)
+    {
+        return false;
+    }
+
+    std::string header(sizeof(file_header), '\0');
+    is.read(&header[0], sizeof(file_header));
+    std::uint32_t version = 0;
+    readBinary(is, version);
+    std::uint64_t name_length = 0;
+    readBinary(is, name_length);
+    if (!is || header != std::string(file_header, sizeof(file_header)) ||
+        version != file_version || name_length > 1024)
+    {
+        WARN("The file `%s' is not a fluid property table; recomputing it.",
+             file_name.c_str());
+        return false;
+    }
+
+    std::string name(name_length, '\0');
+    is.read(&name[0], name_length);
+    TabulationGrid grid;
+    std::uint64_t n_T = 0;
+    std::uint64_t variable = 0;
+    std::uint64_t n_x = 0;
+    readBinary(is, grid.T_min);
+    readBinary(is, grid.T_max);
+    readBinary(is, n_T);
+    readBinary(is, variable);
+    readBinary(is, grid.x_min);
+    readBinary(is, grid.x_max);
+    readBinary(is, n_x);
+    if (!is || name != _property->getName() || grid.T_min != _grid.T_min ||
+        grid.T_max != _grid.T_max ||
+        n_T != _grid.number_of_temperature_points ||
+        variable != static_cast<std::uint64_t>(_grid.variable) ||
+        grid.x_min != _grid.x_min || grid.x_max != _grid.x_max ||
+        n_x != _grid.number_of_x_points)
+    {
+        WARN(
+            "The table in the file `%s' does not match the property `%s' or "
+            "the tabulation grid; recomputing it.",
+            file_name.c_str(), _property->getName().c_str());
+        return false;
+    }
+
+    auto const size = n_T * n_x;
+    for (auto* table : {&_values, &_dvalues_dT, &_dvalues_dx, &_d2values_dTdx})
+    {
+        table->resize(size);
+        is.read(reinterpret_cast<char*>(table->data()),
+                size * sizeof(double));
+    }
+    if (!is)
+    {
+        WARN("Could not read the table from the file `%s'; recomputing it.",
+             file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+void TabulatedFluidProperty::writeTable(std::string const& file_name) const
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        WARN("Could not open the file `%s' for writing the property table.",
+             file_name.c_str());
+        return;
+    }
+
+    auto const name = _property->getName();
+    os.write(file_header, sizeof(file_header));
+    writeBinary(os, file_version);
+    writeBinary(os, static_cast<std::uint64_t>(name.size()));
+    os.write(name.data(), name.size());
+    writeBinary(os, _grid.T_min);
+    writeBinary(os, _grid.T_max);
+    writeBinary(os,
+                static_cast<std::uint64_t>(_grid.number_of_temperature_points));
+    writeBinary(os, static_cast<std::uint64_t>(_grid.variable));
+    writeBinary(os, _grid.x_min);
+    writeBinary(os, _grid.x_max);
+    writeBinary(os, static_cast<std::uint64_t>(_grid.number_of_x_points));
+    for (auto const* table :
+         {&_values, &_dvalues_dT, &_dvalues_dx, &_d2values_dTdx})
+    {
+        os.write(reinterpret_cast<char const*>(table->data()),
+                 table->size() * sizeof(double));
+    }
+
+    if (!os)
+    {
+        WARN("Could not write the property table to the file `%s'.",
+             file_name.c_str());
+        return;
+    }
+    INFO("Wrote the table of the property `%s' to file `%s'.", name.c_str(),
+         file_name.c_str());
+}
+
+}  // namespace Fluid
+}  // namespace MaterialLib
@@ -0,0 +1,137 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// The variable besides the temperature a tabulated fluid property depends on.
+enum class TabulationVariable
+{
+    Pressure,
+    Density
+};
+
+/// Regular grid in the plane of the temperature and a second variable on which
+/// a fluid property is tabulated.
+struct TabulationGrid
+{
+    double T_min;
+    double T_max;
+    std::size_t number_of_temperature_points;
+    /// The second variable, which must be the one read by the tabulated
+    /// property, e.g. the density for the IAPWS viscosity.
+    TabulationVariable variable;
+    double x_min;
+    double x_max;
+    std::size_t number_of_x_points;
+};
+
+enum class TabulationInterpolation
+{
+    Bilinear,
+    Bicubic
+};
+
+/// A wrapper of an expensive fluid property model, e.g., of the IAPWS
+/// formulations, which depends on temperature and either pressure or density
+/// only.
+///
+/// On construction the values of the wrapped property and its derivatives with
+/// respect to temperature and the second variable are tabulated on a regular
+/// grid. Inside
+/// of the grid the property is interpolated either
+/// - bilinearly, where the derivatives are interpolated from their own
+///   tables, or
+/// - by bicubic Hermite polynomials built from the values, the first
+///   derivatives and the mixed second derivatives at the grid points; the
+///   derivatives are those of the interpolating polynomial.
+///
+/// Outside of the grid the wrapped property is evaluated directly.
+///
+/// Optionally the table is stored in a binary file and read from it on later
+/// runs with the same property and grid.
+class TabulatedFluidProperty final : public FluidProperty
+{
+public:
+    /// \param property  the tabulated property.
+    /// \param grid  the grid of the table.
+    /// \param interpolation  the interpolation method.
+    /// \param file_name  if not empty, the table is read from this file if it
+    ///                   matches the property and the grid, otherwise the
+    ///                   table is computed and written to this file.
+    TabulatedFluidProperty(std::unique_ptr<FluidProperty>&& property,
+                           TabulationGrid const& grid,
+                           TabulationInterpolation const interpolation,
+                           std::string const& file_name);
+
+    std::string getName() const override
+    {
+        return "Tabulated " + _property->getName();
+    }
+
+    double getValue(const ArrayType& var_vals) const override;
+
+    double getdValue(const ArrayType& var_vals,
+                     const PropertyVariableType var) const override;
+
+    /// Returns the maximum relative error of the interpolated values compared
+    /// to the wrapped property at the cell centres of the grid.
+    double estimateMaximumRelativeError() const;
+
+private:
+    /// Value and derivatives with respect to temperature and the second
+    /// variable.
+    using Interpolant = std::array<double, 3>;
+
+    bool isInside(double const T, double const x) const;
+
+    Interpolant interpolate(double const T, double const x) const;
+    Interpolant interpolateBilinear(std::size_t const i, std::size_t const j,
+                                    double const t, double const s) const;
+    Interpolant interpolateBicubic(std::size_t const i, std::size_t const j,
+                                   double const t, double const s) const;
+
+    std::size_t index(std::size_t const i, std::size_t const j) const
+    {
+        return i * _grid.number_of_x_points + j;
+    }
+
+    void tabulate();
+    bool readTable(std::string const& file_name);
+    void writeTable(std::string const& file_name) const;
+
+    std::unique_ptr<FluidProperty> const _property;
+    TabulationGrid const _grid;
+    TabulationInterpolation const _interpolation;
+    /// Index of the second variable in the property's variable array.
+    int const _x_index;
+    double const _dT;
+    double const _dx;
+
+    /// Values and derivatives at the grid points. The point with the
+    /// temperature index i and the second variable's index j is stored at
+    /// index().
+    std::vector<double> _values;
+    std::vector<double> _dvalues_dT;
+    std::vector<double> _dvalues_dx;
+    std::vector<double> _d2values_dTdx;
+};
+
+}  // namespace Fluid
+}  // namespace MaterialLib
@@ -16,6 +16,7 @@
 #include "BaseLib/Error.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 #include "LinearPressureDependentViscosity.h"
 #include "TemperatureDependentViscosity.h"
 #include "VogelsLiquidDynamicViscosity.h"
@@ -140,7 +141,17 @@ std::unique_ptr<FluidProperty> createViscosityModel(
     {
         //! \ogs_file_param{material__fluid__viscosity__type}
         config.checkConfigParameter("type", "WaterViscosityIAPWS");
-        return std::make_unique<WaterViscosityIAPWS>();
+        auto viscosity = std::make_unique<WaterViscosityIAPWS>();
+        if (auto const tabulation_config =
+                //! \ogs_file_param{material__fluid__viscosity__WaterViscosityIAPWS__tabulation}
+            config.getConfigSubtreeOptional("tabulation"))
+        {
+            // The IAPWS viscosity depends on temperature and density.
+            return createTabulatedFluidProperty(*tabulation_config,
+                                                std::move(viscosity),
+                                                TabulationVariable::Density);
+        }
+        return viscosity;
     }
 
     OGS_FATAL(
@@ -110,6 +110,7 @@ struct StateVariables
     void setInitialConditions() { damage = damage_prev; }
 
     void pushBackState() override { damage_prev = damage; }
+    void popState() override { damage = damage_prev; }
 
     double damage;  ///< damage part of the state.
 
@@ -36,6 +36,10 @@ public:
         virtual ~MaterialStateVariables() = default;
         virtual void pushBackState() = 0;
 
+        /// Resets the current state to the state stored by the last
+        /// pushBackState() call, e.g. after a rejected time step.
+        virtual void popState() = 0;
+
         void reset()
         {
             _is_tensile_stress = false;
@@ -46,6 +46,7 @@ public:
         : public FractureModelBase<DisplacementDim>::MaterialStateVariables
     {
         void pushBackState() override {}
+        void popState() override {}
     };
 
     std::unique_ptr<
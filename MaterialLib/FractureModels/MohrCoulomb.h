@@ -61,6 +61,7 @@ public:
         : public FractureModelBase<DisplacementDim>::MaterialStateVariables
     {
         void pushBackState() override {}
+        void popState() override {}
     };
 
     std::unique_ptr<
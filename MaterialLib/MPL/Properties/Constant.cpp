@@ -21,5 +21,11 @@ Constant::Constant(PropertyDataType const& v)
     _dvalue = boost::apply_visitor(
         [](auto const& value) -> PropertyDataType { return decltype(value){}; },
         v);
+
+    if (auto const* const scalar = boost::get<double>(&_value))
+    {
+        _scalar_kind = ScalarKind::Constant;
+        _scalar.value = *scalar;
+    }
 };
 }  // namespace MaterialPropertyLib
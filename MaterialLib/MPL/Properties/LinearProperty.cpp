@@ -18,6 +18,19 @@ LinearProperty::LinearProperty(PropertyDataType const& property_reference_value,
     : _independent_variable(v)
 {
     _value = property_reference_value;
+
+    auto const* const value = boost::get<double>(&_value);
+    auto const* const slope = boost::get<double>(&v.slope);
+    auto const* const reference_value =
+        boost::get<double>(&v.reference_condition);
+    if (value && slope && reference_value)
+    {
+        _scalar_kind = ScalarKind::Linear;
+        _scalar.value = *value;
+        _scalar.slope = *slope;
+        _scalar.reference_value = *reference_value;
+        _scalar.variable = v.type;
+    }
 }
 
 PropertyDataType LinearProperty::value(
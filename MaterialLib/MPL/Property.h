@@ -12,9 +12,11 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <boost/variant.hpp>
 #include <string>
+#include <vector>
 
 #include "PropertyType.h"
 #include "VariableType.h"
@@ -88,10 +90,92 @@ public:
         return boost::get<T>(d2Value(variable_array, variable1, variable2));
     }
 
+    /// Typed fast path of value<double>(variable_array). For constant and
+    /// linear scalar properties the value is computed inline without virtual
+    /// calls and without constructing a PropertyDataType. For all other
+    /// properties it falls back to the virtual value() method.
+    double scalarValue(VariableArray const& variable_array) const
+    {
+        switch (_scalar_kind)
+        {
+            case ScalarKind::Constant:
+                return _scalar.value;
+            case ScalarKind::Linear:
+                return _scalar.value *
+                       (1 + _scalar.slope *
+                                (boost::get<double>(variable_array[static_cast<
+                                     int>(_scalar.variable)]) -
+                                 _scalar.reference_value));
+            case ScalarKind::Generic:
+                break;
+        }
+        return boost::get<double>(value(variable_array));
+    }
+
+    /// Typed fast path of dValue<double>(variable_array, variable), see
+    /// scalarValue().
+    double dScalarValue(VariableArray const& variable_array,
+                        Variable const variable) const
+    {
+        switch (_scalar_kind)
+        {
+            case ScalarKind::Constant:
+                return 0;
+            case ScalarKind::Linear:
+                return variable == _scalar.variable
+                           ? _scalar.value * _scalar.slope
+                           : 0;
+            case ScalarKind::Generic:
+                break;
+        }
+        return boost::get<double>(dValue(variable_array, variable));
+    }
+
+    /// Evaluates a scalar property for many variable arrays, e.g., for all
+    /// integration points of an element, and stores the results in \c values.
+    void scalarValues(std::vector<VariableArray> const& variable_arrays,
+                      std::vector<double>& values) const
+    {
+        values.resize(variable_arrays.size());
+        if (_scalar_kind == ScalarKind::Constant)
+        {
+            std::fill(values.begin(), values.end(), _scalar.value);
+            return;
+        }
+        for (std::size_t i = 0; i < variable_arrays.size(); ++i)
+        {
+            values[i] = scalarValue(variable_arrays[i]);
+        }
+    }
+
 protected:
+    /// Kinds of scalar properties with an inline evaluation in scalarValue()
+    /// and dScalarValue().
+    enum class ScalarKind
+    {
+        Generic,
+        Constant,
+        Linear
+    };
+
+    /// Parameters of constant and linear scalar properties. A linear property
+    /// is computed as value * (1 + slope * (x - reference_value)), where x is
+    /// the given variable.
+    struct ScalarRepresentation
+    {
+        double value = 0;
+        double slope = 0;
+        double reference_value = 0;
+        Variable variable = Variable::number_of_variables;
+    };
+
     /// The single value of a property.
     PropertyDataType _value;
     PropertyDataType _dvalue;
+
+    /// Set by derived classes supporting the inline scalar evaluation.
+    ScalarKind _scalar_kind = ScalarKind::Generic;
+    ScalarRepresentation _scalar;
 };
 
 /// This method returns the 0-based index of the variant data types. Can be
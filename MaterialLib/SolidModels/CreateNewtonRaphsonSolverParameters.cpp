@@ -38,6 +38,26 @@ NumLib::NewtonRaphsonSolverParameters createNewtonRaphsonSolverParameters(
 
     DBUG("\terror_tolerance: %g.", error_tolerance);
 
-    return {maximum_iterations, error_tolerance};
+    auto const linear_solver =
+        //! \ogs_file_param{material__solid__constitutive_relation__nonlinear_solver__linear_solver}
+        nonlinear_solver_config.getConfigParameter<std::string>("linear_solver",
+                                                                "FullPivLU");
+
+    DBUG("\tlinear_solver: %s.", linear_solver.c_str());
+
+    if (linear_solver == "FullPivLU")
+    {
+        return {maximum_iterations, error_tolerance,
+                NumLib::LocalLinearSolverType::FullPivLU};
+    }
+    if (linear_solver == "PartialPivLU")
+    {
+        return {maximum_iterations, error_tolerance,
+                NumLib::LocalLinearSolverType::PartialPivLU};
+    }
+    OGS_FATAL(
+        "Unknown local linear solver '%s'. Use 'FullPivLU' or "
+        "'PartialPivLU'.",
+        linear_solver.c_str());
 }
 }  // namespace MaterialLib
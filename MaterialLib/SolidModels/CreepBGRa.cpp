@@ -41,11 +41,29 @@ CreepBGRa<DisplacementDim>::integrateStress(
     /*material_state_variables*/,
     double const T) const
 {
-    using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
+    // The model has no internal state.
+    auto state = createMaterialStateVariables();
+    KelvinVector sigma;
+    KelvinMatrix C;
+    if (!integrateStressInPlace(t, x, dt, eps_prev, eps, sigma_prev, *state, T,
+                                sigma, C))
+    {
+        return {};
+    }
 
-    Eigen::FullPivLU<Eigen::Matrix<double, KelvinVectorSize, KelvinVectorSize,
-                                   Eigen::RowMajor>>
-        linear_solver;
+    return {std::make_tuple(sigma, std::move(state), C)};
+}
+
+template <int DisplacementDim>
+bool CreepBGRa<DisplacementDim>::integrateStressInPlace(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev,
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
+    /*material_state_variables*/,
+    double const T, KelvinVector& sigma, KelvinMatrix& C_tangent) const
+{
+    using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
 
     const auto C = this->getElasticTensor(t, x, T);
     KelvinVector sigma_try = sigma_prev + C * (eps - eps_prev);
@@ -57,7 +75,9 @@ CreepBGRa<DisplacementDim>::integrateStress(
     // In case |s_{try}| is zero and _n < 3 (rare case).
     if (norm_s_try < std::numeric_limits<double>::epsilon() * C(0, 0))
     {
-        return {std::make_tuple(sigma_try, createMaterialStateVariables(), C)};
+        sigma = sigma_try;
+        C_tangent = C;
+        return true;
     }
 
     ResidualVectorType solution = sigma_try;
@@ -106,30 +126,45 @@ CreepBGRa<DisplacementDim>::integrateStress(
         solution += increment;
     };
 
-    auto newton_solver =
-        NumLib::NewtonRaphson<decltype(linear_solver), JacobianMatrix,
-                              decltype(update_jacobian), ResidualVectorType,
-                              decltype(update_residual),
-                              decltype(update_solution)>(
-            linear_solver, update_jacobian, update_residual, update_solution,
-            _nonlinear_solver_parameters);
-
-    JacobianMatrix jacobian;
-    auto const success_iterations = newton_solver.solve(jacobian);
+    auto const integrate =
+        [&](auto& linear_solver) -> boost::optional<KelvinMatrix> {
+        auto newton_solver =
+            NumLib::NewtonRaphson<decltype(linear_solver), JacobianMatrix,
+                                  decltype(update_jacobian), ResidualVectorType,
+                                  decltype(update_residual),
+                                  decltype(update_solution)>(
+                linear_solver, update_jacobian, update_residual,
+                update_solution, _nonlinear_solver_parameters);
+
+        JacobianMatrix jacobian;
+        auto const success_iterations = newton_solver.solve(jacobian);
+
+        if (!success_iterations)
+        {
+            return {};
+        }
+
+        // If *success_iterations>0, tangentStiffness = J_(sigma)^{-1}C
+        // where J_(sigma) is the Jacobian of the last local Newton-Raphson
+        // iteration, which is already LU decomposed.
+        if (*success_iterations == 0)
+        {
+            return KelvinMatrix{C};
+        }
+        return KelvinMatrix{linear_solver.solve(C)};
+    };
 
-    if (!success_iterations)
+    auto const tangentStiffness =
+        NumLib::invokeWithLocalLinearSolver<JacobianMatrix>(
+            _nonlinear_solver_parameters.linear_solver_type, integrate);
+    if (!tangentStiffness)
     {
-        return {};
+        return false;
     }
 
-    // If *success_iterations>0, tangentStiffness = J_(sigma)^{-1}C
-    // where J_(sigma) is the Jacobian of the last local Newton-Raphson
-    // iteration, which is already LU decomposed.
-    KelvinMatrix tangentStiffness =
-        (*success_iterations == 0) ? C : linear_solver.solve(C);
-
-    return {std::make_tuple(solution, createMaterialStateVariables(),
-                            tangentStiffness)};
+    sigma = solution;
+    C_tangent = *tangentStiffness;
+    return true;
 }
 
 template <int DisplacementDim>
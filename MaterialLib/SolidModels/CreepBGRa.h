@@ -86,6 +86,14 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x, double const dt,
+        KelvinVector const& eps_prev, KelvinVector const& eps,
+        KelvinVector const& sigma_prev,
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
+            material_state_variables,
+        double const T, KelvinVector& sigma, KelvinMatrix& C) const override;
+
     ConstitutiveModel getConstitutiveModel() const override
     {
         return ConstitutiveModel::CreepBGRa;
@@ -521,6 +521,60 @@ SolidEhlers<DisplacementDim>::integrateStress(
     StateVariables<DisplacementDim> state =
         static_cast<StateVariables<DisplacementDim> const&>(
             material_state_variables);
+
+    auto const solution =
+        integrateStressImpl(t, x, dt, eps_prev, eps, sigma_prev, state);
+    if (!solution)
+    {
+        return {};
+    }
+
+    return {std::make_tuple(
+        std::get<0>(*solution),
+        std::unique_ptr<
+            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
+            new StateVariables<DisplacementDim>{state}},
+        std::get<1>(*solution))};
+}
+
+template <int DisplacementDim>
+bool SolidEhlers<DisplacementDim>::integrateStressInPlace(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev,
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
+        material_state_variables,
+    double const /*T*/, KelvinVector& sigma, KelvinMatrix& C) const
+{
+    assert(dynamic_cast<StateVariables<DisplacementDim> const*>(
+               &material_state_variables) != nullptr);
+
+    auto& stored_state =
+        static_cast<StateVariables<DisplacementDim>&>(material_state_variables);
+    // The stored state is only overwritten on success.
+    StateVariables<DisplacementDim> state = stored_state;
+
+    auto const solution =
+        integrateStressImpl(t, x, dt, eps_prev, eps, sigma_prev, state);
+    if (!solution)
+    {
+        return false;
+    }
+
+    std::tie(sigma, C) = *solution;
+    stored_state = state;
+    return true;
+}
+
+template <int DisplacementDim>
+boost::optional<std::tuple<typename SolidEhlers<DisplacementDim>::KelvinVector,
+                           typename SolidEhlers<DisplacementDim>::KelvinMatrix>>
+SolidEhlers<DisplacementDim>::integrateStressImpl(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev,
+    StateVariables<DisplacementDim>& state) const
+{
     state.setInitialConditions();
 
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
@@ -554,142 +608,149 @@ SolidEhlers<DisplacementDim>::integrateStress(
     }
     else
     {
+        using JacobianMatrix =
+            Eigen::Matrix<double, JacobianResidualSize, JacobianResidualSize,
+                          Eigen::RowMajor>;
+
         // Linear solver for the newton loop is required after the loop with the
         // same matrix. This saves one decomposition.
-        Eigen::FullPivLU<Eigen::Matrix<double, JacobianResidualSize,
-                                       JacobianResidualSize, Eigen::RowMajor>>
-            linear_solver;
-
-        {
-            static int const KelvinVectorSize =
-                MathLib::KelvinVector::KelvinVectorDimensions<
-                    DisplacementDim>::value;
-            using KelvinVector =
-                MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
-            using ResidualVectorType =
-                Eigen::Matrix<double, JacobianResidualSize, 1>;
-            using JacobianMatrix =
-                Eigen::Matrix<double, JacobianResidualSize,
-                              JacobianResidualSize, Eigen::RowMajor>;
-
-            JacobianMatrix jacobian;
-
-            // Agglomerated solution vector construction.  It is later split
-            // into individual parts by splitSolutionVector().
-            ResidualVectorType solution;
-            solution << sigma, state.eps_p.D, state.eps_p.V, state.eps_p.eff, 0;
-
-            auto const update_residual = [&](ResidualVectorType& residual) {
-
-                auto const& eps_p_D =
-                    solution.template segment<KelvinVectorSize>(
-                        KelvinVectorSize);
-                KelvinVector const eps_p_D_dot =
-                    (eps_p_D - state.eps_p_prev.D) / dt;
-
-                double const& eps_p_V = solution[KelvinVectorSize * 2];
-                double const eps_p_V_dot =
-                    (eps_p_V - state.eps_p_prev.V) / dt;
-
-                double const& eps_p_eff = solution[KelvinVectorSize * 2 + 1];
-                double const eps_p_eff_dot =
-                    (eps_p_eff - state.eps_p_prev.eff) / dt;
-
-                double const k_hardening = calculateIsotropicHardening(
-                    mp.kappa, mp.hardening_coefficient,
-                    solution[KelvinVectorSize * 2 + 1]);
-                residual = calculatePlasticResidual<DisplacementDim>(
-                    eps_D, eps_V, s,
-                    solution.template segment<KelvinVectorSize>(
-                        KelvinVectorSize),
-                    eps_p_D_dot, solution[KelvinVectorSize * 2], eps_p_V_dot,
-                    eps_p_eff_dot, solution[KelvinVectorSize * 2 + 2],
-                    k_hardening, mp);
-            };
-
-            auto const update_jacobian = [&](JacobianMatrix& jacobian) {
-                jacobian = calculatePlasticJacobian<DisplacementDim>(
-                    dt, s, solution[KelvinVectorSize * 2 + 2], mp);
-            };
-
-            auto const update_solution =
-                [&](ResidualVectorType const& increment) {
-                    solution += increment;
-                    s = PhysicalStressWithInvariants<DisplacementDim>{
-                        mp.G * solution.template segment<KelvinVectorSize>(0)};
+        auto const integrate_plastic = [&](auto& linear_solver) {
+            {
+                static int const KelvinVectorSize =
+                    MathLib::KelvinVector::KelvinVectorDimensions<
+                        DisplacementDim>::value;
+                using KelvinVector =
+                    MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
+                using ResidualVectorType =
+                    Eigen::Matrix<double, JacobianResidualSize, 1>;
+                JacobianMatrix jacobian;
+
+                // Agglomerated solution vector construction.  It is later split
+                // into individual parts by splitSolutionVector().
+                ResidualVectorType solution;
+                solution << sigma, state.eps_p.D, state.eps_p.V,
+                    state.eps_p.eff, 0;
+
+                auto const update_residual = [&](ResidualVectorType& residual) {
+
+                    auto const& eps_p_D =
+                        solution.template segment<KelvinVectorSize>(
+                            KelvinVectorSize);
+                    KelvinVector const eps_p_D_dot =
+                        (eps_p_D - state.eps_p_prev.D) / dt;
+
+                    double const& eps_p_V = solution[KelvinVectorSize * 2];
+                    double const eps_p_V_dot =
+                        (eps_p_V - state.eps_p_prev.V) / dt;
+
+                    double const& eps_p_eff =
+                        solution[KelvinVectorSize * 2 + 1];
+                    double const eps_p_eff_dot =
+                        (eps_p_eff - state.eps_p_prev.eff) / dt;
+
+                    double const k_hardening = calculateIsotropicHardening(
+                        mp.kappa, mp.hardening_coefficient,
+                        solution[KelvinVectorSize * 2 + 1]);
+                    residual = calculatePlasticResidual<DisplacementDim>(
+                        eps_D, eps_V, s,
+                        solution.template segment<KelvinVectorSize>(
+                            KelvinVectorSize),
+                        eps_p_D_dot, solution[KelvinVectorSize * 2],
+                        eps_p_V_dot, eps_p_eff_dot,
+                        solution[KelvinVectorSize * 2 + 2], k_hardening, mp);
                 };
 
-            auto newton_solver = NumLib::NewtonRaphson<
-                decltype(linear_solver), JacobianMatrix,
-                decltype(update_jacobian), ResidualVectorType,
-                decltype(update_residual), decltype(update_solution)>(
-                linear_solver, update_jacobian, update_residual,
-                update_solution, _nonlinear_solver_parameters);
+                auto const update_jacobian = [&](JacobianMatrix& jacobian) {
+                    jacobian = calculatePlasticJacobian<DisplacementDim>(
+                        dt, s, solution[KelvinVectorSize * 2 + 2], mp);
+                };
 
-            auto const success_iterations = newton_solver.solve(jacobian);
+                auto const update_solution =
+                    [&](ResidualVectorType const& increment) {
+                        solution += increment;
+                        s = PhysicalStressWithInvariants<DisplacementDim>{
+                            mp.G *
+                            solution.template segment<KelvinVectorSize>(0)};
+                    };
+
+                auto newton_solver = NumLib::NewtonRaphson<
+                    decltype(linear_solver), JacobianMatrix,
+                    decltype(update_jacobian), ResidualVectorType,
+                    decltype(update_residual), decltype(update_solution)>(
+                    linear_solver, update_jacobian, update_residual,
+                    update_solution, _nonlinear_solver_parameters);
+
+                auto const success_iterations = newton_solver.solve(jacobian);
+
+                if (!success_iterations)
+                {
+                    return false;
+                }
+
+                // If the Newton loop didn't run, the linear solver will not be
+                // initialized.
+                // This happens usually for the first iteration of the first
+                // timestep.
+                if (*success_iterations == 0)
+                {
+                    linear_solver.compute(jacobian);
+                }
+
+                std::tie(sigma, state.eps_p, std::ignore) =
+                    splitSolutionVector<ResidualVectorType, KelvinVector>(
+                        solution);
+            }
 
-            if (!success_iterations)
+            // Calculate residual derivative w.r.t. strain
+            Eigen::Matrix<double, JacobianResidualSize, KelvinVectorSize,
+                          Eigen::RowMajor>
+                dresidual_deps =
+                    Eigen::Matrix<double, JacobianResidualSize,
+                                  KelvinVectorSize, Eigen::RowMajor>::Zero();
+            dresidual_deps
+                .template block<KelvinVectorSize, KelvinVectorSize>(0, 0)
+                .noalias() =
+                calculateDResidualDEps<DisplacementDim>(mp.K, mp.G);
+
+            if (_tangent_type == TangentType::Elastic)
             {
-                return {};
+                tangentStiffness =
+                    elasticTangentStiffness<DisplacementDim>(mp.K, mp.G);
             }
-
-            // If the Newton loop didn't run, the linear solver will not be
-            // initialized.
-            // This happens usually for the first iteration of the first
-            // timestep.
-            if (*success_iterations == 0)
+            else if (_tangent_type == TangentType::Plastic ||
+                     _tangent_type == TangentType::PlasticDamageSecant)
             {
-                linear_solver.compute(jacobian);
+                tangentStiffness =
+                    mp.G *
+                    linear_solver.solve(-dresidual_deps)
+                        .template block<KelvinVectorSize, KelvinVectorSize>(0,
+                                                                            0);
+                if (_tangent_type == TangentType::PlasticDamageSecant)
+                {
+                    tangentStiffness *= 1 - state.damage.value();
+                }
             }
-
-            std::tie(sigma, state.eps_p, std::ignore) =
-                splitSolutionVector<ResidualVectorType, KelvinVector>(solution);
-        }
-
-        // Calculate residual derivative w.r.t. strain
-        Eigen::Matrix<double, JacobianResidualSize, KelvinVectorSize,
-                      Eigen::RowMajor>
-            dresidual_deps =
-                Eigen::Matrix<double, JacobianResidualSize, KelvinVectorSize,
-                              Eigen::RowMajor>::Zero();
-        dresidual_deps.template block<KelvinVectorSize, KelvinVectorSize>(0, 0)
-            .noalias() = calculateDResidualDEps<DisplacementDim>(mp.K, mp.G);
-
-        if (_tangent_type == TangentType::Elastic)
-        {
-            tangentStiffness =
-                elasticTangentStiffness<DisplacementDim>(mp.K, mp.G);
-        }
-        else if (_tangent_type == TangentType::Plastic ||
-                 _tangent_type == TangentType::PlasticDamageSecant)
-        {
-            tangentStiffness =
-                mp.G *
-                linear_solver.solve(-dresidual_deps)
-                    .template block<KelvinVectorSize, KelvinVectorSize>(0, 0);
-            if (_tangent_type == TangentType::PlasticDamageSecant)
+            else
             {
-                tangentStiffness *= 1 - state.damage.value();
+                OGS_FATAL(
+                    "Unimplemented tangent type behaviour for the tangent type "
+                    "'%d'.",
+                    _tangent_type);
             }
-        }
-        else
+            return true;
+        };
+
+        if (!NumLib::invokeWithLocalLinearSolver<JacobianMatrix>(
+                _nonlinear_solver_parameters.linear_solver_type,
+                integrate_plastic))
         {
-            OGS_FATAL(
-                "Unimplemented tangent type behaviour for the tangent type "
-                "'%d'.",
-                _tangent_type);
+            return {};
         }
     }
 
     KelvinVector sigma_final = mp.G * sigma;
 
-    return {std::make_tuple(
-        sigma_final,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new StateVariables<DisplacementDim>{
-                static_cast<StateVariables<DisplacementDim> const&>(state)}},
-        tangentStiffness)};
+    return {std::make_tuple(sigma_final, tangentStiffness)};
 }
 
 template <int DisplacementDim>
@@ -23,6 +23,7 @@
 #endif
 
 #include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
 #include "MathLib/KelvinVector.h"
 #include "NumLib/NewtonRaphson.h"
 #include "ParameterLib/Parameter.h"
@@ -242,6 +243,39 @@ struct StateVariables
         damage_prev = damage;
     }
 
+    void popState() override { setInitialConditions(); }
+
+    void serialize(std::ostream& out) const override
+    {
+        for (auto const* p : {&eps_p, &eps_p_prev})
+        {
+            BaseLib::writeValuesBinary(out, p->D.data(), p->D.size());
+            BaseLib::writeValueBinary(out, p->V);
+            BaseLib::writeValueBinary(out, p->eff);
+        }
+        for (auto const* d : {&damage, &damage_prev})
+        {
+            BaseLib::writeValueBinary(out, d->kappa_d());
+            BaseLib::writeValueBinary(out, d->value());
+        }
+    }
+
+    void deserialize(std::istream& in) override
+    {
+        for (auto* p : {&eps_p, &eps_p_prev})
+        {
+            BaseLib::readBinaryValues(in, p->D.data(), p->D.size());
+            p->V = BaseLib::readBinaryValue<double>(in);
+            p->eff = BaseLib::readBinaryValue<double>(in);
+        }
+        for (auto* d : {&damage, &damage_prev})
+        {
+            auto const kappa_d = BaseLib::readBinaryValue<double>(in);
+            auto const value = BaseLib::readBinaryValue<double>(in);
+            *d = Damage{kappa_d, value};
+        }
+    }
+
     using KelvinVector =
         MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
 
@@ -330,6 +364,14 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x, double const dt,
+        KelvinVector const& eps_prev, KelvinVector const& eps,
+        KelvinVector const& sigma_prev,
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
+            material_state_variables,
+        double const T, KelvinVector& sigma, KelvinMatrix& C) const override;
+
     std::vector<typename MechanicsBase<DisplacementDim>::InternalVariable>
     getInternalVariables() const override;
 
@@ -346,6 +388,14 @@ public:
     }
 
 private:
+    /// Common part of integrateStress() and integrateStressInPlace(). Updates
+    /// the given state and returns the stress and the tangent.
+    boost::optional<std::tuple<KelvinVector, KelvinMatrix>> integrateStressImpl(
+        double const t, ParameterLib::SpatialPosition const& x, double const dt,
+        KelvinVector const& eps_prev, KelvinVector const& eps,
+        KelvinVector const& sigma_prev,
+        StateVariables<DisplacementDim>& state) const;
+
     NumLib::NewtonRaphsonSolverParameters const _nonlinear_solver_parameters;
 
     MaterialPropertiesParameters _mp;
@@ -63,6 +63,9 @@ public:
         : public MechanicsBase<DisplacementDim>::MaterialStateVariables
     {
         void pushBackState() override {}
+        void popState() override {}
+        void serialize(std::ostream& /*out*/) const override {}
+        void deserialize(std::istream& /*in*/) override {}
         MaterialStateVariables& operator=(MaterialStateVariables const&) =
             default;
         typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
@@ -120,6 +123,19 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const /*dt*/, KelvinVector const& eps_prev,
+        KelvinVector const& eps, KelvinVector const& sigma_prev,
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
+        /*material_state_variables*/,
+        double const T, KelvinVector& sigma, KelvinMatrix& C) const override
+    {
+        C = getElasticTensor(t, x, T);
+        sigma = sigma_prev + C * (eps - eps_prev);
+        return true;
+    }
+
     KelvinMatrix getElasticTensor(double const t,
                                   ParameterLib::SpatialPosition const& x,
                                   double const T) const;
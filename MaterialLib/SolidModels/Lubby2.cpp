@@ -80,12 +80,61 @@ Lubby2<DisplacementDim>::integrateStress(
         material_state_variables,
     double const /*T*/) const
 {
-    using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
-
     assert(dynamic_cast<MaterialStateVariables const*>(
                &material_state_variables) != nullptr);
     MaterialStateVariables state(
         static_cast<MaterialStateVariables const&>(material_state_variables));
+
+    auto const solution = integrateStressImpl(t, x, dt, eps, state);
+    if (!solution)
+    {
+        return {};
+    }
+
+    return {std::make_tuple(
+        std::get<0>(*solution),
+        std::unique_ptr<
+            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
+            new MaterialStateVariables{state}},
+        std::get<1>(*solution))};
+}
+
+template <int DisplacementDim>
+bool Lubby2<DisplacementDim>::integrateStressInPlace(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& /*eps_prev*/, KelvinVector const& eps,
+    KelvinVector const& /*sigma_prev*/,
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
+        material_state_variables,
+    double const /*T*/, KelvinVector& sigma, KelvinMatrix& C) const
+{
+    assert(dynamic_cast<MaterialStateVariables const*>(
+               &material_state_variables) != nullptr);
+    auto& stored_state =
+        static_cast<MaterialStateVariables&>(material_state_variables);
+    // The stored state is only overwritten on success.
+    MaterialStateVariables state(stored_state);
+
+    auto const solution = integrateStressImpl(t, x, dt, eps, state);
+    if (!solution)
+    {
+        return false;
+    }
+
+    std::tie(sigma, C) = *solution;
+    stored_state = state;
+    return true;
+}
+
+template <int DisplacementDim>
+boost::optional<std::tuple<typename Lubby2<DisplacementDim>::KelvinVector,
+                           typename Lubby2<DisplacementDim>::KelvinMatrix>>
+Lubby2<DisplacementDim>::integrateStressImpl(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps, MaterialStateVariables& state) const
+{
+    using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
+
     state.setInitialConditions();
 
     auto local_lubby2_properties =
@@ -106,23 +155,14 @@ Lubby2<DisplacementDim>::integrateStress(
         Eigen::Matrix<double, KelvinVectorSize * 3, KelvinVectorSize * 3,
                       Eigen::RowMajor>;
 
-    // Linear solver for the newton loop is required after the loop with the
-    // same matrix. This saves one decomposition.
-    Eigen::FullPivLU<LocalJacobianMatrix> linear_solver;
-
-    // Different solvers are available for the solution of the local system.
-    // TODO Make the following choice of linear solvers available from the
-    // input file configuration:
-    //      K_loc.partialPivLu().solve(-res_loc);
-    //      K_loc.fullPivLu().solve(-res_loc);
-    //      K_loc.householderQr().solve(-res_loc);
-    //      K_loc.colPivHouseholderQr().solve(res_loc);
-    //      K_loc.fullPivHouseholderQr().solve(-res_loc);
-    //      K_loc.llt().solve(-res_loc);
-    //      K_loc.ldlt().solve(-res_loc);
-
-    LocalJacobianMatrix K_loc;
-    {  // Local Newton solver
+    // The local linear system is solved by the decomposition selected in the
+    // nonlinear solver parameters. The linear solver for the newton loop is
+    // required after the loop with the same matrix. This saves one
+    // decomposition.
+    KelvinMatrix C;
+    auto const integrate = [&](auto& linear_solver) {
+        // Local Newton solver
+        LocalJacobianMatrix K_loc;
         using LocalResidualVector =
             Eigen::Matrix<double, KelvinVectorSize * 3, 1>;
 
@@ -166,7 +206,7 @@ Lubby2<DisplacementDim>::integrateStress(
 
         if (!success_iterations)
         {
-            return {};
+            return false;
         }
 
         // If the Newton loop didn't run, the linear solver will not be
@@ -176,24 +216,25 @@ Lubby2<DisplacementDim>::integrateStress(
         {
             linear_solver.compute(K_loc);
         }
-    }
 
-    KelvinMatrix C =
-        tangentStiffnessA<DisplacementDim>(local_lubby2_properties.GM0,
-                                           local_lubby2_properties.KM0,
-                                           linear_solver);
+        C = tangentStiffnessA<DisplacementDim>(local_lubby2_properties.GM0,
+                                               local_lubby2_properties.KM0,
+                                               linear_solver);
+        return true;
+    };
+
+    if (!NumLib::invokeWithLocalLinearSolver<LocalJacobianMatrix>(
+            _nonlinear_solver_parameters.linear_solver_type, integrate))
+    {
+        return {};
+    }
 
     // Hydrostatic part for the stress and the tangent.
     double const eps_i_trace = Invariants::trace(eps);
     KelvinVector const sigma =
         local_lubby2_properties.GM0 * sigd_j +
         local_lubby2_properties.KM0 * eps_i_trace * Invariants::identity2;
-    return {std::make_tuple(
-        sigma,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new MaterialStateVariables{state}},
-        C)};
+    return {std::make_tuple(sigma, C)};
 }
 
 template <int DisplacementDim>
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "BaseLib/FileTools.h"
 #include "MathLib/KelvinVector.h"
 #include "NumLib/NewtonRaphson.h"
 #include "ParameterLib/Parameter.h"
@@ -139,6 +140,24 @@ public:
             eps_M_t = eps_M_j;
         }
 
+        void popState() override { setInitialConditions(); }
+
+        void serialize(std::ostream& out) const override
+        {
+            for (auto const* eps : {&eps_K_t, &eps_K_j, &eps_M_t, &eps_M_j})
+            {
+                BaseLib::writeValuesBinary(out, eps->data(), eps->size());
+            }
+        }
+
+        void deserialize(std::istream& in) override
+        {
+            for (auto* eps : {&eps_K_t, &eps_K_j, &eps_M_t, &eps_M_j})
+            {
+                BaseLib::readBinaryValues(in, eps->data(), eps->size());
+            }
+        }
+
         using KelvinVector =
             MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
         using KelvinMatrix =
@@ -231,7 +250,21 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x, double const dt,
+        KelvinVector const& eps_prev, KelvinVector const& eps,
+        KelvinVector const& sigma_prev,
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
+            material_state_variables,
+        double const T, KelvinVector& sigma, KelvinMatrix& C) const override;
+
 private:
+    /// Common part of integrateStress() and integrateStressInPlace(). Updates
+    /// the given state and returns the stress and the tangent.
+    boost::optional<std::tuple<KelvinVector, KelvinMatrix>> integrateStressImpl(
+        double const t, ParameterLib::SpatialPosition const& x, double const dt,
+        KelvinVector const& eps, MaterialStateVariables& state) const;
+
     /// Calculates the 18x1 residual vector.
     void calculateResidualBurgers(
         double const dt,
@@ -9,6 +9,8 @@
 
 #include "MFront.h"
 
+#include <algorithm>
+
 #include <MGIS/Behaviour/Integrate.hxx>
 
 namespace
@@ -242,7 +244,7 @@ MFront<DisplacementDim>::integrateStress(
     double const dt,
     KelvinVector const& /*eps_prev*/,
     KelvinVector const& eps,
-    KelvinVector const& /*sigma_prev*/,
+    KelvinVector const& sigma_prev,
     typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
         material_state_variables,
     double const T) const
@@ -277,6 +279,12 @@ MFront<DisplacementDim>::integrateStress(
 
     auto v = mgis::behaviour::make_view(d);
 
+    // The stress at the beginning of the time step, e.g. the initial stress
+    // in the first time step.
+    auto const sigma_prev_MFront = OGSToMFront(sigma_prev);
+    std::copy_n(sigma_prev_MFront.data(), KelvinVector::SizeAtCompileTime,
+                d.s0.thermodynamic_forces.begin());
+
     auto const eps_MFront = OGSToMFront(eps);
     for (auto i = 0; i < KelvinVector::SizeAtCompileTime; ++i)
     {
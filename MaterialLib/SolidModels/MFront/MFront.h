@@ -14,6 +14,7 @@
 #include <MGIS/Behaviour/Behaviour.hxx>
 #include <MGIS/Behaviour/BehaviourData.hxx>
 
+#include "BaseLib/FileTools.h"
 #include "ParameterLib/Parameter.h"
 
 namespace MaterialLib
@@ -51,6 +52,43 @@ public:
         MaterialStateVariables(MaterialStateVariables const&) = default;
 
         void pushBackState() override { mgis::behaviour::update(_data); }
+        void popState() override { mgis::behaviour::revert(_data); }
+
+        void serialize(std::ostream& out) const override
+        {
+            for (auto const* s : {&_data.s0, &_data.s1})
+            {
+                for (auto const* values :
+                     {&s->gradients, &s->thermodynamic_forces,
+                      &s->internal_state_variables})
+                {
+                    BaseLib::writeVectorBinary(out, *values);
+                }
+                BaseLib::writeValueBinary(out, s->stored_energy);
+                BaseLib::writeValueBinary(out, s->dissipated_energy);
+            }
+        }
+
+        void deserialize(std::istream& in) override
+        {
+            for (auto* s : {&_data.s0, &_data.s1})
+            {
+                for (auto* values : {&s->gradients, &s->thermodynamic_forces,
+                                     &s->internal_state_variables})
+                {
+                    auto const read = BaseLib::readBinaryVector<double>(in);
+                    if (in && read.size() != values->size())
+                    {
+                        OGS_FATAL(
+                            "The MFront state read from the checkpoint does "
+                            "not match the behaviour.");
+                    }
+                    *values = read;
+                }
+                s->stored_energy = BaseLib::readBinaryValue<double>(in);
+                s->dissipated_energy = BaseLib::readBinaryValue<double>(in);
+            }
+        }
 
         MaterialStateVariables& operator=(MaterialStateVariables const&) =
             default;
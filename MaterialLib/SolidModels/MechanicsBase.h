@@ -11,6 +11,7 @@
 
 #include <boost/optional.hpp>
 #include <functional>
+#include <iosfwd>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -61,6 +62,17 @@ struct MechanicsBase
             MaterialStateVariables const&) = default;
 
         virtual void pushBackState() = 0;
+
+        /// Resets the current state to the state stored by the last
+        /// pushBackState() call, e.g. after a rejected time step.
+        virtual void popState() = 0;
+
+        /// Writes the complete state including the state of the previous
+        /// time step as binary into the given stream, e.g. for a checkpoint.
+        virtual void serialize(std::ostream& out) const = 0;
+
+        /// Restores the state written by serialize().
+        virtual void deserialize(std::istream& in) = 0;
     };
 
     /// Polymorphic creator for MaterialStateVariables objects specific for a
@@ -119,6 +131,39 @@ struct MechanicsBase
                     MaterialStateVariables const& material_state_variables,
                     double const T) const = 0;
 
+    /// In-place variant of integrateStress(), which avoids the allocation of
+    /// a new state object per call. On success the computed stress and
+    /// tangent are written to \c sigma and \c C and the given material state
+    /// variables are overwritten by the updated state. On failure false is
+    /// returned and the material state variables are unchanged.
+    ///
+    /// The default implementation calls integrateStress() and copies the
+    /// returned state.
+    virtual bool integrateStressInPlace(
+        double const t,
+        ParameterLib::SpatialPosition const& x,
+        double const dt,
+        KelvinVector const& eps_prev,
+        KelvinVector const& eps,
+        KelvinVector const& sigma_prev,
+        MaterialStateVariables& material_state_variables,
+        double const T,
+        KelvinVector& sigma,
+        KelvinMatrix& C) const
+    {
+        auto solution = integrateStress(t, x, dt, eps_prev, eps, sigma_prev,
+                                        material_state_variables, T);
+        if (!solution)
+        {
+            return false;
+        }
+
+        std::unique_ptr<MaterialStateVariables> state;
+        std::tie(sigma, state, C) = std::move(*solution);
+        material_state_variables = *state;
+        return true;
+    }
+
     /// Helper type for providing access to internal variables.
     struct InternalVariable
     {
@@ -9,6 +9,10 @@
 
 #include "EigenLinearSolver.h"
 
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_MKL
@@ -22,6 +26,7 @@
 #endif
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/RunTime.h"
 #include "EigenVector.h"
 #include "EigenMatrix.h"
 #include "EigenTools.h"
@@ -42,10 +47,60 @@ public:
 
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
     virtual bool solve(Matrix &A, Vector const& b, Vector &x, EigenOption &opt) = 0;
+
+    EigenLinearSolverStatistics const& getStatistics() const
+    {
+        return _statistics;
+    }
+
+protected:
+    EigenLinearSolverStatistics _statistics;
 };
 
 namespace details
 {
+/// Keeps a copy of the sparsity pattern of the last solved matrix in order to
+/// detect if the pattern analysis of a solver can be reused.
+class SparsityPatternTracker final
+{
+public:
+    using Matrix = EigenLinearSolverBase::Matrix;
+
+    /// Stores the sparsity pattern of the compressed matrix \c A and returns
+    /// whether it differs from the previously stored one.
+    bool update(Matrix const& A)
+    {
+        assert(A.isCompressed());
+        auto const* const outer = A.outerIndexPtr();
+        auto const* const inner = A.innerIndexPtr();
+        auto const n_outer = static_cast<std::size_t>(A.outerSize()) + 1;
+        auto const n_inner = static_cast<std::size_t>(A.nonZeros());
+
+        if (_outer_indices.size() == n_outer &&
+            _inner_indices.size() == n_inner &&
+            std::equal(_outer_indices.begin(), _outer_indices.end(), outer) &&
+            std::equal(_inner_indices.begin(), _inner_indices.end(), inner))
+        {
+            return false;
+        }
+
+        _outer_indices.assign(outer, outer + n_outer);
+        _inner_indices.assign(inner, inner + n_inner);
+        return true;
+    }
+
+    /// Forgets the stored pattern, such that the next update() reports a
+    /// change.
+    void reset()
+    {
+        _outer_indices.clear();
+        _inner_indices.clear();
+    }
+
+private:
+    std::vector<Matrix::StorageIndex> _outer_indices;
+    std::vector<Matrix::StorageIndex> _inner_indices;
+};
 
 /// Template class for Eigen direct linear solvers
 template <class T_SOLVER>
@@ -56,16 +111,32 @@ public:
     {
         INFO("-> solve with %s",
              EigenOption::getSolverName(opt.solver_type).c_str());
+        _statistics.number_of_solves++;
         if (!A.isCompressed())
         {
             A.makeCompressed();
         }
 
-        _solver.compute(A);
+        BaseLib::RunTime time_factorization;
+        time_factorization.start();
+
+        bool const analyze_pattern =
+            !opt.reuse_pattern_analysis || _sparsity_pattern.update(A);
+        if (analyze_pattern)
+        {
+            _solver.analyzePattern(A);
+            _statistics.number_of_pattern_analyses++;
+        }
+        _solver.factorize(A);
+        _statistics.number_of_factorizations++;
         if(_solver.info()!=Eigen::Success) {
+            _sparsity_pattern.reset();
             ERR("Failed during Eigen linear solver initialization");
             return false;
         }
+        INFO("[time] Factorization took %g s (pattern analysis %s).",
+             time_factorization.elapsed(),
+             analyze_pattern ? "computed" : "reused");
 
         x = _solver.solve(b);
         if(_solver.info()!=Eigen::Success) {
@@ -78,6 +149,7 @@ public:
 
 private:
     T_SOLVER _solver;
+    SparsityPatternTracker _sparsity_pattern;
 };
 
 /// Template class for Eigen iterative linear solvers
@@ -92,22 +164,50 @@ public:
              EigenOption::getPreconName(opt.precon_type).c_str());
         _solver.setTolerance(opt.error_tolerance);
         _solver.setMaxIterations(opt.max_iterations);
+        _statistics.number_of_solves++;
 
         if (!A.isCompressed())
         {
             A.makeCompressed();
         }
 
-        _solver.compute(A);
-        if(_solver.info()!=Eigen::Success) {
-            ERR("Failed during Eigen linear solver initialization");
-            return false;
+        bool const pattern_changed =
+            !opt.reuse_pattern_analysis || _sparsity_pattern.update(A);
+        if (pattern_changed || !canReusePreconditioner(opt))
+        {
+            if (!setUpPreconditioner(A, pattern_changed))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            _solver.setMatrix(A);
+            _number_of_precon_reuses++;
+            INFO("[time] Preconditioner setup skipped (reuse %d of %d).",
+                 _number_of_precon_reuses, opt.precon_reuse_count);
         }
 
-        x = _solver.solveWithGuess(b, x);
+        Vector const x0 = x;
+        x = _solver.solveWithGuess(b, x0);
+        if (_solver.info() != Eigen::Success && _number_of_precon_reuses > 0)
+        {
+            INFO("-> solve with reused preconditioner failed, retrying.");
+            if (!setUpPreconditioner(A, false))
+            {
+                return false;
+            }
+            x = _solver.solveWithGuess(b, x0);
+        }
         INFO("\t iteration: %d/%ld", _solver.iterations(), opt.max_iterations);
         INFO("\t residual: %e\n", _solver.error());
 
+        _last_iterations = _solver.iterations();
+        if (_number_of_precon_reuses == 0)
+        {
+            _reference_iterations = _last_iterations;
+        }
+
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solve");
             return false;
@@ -117,7 +217,53 @@ public:
     }
 
 private:
-    T_SOLVER _solver;
+    /// Allows to exchange the matrix without recomputing the preconditioner.
+    class Solver final : public T_SOLVER
+    {
+    public:
+        void setMatrix(Matrix const& A) { this->grab(A); }
+    };
+
+    bool canReusePreconditioner(EigenOption const& opt) const
+    {
+        return _number_of_precon_reuses < opt.precon_reuse_count &&
+               _last_iterations <=
+                   opt.precon_reuse_iteration_factor *
+                       std::max<Eigen::Index>(_reference_iterations, 1);
+    }
+
+    bool setUpPreconditioner(Matrix const& A, bool const analyze_pattern)
+    {
+        BaseLib::RunTime time_precon;
+        time_precon.start();
+
+        if (analyze_pattern)
+        {
+            _solver.analyzePattern(A);
+            _statistics.number_of_pattern_analyses++;
+        }
+        _solver.factorize(A);
+        _statistics.number_of_factorizations++;
+        _number_of_precon_reuses = 0;
+        if(_solver.info()!=Eigen::Success) {
+            _sparsity_pattern.reset();
+            ERR("Failed during Eigen linear solver initialization");
+            return false;
+        }
+        INFO("[time] Preconditioner setup took %g s (pattern analysis %s).",
+             time_precon.elapsed(), analyze_pattern ? "computed" : "reused");
+        return true;
+    }
+
+    Solver _solver;
+    SparsityPatternTracker _sparsity_pattern;
+
+    /// Number of solves the current preconditioner has been reused for.
+    int _number_of_precon_reuses = 0;
+    /// Iterations of the first solve with the current preconditioner.
+    Eigen::Index _reference_iterations = 0;
+    /// Iterations of the last solve.
+    Eigen::Index _last_iterations = 0;
 };
 
 template <template <typename, typename> class Solver, typename Precon>
@@ -253,6 +399,27 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             ptSolver->getConfigParameterOptional<int>("max_iteration_step")) {
         _option.max_iterations = *max_iteration_step;
     }
+    if (auto reuse_pattern_analysis =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__reuse_pattern_analysis}
+            ptSolver->getConfigParameterOptional<bool>(
+                "reuse_pattern_analysis")) {
+        _option.reuse_pattern_analysis = *reuse_pattern_analysis;
+    }
+    if (auto precon_reuse_count =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__precon_reuse_count}
+            ptSolver->getConfigParameterOptional<int>("precon_reuse_count")) {
+        if (*precon_reuse_count < 0)
+        {
+            OGS_FATAL("The precon_reuse_count must not be negative.");
+        }
+        _option.precon_reuse_count = *precon_reuse_count;
+    }
+    if (auto precon_reuse_iteration_factor =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__precon_reuse_iteration_factor}
+            ptSolver->getConfigParameterOptional<double>(
+                "precon_reuse_iteration_factor")) {
+        _option.precon_reuse_iteration_factor = *precon_reuse_iteration_factor;
+    }
     if (auto scaling =
             //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             ptSolver->getConfigParameterOptional<bool>("scaling")) {
@@ -296,4 +463,9 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
     return success;
 }
 
+EigenLinearSolverStatistics const& EigenLinearSolver::getStatistics() const
+{
+    return _solver->getStatistics();
+}
+
 }  // namespace MathLib
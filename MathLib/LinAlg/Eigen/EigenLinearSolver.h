@@ -22,6 +22,18 @@ class EigenVector;
 
 class EigenLinearSolverBase;
 
+/// Counts of the setup steps of EigenLinearSolver::solve(), which show if the
+/// pattern analysis and the preconditioner have been reused.
+struct EigenLinearSolverStatistics
+{
+    int number_of_solves = 0;
+    /// Number of symbolic analyses of the sparsity pattern.
+    int number_of_pattern_analyses = 0;
+    /// Number of numerical factorizations, for iterative solvers the number
+    /// of preconditioner setups.
+    int number_of_factorizations = 0;
+};
+
 class EigenLinearSolver final
 {
 public:
@@ -55,6 +67,9 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Returns the counts of the setup steps of all solve() calls so far.
+    EigenLinearSolverStatistics const& getStatistics() const;
+
 protected:
     EigenOption _option;
     std::unique_ptr<EigenLinearSolverBase> _solver;
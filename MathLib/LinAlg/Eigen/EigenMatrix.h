@@ -9,8 +9,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <Eigen/Sparse>
 
@@ -32,6 +36,20 @@ public:
     using RawMatrixType = Eigen::SparseMatrix<double, Eigen::RowMajor>;
     using IndexType = RawMatrixType::Index;
 
+    /// Positions of the entries of local matrices in the value array of the
+    /// compressed matrix, cf. cacheLocalMatrixOffsets().
+    struct LocalMatrixOffsets
+    {
+        /// Beginning of each item's row-major offsets in \c offsets. Contains
+        /// an additional last entry marking the end.
+        std::vector<std::size_t> item_begin;
+        std::vector<RawMatrixType::StorageIndex> offsets;
+
+        /// The sparsity pattern the offsets have been computed for.
+        std::vector<RawMatrixType::StorageIndex> outer_indices;
+        std::vector<RawMatrixType::StorageIndex> inner_indices;
+    };
+
     // TODO The matrix constructor should take num_rows and num_cols as arguments
     //      that is left for a later refactoring.
     /**
@@ -122,6 +140,40 @@ public:
             std::vector<IndexType> const& col_pos, const T_DENSE_MATRIX &sub_matrix,
             double fkt = 1.0);
 
+    /// Adds the sub-matrix of the item \c item_id at the positions stored in
+    /// the given \c offsets table. All entries must exist already, hence no
+    /// search in the sparse rows is necessary.
+    /// \see cacheLocalMatrixOffsets().
+    template <class T_DENSE_MATRIX>
+    void add(LocalMatrixOffsets const& offsets, std::size_t const item_id,
+             T_DENSE_MATRIX const& sub_matrix, double fkt = 1.0);
+
+    /// Computes and stores for the given \c key the positions of the local
+    /// matrix entries of \c number_of_items items in the value array of this
+    /// matrix. The key identifies where the indices come from, e.g. a DOF
+    /// table.
+    /// Missing entries are inserted and the matrix is compressed. An already
+    /// stored table is kept as long as the sparsity pattern did not change.
+    /// For matrices without any entries, e.g., before the first assembly,
+    /// nothing is stored to avoid allocating matrices which are never used.
+    ///
+    /// \param key             identifier of the table.
+    /// \param number_of_items number of items, e.g., mesh elements.
+    /// \param get_indices     returns the global row and column indices of an
+    ///                        item given its id.
+    template <typename GetIndices>
+    void cacheLocalMatrixOffsets(void const* const key,
+                                 std::size_t const number_of_items,
+                                 GetIndices const& get_indices);
+
+    /// Returns the table stored for the given \c key or nullptr if there is
+    /// none.
+    LocalMatrixOffsets const* findLocalMatrixOffsets(void const* const key) const
+    {
+        auto const it = _local_matrix_offsets.find(key);
+        return it == _local_matrix_offsets.end() ? nullptr : it->second.get();
+    }
+
     /// get value. This function returns zero if the element doesn't exist.
     double get(IndexType row, IndexType col) const
     {
@@ -176,6 +228,15 @@ public:
 
 protected:
     RawMatrixType _mat;
+
+private:
+    /// Checks if the matrix is compressed and its sparsity pattern equals the
+    /// one stored in the \c offsets table.
+    bool hasSparsityPatternOf(LocalMatrixOffsets const& offsets) const;
+
+    /// The tables are shared by copies of this matrix.
+    std::map<void const*, std::shared_ptr<LocalMatrixOffsets const>>
+        _local_matrix_offsets;
 };
 
 template <class T_DENSE_MATRIX>
@@ -194,6 +255,105 @@ void EigenMatrix::add(std::vector<IndexType> const& row_pos,
     }
 };
 
+template <class T_DENSE_MATRIX>
+void EigenMatrix::add(LocalMatrixOffsets const& offsets,
+                      std::size_t const item_id,
+                      T_DENSE_MATRIX const& sub_matrix, double fkt)
+{
+    auto const n_rows = sub_matrix.rows();
+    auto const n_cols = sub_matrix.cols();
+    auto const* const item_offsets =
+        offsets.offsets.data() + offsets.item_begin[item_id];
+    assert(offsets.item_begin[item_id + 1] - offsets.item_begin[item_id] ==
+           static_cast<std::size_t>(n_rows * n_cols));
+
+    double* const values = _mat.valuePtr();
+    for (IndexType i = 0; i < n_rows; i++)
+    {
+        auto const* const row_offsets = item_offsets + i * n_cols;
+        for (IndexType j = 0; j < n_cols; j++)
+        {
+            values[row_offsets[j]] += fkt * sub_matrix(i, j);
+        }
+    }
+}
+
+template <typename GetIndices>
+void EigenMatrix::cacheLocalMatrixOffsets(void const* const key,
+                                          std::size_t const number_of_items,
+                                          GetIndices const& get_indices)
+{
+    if (_mat.nonZeros() == 0)
+    {
+        _local_matrix_offsets.erase(key);
+        return;
+    }
+
+    auto const it = _local_matrix_offsets.find(key);
+    if (it != _local_matrix_offsets.end() && hasSparsityPatternOf(*it->second))
+    {
+        return;
+    }
+
+    // Insert all entries of the local matrices. Existing entries are kept.
+    for (std::size_t item_id = 0; item_id < number_of_items; item_id++)
+    {
+        auto const indices = get_indices(item_id);
+        for (auto const row : indices)
+        {
+            for (auto const col : indices)
+            {
+                _mat.coeffRef(row, col);
+            }
+        }
+    }
+    _mat.makeCompressed();
+
+    auto const* const outer = _mat.outerIndexPtr();
+    auto const* const inner = _mat.innerIndexPtr();
+
+    auto table = std::make_shared<LocalMatrixOffsets>();
+    table->item_begin.reserve(number_of_items + 1);
+    table->item_begin.push_back(0);
+    for (std::size_t item_id = 0; item_id < number_of_items; item_id++)
+    {
+        auto const indices = get_indices(item_id);
+        for (auto const row : indices)
+        {
+            auto const* const row_begin = inner + outer[row];
+            auto const* const row_end = inner + outer[row + 1];
+            for (auto const col : indices)
+            {
+                auto const* const entry =
+                    std::lower_bound(row_begin, row_end, col);
+                assert(entry != row_end && *entry == col);
+                table->offsets.push_back(
+                    static_cast<RawMatrixType::StorageIndex>(entry - inner));
+            }
+        }
+        table->item_begin.push_back(table->offsets.size());
+    }
+    table->outer_indices.assign(outer, outer + _mat.outerSize() + 1);
+    table->inner_indices.assign(inner, inner + _mat.nonZeros());
+
+    _local_matrix_offsets[key] = std::move(table);
+}
+
+inline bool EigenMatrix::hasSparsityPatternOf(
+    LocalMatrixOffsets const& offsets) const
+{
+    if (!_mat.isCompressed() ||
+        offsets.inner_indices.size() !=
+            static_cast<std::size_t>(_mat.nonZeros()))
+    {
+        return false;
+    }
+    return std::equal(offsets.outer_indices.begin(),
+                      offsets.outer_indices.end(), _mat.outerIndexPtr()) &&
+           std::equal(offsets.inner_indices.begin(),
+                      offsets.inner_indices.end(), _mat.innerIndexPtr());
+}
+
 /// Sets the sparsity pattern of the underlying EigenMatrix.
 template <typename SPARSITY_PATTERN>
 struct SetMatrixSparsity<EigenMatrix, SPARSITY_PATTERN>
@@ -19,6 +19,9 @@ EigenOption::EigenOption()
     precon_type = PreconType::NONE;
     max_iterations = static_cast<int>(1e6);
     error_tolerance = 1.e-16;
+    reuse_pattern_analysis = true;
+    precon_reuse_count = 0;
+    precon_reuse_iteration_factor = 2.0;
 #ifdef USE_EIGEN_UNSUPPORTED
     scaling = false;
 #endif
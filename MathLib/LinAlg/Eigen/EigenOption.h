@@ -43,6 +43,16 @@ struct EigenOption final
     int max_iterations;
     /// Error tolerance
     double error_tolerance;
+    /// Reuse the analysis of the sparsity pattern, e.g., the fill-reducing
+    /// ordering, as long as the sparsity pattern does not change.
+    bool reuse_pattern_analysis;
+    /// Number of subsequent solves an iterative solver's preconditioner is
+    /// reused for without being recomputed. Zero disables the reuse.
+    int precon_reuse_count;
+    /// A reused preconditioner is recomputed as soon as the iteration count
+    /// exceeds this factor times the iteration count of the first solve with
+    /// that preconditioner.
+    double precon_reuse_iteration_factor;
 #ifdef USE_EIGEN_UNSUPPORTED
     /// Scaling the coefficient matrix and the RHS bector
     bool scaling;
@@ -9,6 +9,8 @@
 
 #include "LinAlg.h"
 
+#include "BaseLib/FileTools.h"
+
 // TODO reorder LinAlg function signatures?
 
 // Global PETScMatrix/PETScVector //////////////////////////////////////////
@@ -167,6 +169,37 @@ void finalizeAssembly(PETScVector& x)
     x.finalizeAssembly();
 }
 
+void writeBinary(std::ostream& out, PETScVector const& x)
+{
+    setLocalAccessibleVector(x);
+    std::vector<double> local_x;
+    local_x.reserve(x.getLocalSize());
+    for (PetscInt i = x.getRangeBegin(); i < x.getRangeEnd(); ++i)
+    {
+        local_x.push_back(x.get(i));
+    }
+    BaseLib::writeValueBinary(out, static_cast<std::uint64_t>(x.size()));
+    BaseLib::writeVectorBinary(out, local_x);
+}
+
+void readBinary(std::istream& in, PETScVector& x)
+{
+    auto const global_size = BaseLib::readBinaryValue<std::uint64_t>(in);
+    auto const local_x = BaseLib::readBinaryVector<double>(in);
+    if (!in || global_size != static_cast<std::uint64_t>(x.size()) ||
+        local_x.size() != static_cast<std::size_t>(x.getLocalSize()))
+    {
+        OGS_FATAL(
+            "Could not read a vector of global size %d and local size %d.",
+            static_cast<int>(x.size()), static_cast<int>(x.getLocalSize()));
+    }
+    for (PetscInt i = x.getRangeBegin(); i < x.getRangeEnd(); ++i)
+    {
+        x.set(i, local_x[i - x.getRangeBegin()]);
+    }
+    finalizeAssembly(x);
+}
+
 }} // namespaces
 
 
@@ -310,6 +343,31 @@ void finalizeAssembly(EigenMatrix& x)
 
 void finalizeAssembly(EigenVector& /*x*/) {}
 
+void writeBinary(std::ostream& out, EigenVector const& x)
+{
+    auto const& raw = x.getRawVector();
+    BaseLib::writeValueBinary(out, static_cast<std::uint64_t>(raw.size()));
+    out.write(reinterpret_cast<const char*>(raw.data()),
+              sizeof(double) * raw.size());
+}
+
+void readBinary(std::istream& in, EigenVector& x)
+{
+    auto& raw = x.getRawVector();
+    auto const size = BaseLib::readBinaryValue<std::uint64_t>(in);
+    if (!in || size != static_cast<std::uint64_t>(raw.size()))
+    {
+        OGS_FATAL("Could not read a vector of size %zu.",
+                  static_cast<std::size_t>(raw.size()));
+    }
+    in.read(reinterpret_cast<char*>(raw.data()), sizeof(double) * raw.size());
+    if (!in)
+    {
+        OGS_FATAL("Could not read a vector of size %zu.",
+                  static_cast<std::size_t>(raw.size()));
+    }
+}
+
 } // namespace LinAlg
 
 } // namespace MathLib
@@ -10,6 +10,8 @@
 #pragma once
 
 #include <cassert>
+#include <iosfwd>
+
 #include "BaseLib/Error.h"
 #include "LinAlgEnums.h"
 
@@ -191,6 +193,13 @@ void matMultAdd(PETScMatrix const& A, PETScVector const& v1,
 void finalizeAssembly(PETScMatrix& A);
 void finalizeAssembly(PETScVector& x);
 
+/// Writes the locally owned entries of \c x in binary form to \c out.
+void writeBinary(std::ostream& out, PETScVector const& x);
+
+/// Reads the entries written by writeBinary() into \c x, which must have the
+/// same global size and parallel distribution as the written vector.
+void readBinary(std::istream& in, PETScVector& x);
+
 }} // namespaces
 
 
@@ -259,6 +268,13 @@ void matMultAdd(EigenMatrix const& A, EigenVector const& v1,
 void finalizeAssembly(EigenMatrix& A);
 void finalizeAssembly(EigenVector& A);
 
+/// Writes the locally owned entries of \c x in binary form to \c out.
+void writeBinary(std::ostream& out, EigenVector const& x);
+
+/// Reads the entries written by writeBinary() into \c x, which must have the
+/// same global size and parallel distribution as the written vector.
+void readBinary(std::istream& in, EigenVector& x);
+
 } // namespace LinAlg
 
 } // namespace MathLib
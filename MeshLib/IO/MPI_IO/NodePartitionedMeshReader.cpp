@@ -15,16 +15,27 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_PETSC
 #include <mpi.h>
 #endif
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "BaseLib/FileTools.h"
 #include "BaseLib/RunTime.h"
 
 #include "MeshLib/Elements/Elements.h"
+#include "MeshLib/IO/MPI_IO/PartitionedMeshFileFormat.h"
 #include "MeshLib/Properties.h"
 
 // Check if the value can by converted to given type without overflow.
@@ -41,6 +52,269 @@ is_safely_convertable(VALUE const& value)
     return result;
 }
 
+namespace
+{
+namespace Format = MeshLib::IO::PartitionedMeshFileFormat;
+
+/// Read-only view on a byte range of a file. On POSIX systems the range is
+/// memory mapped, such that only the pages actually accessed are read, and
+/// otherwise the range is read into a buffer.
+class FileRegion
+{
+public:
+    FileRegion(std::string const& file_name, std::uint64_t const offset,
+               std::uint64_t const size)
+        : _size(size)
+    {
+#ifndef _WIN32
+        int const fd = ::open(file_name.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            OGS_FATAL("Could not open file '%s'.", file_name.c_str());
+        }
+        // The mapping must start at a page boundary.
+        auto const page_size =
+            static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+        std::uint64_t const mapping_offset = offset / page_size * page_size;
+        _mapping_size = size + (offset - mapping_offset);
+        _mapping = ::mmap(nullptr, _mapping_size, PROT_READ, MAP_PRIVATE, fd,
+                          static_cast<off_t>(mapping_offset));
+        ::close(fd);
+        if (_mapping == MAP_FAILED)
+        {
+            OGS_FATAL("Could not map %d bytes of file '%s' into memory.", size,
+                      file_name.c_str());
+        }
+        ::madvise(_mapping, _mapping_size, MADV_SEQUENTIAL);
+        _data = static_cast<char const*>(_mapping) + (offset - mapping_offset);
+#else
+        std::ifstream is(file_name, std::ios::binary);
+        _buffer.resize(size);
+        if (!is.seekg(offset) || !is.read(_buffer.data(), size))
+        {
+            OGS_FATAL("Could not read %d bytes from file '%s'.", size,
+                      file_name.c_str());
+        }
+        _data = _buffer.data();
+#endif
+    }
+
+    FileRegion(FileRegion const&) = delete;
+    FileRegion& operator=(FileRegion const&) = delete;
+
+    ~FileRegion()
+    {
+#ifndef _WIN32
+        ::munmap(_mapping, _mapping_size);
+#endif
+    }
+
+    /// Returns a pointer to the section of \c count values of type \c T
+    /// starting at \c position and advances the position to the next section.
+    template <typename T>
+    T const* section(std::uint64_t& position, std::uint64_t const count) const
+    {
+        auto const* const p = reinterpret_cast<T const*>(_data + position);
+        position += Format::paddedSize(count * sizeof(T));
+        if (position > _size)
+        {
+            OGS_FATAL(
+                "The partition data is corrupted: A section ends at position "
+                "%d after the data block's end at %d.",
+                position, _size);
+        }
+        return p;
+    }
+
+private:
+    char const* _data = nullptr;
+    std::uint64_t const _size;
+#ifndef _WIN32
+    void* _mapping = nullptr;
+    std::uint64_t _mapping_size = 0;
+#else
+    std::vector<char> _buffer;
+#endif
+};
+
+template <typename ElementType>
+MeshLib::Element* createElement(std::uint64_t const* const node_ids,
+                                std::uint64_t const number_of_nodes,
+                                std::vector<MeshLib::Node*> const& nodes,
+                                std::size_t const id)
+{
+    if (number_of_nodes != ElementType::n_all_nodes)
+    {
+        OGS_FATAL(
+            "Element %d has %d nodes, but its cell type requires %d nodes.", id,
+            number_of_nodes, ElementType::n_all_nodes);
+    }
+    auto** const element_nodes = new MeshLib::Node*[ElementType::n_all_nodes];
+    for (unsigned i = 0; i < ElementType::n_all_nodes; ++i)
+    {
+        if (node_ids[i] >= nodes.size())
+        {
+            OGS_FATAL("Element %d refers to the non-existing node %d.", id,
+                      node_ids[i]);
+        }
+        element_nodes[i] = nodes[node_ids[i]];
+    }
+    return new ElementType(element_nodes, id);
+}
+
+MeshLib::Element* createElement(MeshLib::CellType const cell_type,
+                                std::uint64_t const* const node_ids,
+                                std::uint64_t const number_of_nodes,
+                                std::vector<MeshLib::Node*> const& nodes,
+                                std::size_t const id)
+{
+    switch (cell_type)
+    {
+        case MeshLib::CellType::POINT1:
+            return createElement<MeshLib::Point>(node_ids, number_of_nodes,
+                                                 nodes, id);
+        case MeshLib::CellType::LINE2:
+            return createElement<MeshLib::Line>(node_ids, number_of_nodes,
+                                                nodes, id);
+        case MeshLib::CellType::LINE3:
+            return createElement<MeshLib::Line3>(node_ids, number_of_nodes,
+                                                 nodes, id);
+        case MeshLib::CellType::TRI3:
+            return createElement<MeshLib::Tri>(node_ids, number_of_nodes,
+                                               nodes, id);
+        case MeshLib::CellType::TRI6:
+            return createElement<MeshLib::Tri6>(node_ids, number_of_nodes,
+                                                nodes, id);
+        case MeshLib::CellType::QUAD4:
+            return createElement<MeshLib::Quad>(node_ids, number_of_nodes,
+                                                nodes, id);
+        case MeshLib::CellType::QUAD8:
+            return createElement<MeshLib::Quad8>(node_ids, number_of_nodes,
+                                                 nodes, id);
+        case MeshLib::CellType::QUAD9:
+            return createElement<MeshLib::Quad9>(node_ids, number_of_nodes,
+                                                 nodes, id);
+        case MeshLib::CellType::TET4:
+            return createElement<MeshLib::Tet>(node_ids, number_of_nodes,
+                                               nodes, id);
+        case MeshLib::CellType::TET10:
+            return createElement<MeshLib::Tet10>(node_ids, number_of_nodes,
+                                                 nodes, id);
+        case MeshLib::CellType::HEX8:
+            return createElement<MeshLib::Hex>(node_ids, number_of_nodes,
+                                               nodes, id);
+        case MeshLib::CellType::HEX20:
+            return createElement<MeshLib::Hex20>(node_ids, number_of_nodes,
+                                                 nodes, id);
+        case MeshLib::CellType::PRISM6:
+            return createElement<MeshLib::Prism>(node_ids, number_of_nodes,
+                                                 nodes, id);
+        case MeshLib::CellType::PRISM15:
+            return createElement<MeshLib::Prism15>(node_ids, number_of_nodes,
+                                                   nodes, id);
+        case MeshLib::CellType::PYRAMID5:
+            return createElement<MeshLib::Pyramid>(node_ids, number_of_nodes,
+                                                   nodes, id);
+        case MeshLib::CellType::PYRAMID13:
+            return createElement<MeshLib::Pyramid13>(node_ids, number_of_nodes,
+                                                     nodes, id);
+        default:
+            OGS_FATAL(
+                "NodePartitionedMeshReader: construction of element type %d "
+                "is not implemented.",
+                static_cast<int>(cell_type));
+    }
+}
+
+template <typename T>
+void createPropertyVector(Format::PropertyHeader const& header,
+                          std::string const& name, T const* const values,
+                          MeshLib::Properties& properties)
+{
+    auto* const pv = properties.createNewPropertyVector<T>(
+        name, static_cast<MeshLib::MeshItemType>(header.mesh_item_type),
+        header.number_of_components);
+    pv->assign(values,
+               values + header.number_of_tuples * header.number_of_components);
+}
+
+/// Creates the property vector from the values of the data block and returns
+/// the position of the next section.
+std::uint64_t readPropertyVector(FileRegion const& region,
+                                 std::uint64_t position,
+                                 Format::PartitionHeader const& mesh_header,
+                                 MeshLib::Properties& properties)
+{
+    auto const& header = *region.section<Format::PropertyHeader>(position, 1);
+    auto const* const name_data =
+        region.section<char>(position, header.name_length);
+    std::string const name(name_data, header.name_length);
+
+    auto const item_type =
+        static_cast<MeshLib::MeshItemType>(header.mesh_item_type);
+    std::uint64_t const number_of_items =
+        item_type == MeshLib::MeshItemType::Node
+            ? mesh_header.number_of_nodes
+            : item_type == MeshLib::MeshItemType::Cell
+                  ? mesh_header.number_of_regular_elements +
+                        mesh_header.number_of_ghost_elements
+                  : 0;
+    if (header.number_of_tuples != number_of_items)
+    {
+        OGS_FATAL(
+            "The PropertyVector '%s' has %d tuples, but %d are expected for "
+            "its mesh item type.",
+            name.c_str(), header.number_of_tuples, number_of_items);
+    }
+
+    auto const size = header.data_type_size_in_bytes;
+    std::uint64_t const number_of_values =
+        header.number_of_tuples * header.number_of_components;
+    char const* const values = region.section<char>(
+        position, number_of_values * header.data_type_size_in_bytes);
+    auto create = [&](auto type) {
+        using T = decltype(type);
+        createPropertyVector(header, name, reinterpret_cast<T const*>(values),
+                             properties);
+    };
+
+    if (header.is_int_type && header.is_data_type_signed &&
+        size == sizeof(int))
+    {
+        create(int{});
+    }
+    else if (header.is_int_type && header.is_data_type_signed &&
+             size == sizeof(long))
+    {
+        create(long{});
+    }
+    else if (header.is_int_type && !header.is_data_type_signed &&
+             size == sizeof(unsigned))
+    {
+        create(unsigned{});
+    }
+    else if (header.is_int_type && !header.is_data_type_signed &&
+             size == sizeof(unsigned long))
+    {
+        create(static_cast<unsigned long>(0));
+    }
+    else if (!header.is_int_type && size == sizeof(float))
+    {
+        create(float{});
+    }
+    else if (!header.is_int_type && size == sizeof(double))
+    {
+        create(double{});
+    }
+    else
+    {
+        OGS_FATAL("The data type of the PropertyVector '%s' is not supported.",
+                  name.c_str());
+    }
+    return position;
+}
+}  // namespace
+
 namespace MeshLib
 {
 namespace IO
@@ -78,6 +352,21 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::read(
 
     MeshLib::NodePartitionedMesh* mesh = nullptr;
 
+    if (BaseLib::IsFileExisting(
+            PartitionedMeshFileFormat::fileName(file_name_base,
+                                                _mpi_comm_size)))
+    {
+        INFO("Reading single file binary mesh ...");
+
+        mesh = readSingleFileBinary(file_name_base);
+
+        INFO("[time] Reading the mesh took %f s.", timer.elapsed());
+
+        MPI_Barrier(_mpi_comm);
+
+        return mesh;
+    }
+
     // Always try binary file first
     std::string const fname_new = file_name_base + "_partitioned_msh_cfg" +
         std::to_string(_mpi_comm_size) + ".bin";
@@ -196,6 +485,131 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
                    glb_node_ids, mesh_elems, p);
 }
 
+MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readSingleFileBinary(
+    std::string const& file_name_base)
+{
+    std::string const file_name =
+        Format::fileName(file_name_base, _mpi_comm_size);
+
+    Format::PartitionIndexEntry entry;
+    {
+        std::ifstream is(file_name, std::ios::binary);
+        Format::FileHeader header;
+        if (!is.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        {
+            OGS_FATAL("Could not read the header of file '%s'.",
+                      file_name.c_str());
+        }
+        if (!std::equal(std::begin(header.magic), std::end(header.magic),
+                        std::begin(Format::magic)))
+        {
+            OGS_FATAL("The file '%s' is not a partitioned mesh file.",
+                      file_name.c_str());
+        }
+        if (header.byte_order_mark != Format::byte_order_mark)
+        {
+            OGS_FATAL(
+                "The file '%s' was written on a machine with a different byte "
+                "order.",
+                file_name.c_str());
+        }
+        if (header.version != Format::version)
+        {
+            OGS_FATAL(
+                "The file '%s' has version %d, but version %d is expected.",
+                file_name.c_str(), static_cast<int>(header.version),
+                static_cast<int>(Format::version));
+        }
+        if (header.number_of_partitions !=
+            static_cast<std::uint64_t>(_mpi_comm_size))
+        {
+            OGS_FATAL(
+                "The file '%s' contains %d partitions, but there are %d "
+                "processes.",
+                file_name.c_str(),
+                static_cast<int>(header.number_of_partitions), _mpi_comm_size);
+        }
+
+        // Only the index entry of this rank is read.
+        is.seekg(sizeof(Format::FileHeader) +
+                 _mpi_rank * sizeof(Format::PartitionIndexEntry));
+        if (!is.read(reinterpret_cast<char*>(&entry), sizeof(entry)))
+        {
+            OGS_FATAL(
+                "Could not read the index entry of partition %d from file "
+                "'%s'.",
+                _mpi_rank, file_name.c_str());
+        }
+    }
+
+    FileRegion const region(file_name, entry.offset, entry.size);
+    std::uint64_t position = 0;
+
+    auto const& header = *region.section<Format::PartitionHeader>(position, 1);
+    if (Format::meshSectionsSize(header) > entry.size)
+    {
+        OGS_FATAL(
+            "The data block of partition %d in file '%s' is smaller than "
+            "required by its header.",
+            _mpi_rank, file_name.c_str());
+    }
+    _mesh_info.nodes = header.number_of_nodes;
+    _mesh_info.base_nodes = header.number_of_base_nodes;
+    _mesh_info.regular_elements = header.number_of_regular_elements;
+    _mesh_info.ghost_elements = header.number_of_ghost_elements;
+    _mesh_info.active_base_nodes = header.number_of_active_base_nodes;
+    _mesh_info.active_nodes = header.number_of_active_nodes;
+    _mesh_info.global_base_nodes = header.number_of_global_base_nodes;
+    _mesh_info.global_nodes = header.number_of_global_nodes;
+
+    std::uint64_t const number_of_nodes = header.number_of_nodes;
+    std::uint64_t const number_of_elements =
+        header.number_of_regular_elements + header.number_of_ghost_elements;
+
+    auto const* const node_ids =
+        region.section<std::uint64_t>(position, number_of_nodes);
+    auto const* const coordinates =
+        region.section<double>(position, 3 * number_of_nodes);
+    auto const* const element_offsets =
+        region.section<std::uint64_t>(position, number_of_elements + 1);
+    auto const* const cell_types =
+        region.section<std::uint8_t>(position, number_of_elements);
+    auto const* const element_node_ids = region.section<std::uint64_t>(
+        position, header.number_of_element_node_ids);
+
+    std::vector<MeshLib::Node*> mesh_nodes(number_of_nodes);
+    std::vector<unsigned long> glb_node_ids(node_ids,
+                                            node_ids + number_of_nodes);
+    for (std::uint64_t i = 0; i < number_of_nodes; ++i)
+    {
+        mesh_nodes[i] = new MeshLib::Node(coordinates + 3 * i, i);
+    }
+
+    std::vector<MeshLib::Element*> mesh_elems(number_of_elements);
+    for (std::uint64_t i = 0; i < number_of_elements; ++i)
+    {
+        auto const begin = element_offsets[i];
+        auto const end = element_offsets[i + 1];
+        if (begin > end || end > header.number_of_element_node_ids)
+        {
+            OGS_FATAL("The node ids of element %d in file '%s' are corrupted.",
+                      i, file_name.c_str());
+        }
+        mesh_elems[i] =
+            createElement(static_cast<MeshLib::CellType>(cell_types[i]),
+                          element_node_ids + begin, end - begin, mesh_nodes, i);
+    }
+
+    MeshLib::Properties properties;
+    for (std::uint64_t i = 0; i < header.number_of_properties; ++i)
+    {
+        position = readPropertyVector(region, position, header, properties);
+    }
+
+    return newMesh(BaseLib::extractBaseName(file_name_base), mesh_nodes,
+                   glb_node_ids, mesh_elems, properties);
+}
+
 MeshLib::Properties NodePartitionedMeshReader::readPropertiesBinary(
     const std::string& file_name_base) const
 {
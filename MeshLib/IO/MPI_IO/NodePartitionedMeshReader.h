@@ -165,6 +165,24 @@ private:
      */
     MeshLib::NodePartitionedMesh* readBinary(const std::string &file_name_base);
 
+    /*!
+         \brief Create a NodePartitionedMesh object from the single binary file
+                file_name_base+_partitioned_mesh[number of partitions].bin
+                described in PartitionedMeshFileFormat.
+
+                Only the index entry and the data block of the partition of
+                this rank are accessed. The data block is memory mapped and the
+                nodes, elements and properties are created directly from it.
+                An invalid file header, e.g. of another format version, is a
+                fatal error.
+         \param file_name_base  Name of file to be read, which must be a name
+                                with the path to the file and without file
+                                extension.
+         \return                Pointer to Mesh object.
+     */
+    MeshLib::NodePartitionedMesh* readSingleFileBinary(
+        std::string const& file_name_base);
+
     MeshLib::Properties readPropertiesBinary(
         const std::string& file_name_base) const;
 
@@ -0,0 +1,113 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/// \file
+/// Layout of the single file binary format of node-wise partitioned meshes.
+///
+/// The file starts with a FileHeader followed by an index of
+/// FileHeader::number_of_partitions PartitionIndexEntry items, which give the
+/// position and the size of each partition's data block in the file. Each
+/// block is self-contained, such that a process needs to access only its own
+/// block, and consists of the following sections, each padded to a multiple of
+/// eight bytes:
+///  1. PartitionHeader,
+///  2. global node ids, \c uint64_t[number_of_nodes],
+///  3. node coordinates, \c double[3 * number_of_nodes],
+///  4. offsets of the element's node ids in section 6,
+///     \c uint64_t[number_of_elements + 1], the regular elements first,
+///  5. element cell types (MeshLib::CellType), \c uint8_t[number_of_elements],
+///  6. partition local node ids of the elements,
+///     \c uint64_t[number_of_element_node_ids],
+///  7. number_of_properties times a PropertyHeader, the property name
+///     (\c char[name_length]), and the property values of the partition.
+///
+/// All numbers are stored in the byte order of the writing machine, which is
+/// checked by the reader using FileHeader::byte_order_mark.
+namespace MeshLib
+{
+namespace IO
+{
+namespace PartitionedMeshFileFormat
+{
+constexpr char magic[8] = {'O', 'G', 'S', 'P', 'M', 'E', 'S', 'H'};
+constexpr std::uint64_t version = 1;
+constexpr std::uint64_t byte_order_mark = 0x0102030405060708;
+
+struct FileHeader
+{
+    char magic[8];
+    std::uint64_t version;
+    std::uint64_t byte_order_mark;
+    std::uint64_t number_of_partitions;
+};
+
+struct PartitionIndexEntry
+{
+    std::uint64_t offset;  ///< Position of the block from the file begin.
+    std::uint64_t size;    ///< Size of the block in bytes.
+};
+
+struct PartitionHeader
+{
+    std::uint64_t number_of_nodes;
+    std::uint64_t number_of_base_nodes;
+    std::uint64_t number_of_regular_elements;
+    std::uint64_t number_of_ghost_elements;
+    std::uint64_t number_of_active_base_nodes;
+    std::uint64_t number_of_active_nodes;
+    std::uint64_t number_of_global_base_nodes;
+    std::uint64_t number_of_global_nodes;
+    std::uint64_t number_of_element_node_ids;
+    std::uint64_t number_of_properties;
+};
+
+struct PropertyHeader
+{
+    std::uint64_t mesh_item_type;  ///< MeshLib::MeshItemType
+    std::uint64_t is_int_type;
+    std::uint64_t is_data_type_signed;
+    std::uint64_t data_type_size_in_bytes;
+    std::uint64_t number_of_components;
+    std::uint64_t number_of_tuples;
+    std::uint64_t name_length;
+};
+
+/// Size of a section of the given number of bytes including the padding.
+constexpr std::uint64_t paddedSize(std::uint64_t const number_of_bytes)
+{
+    return (number_of_bytes + 7) / 8 * 8;
+}
+
+/// Size of the mesh sections 1 to 6 of a partition block.
+constexpr std::uint64_t meshSectionsSize(PartitionHeader const& h)
+{
+    std::uint64_t const number_of_elements =
+        h.number_of_regular_elements + h.number_of_ghost_elements;
+    return paddedSize(sizeof(PartitionHeader)) +
+           paddedSize(h.number_of_nodes * sizeof(std::uint64_t)) +
+           paddedSize(3 * h.number_of_nodes * sizeof(double)) +
+           paddedSize((number_of_elements + 1) * sizeof(std::uint64_t)) +
+           paddedSize(number_of_elements * sizeof(std::uint8_t)) +
+           paddedSize(h.number_of_element_node_ids * sizeof(std::uint64_t));
+}
+
+inline std::string fileName(std::string const& file_name_base,
+                            std::size_t const number_of_partitions)
+{
+    return file_name_base + "_partitioned_mesh" +
+           std::to_string(number_of_partitions) + ".bin";
+}
+}  // namespace PartitionedMeshFileFormat
+}  // namespace IO
+}  // namespace MeshLib
@@ -33,6 +33,19 @@ public:
     //! Add a VTU file to this PVD file.
     void addVTUFile(std::string const& vtu_fname, double timestep);
 
+    //! Returns the (time, VTU file name) pairs added so far.
+    std::vector<std::pair<double, std::string>> const& getDataSets() const
+    {
+        return _datasets;
+    }
+
+    //! Replaces the (time, VTU file name) pairs, e.g., on a restart. The PVD
+    //! file is rewritten on the next call of addVTUFile().
+    void setDataSets(std::vector<std::pair<double, std::string>> datasets)
+    {
+        _datasets = std::move(datasets);
+    }
+
 private:
     std::string const _pvd_filename;
     std::vector<std::pair<double, std::string>> _datasets; // a vector of (time, VTU file name)
@@ -42,6 +42,10 @@ bool VtuInterface::writeVTU(std::string const& file_name,
 
     vtkNew<MeshLib::VtkMappedMeshSource> vtkSource;
     vtkSource->SetMesh(_mesh);
+    if (_properties)
+    {
+        vtkSource->SetProperties(_properties);
+    }
 
     vtkSmartPointer<UnstructuredGridWriter> vtuWriter =
         vtkSmartPointer<UnstructuredGridWriter>::New();
@@ -19,6 +19,7 @@
 
 namespace MeshLib {
 class Mesh;
+class Properties;
 
 namespace IO
 {
@@ -45,6 +46,13 @@ public:
     /// \return The converted mesh or a nullptr if reading failed
     static MeshLib::Mesh* readVTUFile(std::string const &file_name);
 
+    /// Writes the given properties instead of the mesh's own properties. They
+    /// must match the mesh's nodes and elements.
+    void setProperties(MeshLib::Properties const* properties)
+    {
+        _properties = properties;
+    }
+
     /// Writes the given mesh to file.
     /// \return True on success, false on error
     bool writeToFile(std::string const &file_name);
@@ -60,6 +68,7 @@ public:
 
 private:
     const MeshLib::Mesh* _mesh;
+    MeshLib::Properties const* _properties = nullptr;
     int _data_mode;
     bool _use_compressor;
 };
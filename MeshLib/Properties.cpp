@@ -123,6 +123,10 @@ Properties& Properties::operator=(Properties const& properties)
         return *this;
     }
 
+    for (auto const& name_vector_pair : _properties)
+    {
+        delete name_vector_pair.second;
+    }
     _properties = properties._properties;
     std::vector<std::size_t> exclude_positions;
     for (auto& name_vector_pair : _properties)
@@ -135,6 +139,14 @@ Properties& Properties::operator=(Properties const& properties)
     return *this;
 }
 
+Properties& Properties::operator=(Properties&& properties)
+{
+    // The vectors held before are released by the destructor of the moved
+    // from object.
+    std::swap(_properties, properties._properties);
+    return *this;
+}
+
 Properties::~Properties()
 {
     for (auto name_vector_pair : _properties)
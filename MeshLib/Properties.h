@@ -148,7 +148,7 @@ public:
     Properties(Properties const& properties);
     Properties(Properties&& properties) = default;
     Properties& operator=(Properties const& properties);
-    Properties& operator=(Properties&& properties) = default;
+    Properties& operator=(Properties&& properties);
 
     ~Properties();
 
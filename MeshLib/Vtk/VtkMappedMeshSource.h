@@ -61,6 +61,14 @@ public:
     /// Returns the mesh.
     const MeshLib::Mesh* GetMesh() const { return _mesh; }
 
+    /// Sets properties which are mapped instead of the mesh's own properties.
+    /// They must match the mesh's nodes and elements. Calling is optional.
+    void SetProperties(const MeshLib::Properties* properties)
+    {
+        this->_properties = properties;
+        this->Modified();
+    }
+
 protected:
     VtkMappedMeshSource();
 
@@ -81,6 +89,7 @@ private:
                      std::string const& prop_name) const;
 
     const MeshLib::Mesh* _mesh;
+    const MeshLib::Properties* _properties = nullptr;
 
     int NumberOfDimensions{0};
     int NumberOfNodes{0};
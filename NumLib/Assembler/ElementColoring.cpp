@@ -0,0 +1,70 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ElementColoring.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace NumLib
+{
+std::vector<std::size_t> computeElementColors(MeshLib::Mesh const& mesh)
+{
+    auto const& elements = mesh.getElements();
+    std::vector<std::size_t> colors(elements.size(), no_element_color);
+    colorElements(elements, 0, colors);
+    return colors;
+}
+
+std::size_t colorElements(std::vector<MeshLib::Element*> const& elements,
+                          std::size_t const first_color,
+                          std::vector<std::size_t>& colors)
+{
+    // For each color the id of the element for which the color has been marked
+    // as unavailable last. This avoids resetting the list for each element.
+    std::vector<std::size_t> color_blocked_by;
+
+    for (auto const* const element : elements)
+    {
+        auto const element_id = element->getID();
+
+        for (unsigned n = 0; n < element->getNumberOfNodes(); ++n)
+        {
+            for (auto const* const neighbor :
+                 element->getNode(n)->getElements())
+            {
+                auto const neighbor_color = colors[neighbor->getID()];
+                // Uncolored neighbors and neighbors colored in a previous
+                // call have colors outside of the range used here.
+                if (neighbor_color >= first_color &&
+                    neighbor_color - first_color < color_blocked_by.size())
+                {
+                    color_blocked_by[neighbor_color - first_color] =
+                        element_id;
+                }
+            }
+        }
+
+        std::size_t color = 0;
+        while (color < color_blocked_by.size() &&
+               color_blocked_by[color] == element_id)
+        {
+            ++color;
+        }
+        if (color == color_blocked_by.size())
+        {
+            color_blocked_by.push_back(no_element_color);
+        }
+        colors[element_id] = first_color + color;
+    }
+
+    return first_color + color_blocked_by.size();
+}
+}  // namespace NumLib
@@ -0,0 +1,56 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace MeshLib
+{
+class Element;
+class Mesh;
+}
+
+namespace NumLib
+{
+/// Color of elements not colored yet.
+constexpr std::size_t no_element_color =
+    std::numeric_limits<std::size_t>::max();
+
+/// Colors the elements of the given mesh such that no two elements sharing a
+/// node have the same color.
+///
+/// Since the degrees of freedom are attached to mesh nodes, the local matrices
+/// and vectors of elements of the same color can be added concurrently to the
+/// global matrices and vectors. A greedy coloring is used, i.e., the number of
+/// colors is at most the maximum number of neighbors of an element plus one.
+///
+/// \return The color of each element, indexed by the element id.
+std::vector<std::size_t> computeElementColors(MeshLib::Mesh const& mesh);
+
+/// Colors the given elements like computeElementColors() using the colors
+/// starting from \c first_color.
+///
+/// Only neighbors colored with a color of at least \c first_color are taken
+/// into account. Hence, disjoint groups of elements can be colored one after
+/// another with disjoint ranges of colors, such that all elements of one color
+/// belong to the same group.
+///
+/// \param elements    the elements to be colored.
+/// \param first_color the smallest color to be assigned.
+/// \param colors      the colors of all mesh elements indexed by the element
+///                    id; elements not colored yet have the color
+///                    no_element_color.
+/// \return One past the largest color assigned.
+std::size_t colorElements(std::vector<MeshLib::Element*> const& elements,
+                          std::size_t const first_color,
+                          std::vector<std::size_t>& colors);
+}  // namespace NumLib
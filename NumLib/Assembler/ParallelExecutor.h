@@ -0,0 +1,163 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "SerialExecutor.h"
+
+namespace NumLib
+{
+/// Returns the number of the calling thread within the current parallel
+/// region, or zero if called outside of a parallel region.
+inline int getThreadNumber()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/// Executes member functions for the elements of a container on several
+/// threads.
+///
+/// The container elements are grouped by the element colors passed to the
+/// constructor, cf. computeElementColors(). The groups are processed one after
+/// another, the items within one group concurrently. Hence, the called method
+/// must be safe to be called concurrently for items of the same color, e.g.,
+/// by using per-thread scratch data selected by getThreadNumber().
+///
+/// With a single thread the calls are forwarded to the SerialExecutor.
+class ParallelExecutor
+{
+public:
+    /// Constructs a serial executor.
+    ParallelExecutor() = default;
+
+    /// \param number_of_threads number of threads used for the execution.
+    /// \param item_colors       color of each item, indexed by the item id,
+    ///                          which is the first argument passed to the
+    ///                          method.
+    ParallelExecutor(int const number_of_threads,
+                     std::vector<std::size_t>&& item_colors)
+        : _number_of_threads(number_of_threads),
+          _item_colors(std::move(item_colors))
+    {
+    }
+
+    int getNumberOfThreads() const { return _number_of_threads; }
+
+    /// Parallel version of SerialExecutor::executeMemberDereferenced().
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    void executeMemberDereferenced(Object& object, Method method,
+                                   Container const& container,
+                                   Args&&... args) const
+    {
+        if (_number_of_threads <= 1)
+        {
+            SerialExecutor::executeMemberDereferenced(
+                object, method, container, std::forward<Args>(args)...);
+            return;
+        }
+
+        execute(container.size(), [&](std::size_t const i) {
+            (object.*method)(i, *container[i], args...);
+        });
+    }
+
+    /// Parallel version of SerialExecutor::executeSelectedMemberDereferenced().
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    void executeSelectedMemberDereferenced(
+        Object& object, Method method, Container const& container,
+        std::vector<std::size_t> const& active_container_ids,
+        Args&&... args) const
+    {
+        if (_number_of_threads <= 1)
+        {
+            SerialExecutor::executeSelectedMemberDereferenced(
+                object, method, container, active_container_ids,
+                std::forward<Args>(args)...);
+            return;
+        }
+
+        if (active_container_ids.empty())
+        {
+            executeMemberDereferenced(object, method, container, args...);
+            return;
+        }
+
+        execute(active_container_ids.size(), [&](std::size_t const i) {
+            (object.*method)(i, *container[active_container_ids[i]], args...);
+        });
+    }
+
+private:
+    /// Calls \c f for all items in [0, \c number_of_items), items of the same
+    /// color concurrently. An exception thrown by \c f is rethrown after all
+    /// threads have joined.
+    template <typename F>
+    void execute(std::size_t const number_of_items, F const& f) const
+    {
+        assert(number_of_items <= _item_colors.size());
+
+        std::vector<std::vector<std::size_t>> items_by_color;
+        for (std::size_t i = 0; i < number_of_items; i++)
+        {
+            auto const color = _item_colors[i];
+            if (color >= items_by_color.size())
+            {
+                items_by_color.resize(color + 1);
+            }
+            items_by_color[color].push_back(i);
+        }
+
+        std::exception_ptr exception;
+        for (auto const& items : items_by_color)
+        {
+            auto const n = static_cast<std::ptrdiff_t>(items.size());
+#pragma omp parallel for num_threads(_number_of_threads) schedule(dynamic, 16)
+            for (std::ptrdiff_t k = 0; k < n; k++)
+            {
+                try
+                {
+                    f(items[k]);
+                }
+                catch (...)
+                {
+#pragma omp critical(ParallelExecutor_exception)
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
+    int _number_of_threads = 1;
+    std::vector<std::size_t> _item_colors;
+};
+
+}  // namespace NumLib
@@ -10,7 +10,7 @@
 #include "ComputeSparsityPattern.h"
 
 #include "LocalToGlobalIndexMap.h"
-#include "MeshLib/NodeAdjacencyTable.h"
+#include "MeshLib/Node.h"
 
 #ifdef USE_PETSC
 #include "MeshLib/NodePartitionedMesh.h"
@@ -34,31 +34,33 @@ GlobalSparsityPattern computeSparsityPatternPETSc(
 GlobalSparsityPattern computeSparsityPatternNonPETSc(
     NumLib::LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
 {
-    MeshLib::NodeAdjacencyTable node_adjacency_table;
-    node_adjacency_table.createTable(mesh.getNodes());
+    auto const& nodes = mesh.getNodes();
+    auto const number_of_nodes = static_cast<std::ptrdiff_t>(nodes.size());
 
-    // A mapping   mesh node id -> global indices
-    // It acts as a cache for dof table queries.
-    std::vector<std::vector<GlobalIndexType>> global_idcs;
-
-    global_idcs.reserve(mesh.getNumberOfNodes());
-    for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
+    // Number of global indices of each mesh node. The dof table is only read,
+    // therefore the nodes can be processed in parallel.
+    std::vector<unsigned> number_of_dofs(nodes.size());
+#pragma omp parallel for
+    for (std::ptrdiff_t n = 0; n < number_of_nodes; ++n)
     {
-        MeshLib::Location l(mesh.getID(), MeshLib::MeshItemType::Node, n);
-        global_idcs.push_back(dof_table.getGlobalIndices(l));
+        MeshLib::Location const l(mesh.getID(), MeshLib::MeshItemType::Node, n);
+        number_of_dofs[n] = dof_table.getGlobalIndices(l).size();
     }
 
     GlobalSparsityPattern sparsity_pattern(dof_table.dofSizeWithGhosts());
 
-    // Map adjacent mesh nodes to "adjacent global indices".
-    for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
+    // Map adjacent mesh nodes to "adjacent global indices". Each node writes
+    // only the entries of its own global indices.
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::ptrdiff_t n = 0; n < number_of_nodes; ++n)
     {
         unsigned n_connected_dof = 0;
-        for (auto an : node_adjacency_table.getAdjacentNodes(n))
+        for (auto const* an : nodes[n]->getConnectedNodes())
         {
-            n_connected_dof += global_idcs[an].size();
+            n_connected_dof += number_of_dofs[an->getID()];
         }
-        for (auto global_index : global_idcs[n])
+        MeshLib::Location const l(mesh.getID(), MeshLib::MeshItemType::Node, n);
+        for (auto global_index : dof_table.getGlobalIndices(l))
         {
             sparsity_pattern[global_index] = n_connected_dof;
         }
@@ -46,9 +46,14 @@ void LocalToGlobalIndexMap::findGlobalIndicesWithElementID(
     std::unordered_set<MeshLib::Node*> const set_nodes(nodes.begin(), nodes.end());
 
     // For each element find the global indices for node/element
-    // components.
-    for (ElementIterator e = first; e != last; ++e)
+    // components. The mesh component map is only read and each element writes
+    // its own row, therefore the elements are processed in parallel.
+    auto const number_of_elements =
+        static_cast<std::ptrdiff_t>(std::distance(first, last));
+#pragma omp parallel for schedule(dynamic, 256)
+    for (std::ptrdiff_t i = 0; i < number_of_elements; ++i)
     {
+        auto const e = first + i;
         LineIndex indices;
         indices.reserve((*e)->getNumberOfNodes());
 
@@ -81,10 +86,14 @@ void LocalToGlobalIndexMap::findGlobalIndices(
     std::unordered_set<MeshLib::Node*> const set_nodes(nodes.begin(), nodes.end());
 
     // For each element find the global indices for node/element
-    // components.
-    std::size_t elem_id = 0;
-    for (ElementIterator e = first; e != last; ++e, ++elem_id)
+    // components. The mesh component map is only read and each element writes
+    // its own row, therefore the elements are processed in parallel.
+    auto const number_of_elements =
+        static_cast<std::ptrdiff_t>(std::distance(first, last));
+#pragma omp parallel for schedule(dynamic, 256)
+    for (std::ptrdiff_t elem_id = 0; elem_id < number_of_elements; ++elem_id)
     {
+        auto const e = first + elem_id;
         LineIndex indices;
         indices.reserve((*e)->getNumberOfNodes());
 
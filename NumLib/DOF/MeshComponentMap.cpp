@@ -12,6 +12,9 @@
 
 #include "MeshComponentMap.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "BaseLib/Error.h"
 #include "MeshLib/MeshSubset.h"
 
@@ -94,7 +97,15 @@ MeshComponentMap::MeshComponentMap(
 MeshComponentMap::MeshComponentMap(
     std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
 {
-    // construct dict (and here we number global_index by component type)
+    // Collect the lines first in a flat vector (and here we number
+    // global_index by component type), such that the final global indices are
+    // known before the dict is constructed.
+    std::vector<Line> lines;
+    lines.reserve(std::accumulate(
+        begin(components), end(components), std::size_t{0},
+        [](std::size_t const n, MeshLib::MeshSubset const& c) {
+            return n + c.getNumberOfNodes();
+        }));
     GlobalIndexType global_index = 0;
     int comp_id = 0;
     for (auto const& c : components)
@@ -103,18 +114,32 @@ MeshComponentMap::MeshComponentMap(
         // mesh items are ordered first by node, cell, ....
         for (std::size_t j = 0; j < c.getNumberOfNodes(); j++)
         {
-            _dict.insert(Line(
+            lines.emplace_back(
                 Location(mesh_id, MeshLib::MeshItemType::Node, c.getNodeID(j)),
-                comp_id, global_index++));
+                comp_id, global_index++);
         }
         comp_id++;
     }
-    _num_local_dof = _dict.size();
 
     if (order == ComponentOrder::BY_LOCATION)
     {
-        renumberByLocation();
+        // Same numbering as renumberByLocation(); the stable sort keeps the
+        // components of a location in ascending order.
+        std::stable_sort(begin(lines), end(lines), LineByLocationComparator{});
+        global_index = 0;
+        for (auto& line : lines)
+        {
+            line.global_index = global_index++;
+        }
     }
+
+    // Inserted one by one to keep the insertion order of equivalent lines in
+    // the non-unique indices.
+    for (auto const& line : lines)
+    {
+        _dict.insert(line);
+    }
+    _num_local_dof = _dict.size();
 }
 #endif // end of USE_PETSC
 
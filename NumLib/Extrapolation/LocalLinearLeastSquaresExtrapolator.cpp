@@ -9,21 +9,63 @@
 
 #include "LocalLinearLeastSquaresExtrapolator.h"
 
+#include <algorithm>
+#include <exception>
+#include <iterator>
+
 #include <Eigen/SVD>
 #include <logog/include/logog.hpp>
 
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/Assembler/SerialExecutor.h"
 #include "NumLib/Function/Interpolation.h"
 #include "ExtrapolatableElementCollection.h"
 
+namespace
+{
+//! Returns the number of integration points of an element from the number of
+//! its integration point values.
+unsigned getNumberOfIntegrationPoints(unsigned const num_values,
+                                      unsigned const num_components,
+                                      unsigned const num_nodes)
+{
+    if (num_values % num_components != 0)
+    {
+        OGS_FATAL(
+            "The number of computed integration point values is not divisable "
+            "by the number of num_components. Maybe the computed property is "
+            "not a %d-component vector for each integration point.",
+            num_components);
+    }
+
+    // number of integration points in the element
+    const auto num_int_pts = num_values / num_components;
+
+    if (num_int_pts < num_nodes)
+    {
+        OGS_FATAL(
+            "Least squares is not possible if there are more nodes than"
+            "integration points.");
+    }
+
+    return num_int_pts;
+}
+
+//! Number of elements extrapolated by one thread at a time.
+constexpr std::size_t extrapolation_chunk_size = 1024;
+}  // namespace
+
 namespace NumLib
 {
 LocalLinearLeastSquaresExtrapolator::LocalLinearLeastSquaresExtrapolator(
-    NumLib::LocalToGlobalIndexMap const& dof_table)
-    : _dof_table_single_component(dof_table)
+    NumLib::LocalToGlobalIndexMap const& dof_table,
+    int const number_of_threads)
+    : _dof_table_single_component(dof_table),
+      _number_of_threads(number_of_threads),
+      _integration_point_values_caches(std::max(number_of_threads, 1))
 {
     /* Note in case the following assertion fails:
      * If you copied the extrapolation code, for your processes from
@@ -90,12 +132,20 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
         MathLib::MatrixVectorTraits<GlobalVector>::newInstance(*_nodal_values);
     counts->setZero();
 
-    auto const size = extrapolatables.size();
-    for (std::size_t i = 0; i < size; ++i)
+    if (_number_of_threads > 1)
     {
-        extrapolateElement(i, num_components, extrapolatables, t,
+        extrapolateBatched(num_components, extrapolatables, t,
                            current_solution, dof_table, *counts);
     }
+    else
+    {
+        auto const size = extrapolatables.size();
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            extrapolateElement(i, num_components, extrapolatables, t,
+                               current_solution, dof_table, *counts);
+        }
+    }
     MathLib::LinAlg::finalizeAssembly(*_nodal_values);
 
     MathLib::LinAlg::componentwiseDivide(*_nodal_values, *_nodal_values,
@@ -127,52 +177,45 @@ void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
         OGS_FATAL("mismatch in number of D.o.F.");
     }
 
-    auto const size = extrapolatables.size();
-    for (std::size_t i = 0; i < size; ++i)
+    MathLib::LinAlg::setLocalAccessibleVector(
+        *_nodal_values);  // For access in calculateResidualElement().
+
+    // Each element sets only its own residuals, hence the elements can be
+    // processed concurrently.
+    auto const size = static_cast<std::ptrdiff_t>(extrapolatables.size());
+    std::exception_ptr exception;
+#pragma omp parallel for num_threads(_number_of_threads) schedule(dynamic, 64)
+    for (std::ptrdiff_t i = 0; i < size; ++i)
+    {
+        try
+        {
+            calculateResidualElement(
+                i, num_components, extrapolatables, t, current_solution,
+                dof_table, _integration_point_values_caches[getThreadNumber()]);
+        }
+        catch (...)
+        {
+#pragma omp critical(LocalLinearLeastSquaresExtrapolator_exception)
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+    if (exception)
     {
-        calculateResidualElement(i, num_components, extrapolatables, t,
-                                 current_solution, dof_table);
+        std::rethrow_exception(exception);
     }
     MathLib::LinAlg::finalizeAssembly(*_residuals);
 }
 
-void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
-    std::size_t const element_index,
-    const unsigned num_components,
-    ExtrapolatableElementCollection const& extrapolatables,
-    const double t,
-    GlobalVector const& current_solution,
-    LocalToGlobalIndexMap const& dof_table,
-    GlobalVector& counts)
+LocalLinearLeastSquaresExtrapolator::CachedData const&
+LocalLinearLeastSquaresExtrapolator::getCachedData(
+    std::size_t const element_index, unsigned const num_nodes,
+    unsigned const num_int_pts,
+    ExtrapolatableElementCollection const& extrapolatables)
 {
-    auto const& integration_point_values =
-        extrapolatables.getIntegrationPointValues(
-            element_index, t, current_solution, dof_table,
-            _integration_point_values_cache);
-
     auto const& N_0 = extrapolatables.getShapeMatrix(element_index, 0);
-    auto const num_nodes = static_cast<unsigned>(N_0.cols());
-    auto const num_values =
-        static_cast<unsigned>(integration_point_values.size());
-
-    if (num_values % num_components != 0)
-    {
-        OGS_FATAL(
-            "The number of computed integration point values is not divisable "
-            "by the number of num_components. Maybe the computed property is "
-            "not a %d-component vector for each integration point.",
-            num_components);
-    }
-
-    // number of integration points in the element
-    const auto num_int_pts = num_values / num_components;
-
-    if (num_int_pts < num_nodes)
-    {
-        OGS_FATAL(
-            "Least squares is not possible if there are more nodes than"
-            "integration points.");
-    }
 
     auto const pair_it_inserted = _qr_decomposition_cache.emplace(
         std::make_pair(num_nodes, num_int_pts), CachedData{});
@@ -226,6 +269,34 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
         OGS_FATAL("The cached and the passed shapematrices differ.");
     }
 
+    return cached_data;
+}
+
+void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
+    std::size_t const element_index,
+    const unsigned num_components,
+    ExtrapolatableElementCollection const& extrapolatables,
+    const double t,
+    GlobalVector const& current_solution,
+    LocalToGlobalIndexMap const& dof_table,
+    GlobalVector& counts)
+{
+    auto const& integration_point_values =
+        extrapolatables.getIntegrationPointValues(
+            element_index, t, current_solution, dof_table,
+            _integration_point_values_caches[0]);
+
+    auto const& N_0 = extrapolatables.getShapeMatrix(element_index, 0);
+    auto const num_nodes = static_cast<unsigned>(N_0.cols());
+    auto const num_values =
+        static_cast<unsigned>(integration_point_values.size());
+
+    const auto num_int_pts =
+        getNumberOfIntegrationPoints(num_values, num_components, num_nodes);
+
+    auto const& cached_data = getCachedData(element_index, num_nodes,
+                                            num_int_pts, extrapolatables);
+
     auto const& global_indices =
         _dof_table_single_component(element_index, 0).rows;
 
@@ -272,35 +343,169 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
     }
 }
 
-void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
-    std::size_t const element_index,
+void LocalLinearLeastSquaresExtrapolator::extrapolateBatched(
     const unsigned num_components,
     ExtrapolatableElementCollection const& extrapolatables,
     const double t,
     GlobalVector const& current_solution,
-    LocalToGlobalIndexMap const& dof_table)
+    LocalToGlobalIndexMap const& dof_table,
+    GlobalVector& counts)
 {
-    auto const& int_pt_vals = extrapolatables.getIntegrationPointValues(
-        element_index, t, current_solution, dof_table,
-        _integration_point_values_cache);
+    //! Elements of one chunk having the same numbers of nodes and integration
+    //! points.
+    struct Batch
+    {
+        CachedData const* cached_data;
+        std::vector<std::size_t> element_indices;
+        //! The integration point values of all elements of the batch. Each
+        //! element contributes \c num_components consecutive columns of a
+        //! column-major (\#int_pts x (\#elements * num_components)) matrix.
+        std::vector<double> integration_point_values;
+        Eigen::MatrixXd nodal_values;
+    };
 
-    auto const num_values = static_cast<unsigned>(int_pt_vals.size());
-    if (num_values % num_components != 0)
+    auto const size = extrapolatables.size();
+    auto const number_of_chunks = static_cast<std::ptrdiff_t>(
+        (size + extrapolation_chunk_size - 1) / extrapolation_chunk_size);
+
+    std::exception_ptr exception;
+#pragma omp parallel for num_threads(_number_of_threads) schedule(dynamic) \
+    ordered
+    for (std::ptrdiff_t chunk = 0; chunk < number_of_chunks; ++chunk)
     {
-        OGS_FATAL(
-            "The number of computed integration point values is not divisable "
-            "by the number of num_components. Maybe the computed property is "
-            "not a %d-component vector for each integration point.",
-            num_components);
+        std::vector<Batch> batches;
+        try
+        {
+            auto& cache = _integration_point_values_caches[getThreadNumber()];
+            auto const chunk_begin = chunk * extrapolation_chunk_size;
+            auto const chunk_end =
+                std::min(chunk_begin + extrapolation_chunk_size, size);
+            for (auto element_index = chunk_begin; element_index < chunk_end;
+                 ++element_index)
+            {
+                auto const& integration_point_values =
+                    extrapolatables.getIntegrationPointValues(
+                        element_index, t, current_solution, dof_table, cache);
+
+                auto const& N_0 =
+                    extrapolatables.getShapeMatrix(element_index, 0);
+                auto const num_nodes = static_cast<unsigned>(N_0.cols());
+                auto const num_int_pts = getNumberOfIntegrationPoints(
+                    static_cast<unsigned>(integration_point_values.size()),
+                    num_components, num_nodes);
+
+                auto batch = std::find_if(
+                    batches.begin(), batches.end(),
+                    [&](Batch const& b) {
+                        auto const& A = b.cached_data->A;
+                        return static_cast<unsigned>(A.cols()) == num_nodes &&
+                               static_cast<unsigned>(A.rows()) == num_int_pts;
+                    });
+                if (batch == batches.end())
+                {
+                    CachedData const* cached_data;
+#pragma omp critical(LocalLinearLeastSquaresExtrapolator_cache)
+                    cached_data = &getCachedData(element_index, num_nodes,
+                                                 num_int_pts, extrapolatables);
+                    batches.push_back({cached_data, {}, {}, {}});
+                    batch = std::prev(batches.end());
+                }
+                else if (batch->cached_data->A.row(0) != N_0)
+                {
+                    OGS_FATAL(
+                        "The cached and the passed shapematrices differ.");
+                }
+
+                batch->element_indices.push_back(element_index);
+                // The integration point values are ordered component-wise,
+                // cf. extrapolateElement().
+                batch->integration_point_values.insert(
+                    batch->integration_point_values.end(),
+                    integration_point_values.begin(),
+                    integration_point_values.end());
+            }
+
+            // Apply the pre-computed pseudo-inverses.
+            for (auto& batch : batches)
+            {
+                auto const& A_pinv = batch.cached_data->A_pinv;
+                Eigen::Map<const Eigen::MatrixXd> const
+                    integration_point_values_mat(
+                        batch.integration_point_values.data(), A_pinv.cols(),
+                        batch.element_indices.size() * num_components);
+                batch.nodal_values.noalias() =
+                    A_pinv * integration_point_values_mat;
+            }
+        }
+        catch (...)
+        {
+#pragma omp critical(LocalLinearLeastSquaresExtrapolator_exception)
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+            batches.clear();
+        }
+
+        // The nodal values are summed up one chunk after another, such that
+        // no two threads write to the same nodal value.
+#pragma omp ordered
+        {
+            std::vector<GlobalIndexType> indices;
+            for (auto const& batch : batches)
+            {
+                auto const num_nodes = batch.nodal_values.rows();
+                for (std::size_t e = 0; e < batch.element_indices.size(); ++e)
+                {
+                    auto const& global_indices = _dof_table_single_component(
+                        batch.element_indices[e], 0).rows;
+
+                    // _nodal_values is ordered location-wise
+                    indices.clear();
+                    for (unsigned comp = 0; comp < num_components; ++comp)
+                    {
+                        for (auto i : global_indices)
+                        {
+                            indices.push_back(num_components * i + comp);
+                        }
+                    }
+
+                    _nodal_values->add(indices,
+                                       batch.nodal_values.data() +
+                                           e * num_components * num_nodes);
+                    counts.add(indices,
+                               std::vector<double>(indices.size(), 1.0));
+                }
+            }
+        }
     }
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
 
-    // number of integration points in the element
-    const auto num_int_pts = num_values / num_components;
+void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
+    std::size_t const element_index,
+    const unsigned num_components,
+    ExtrapolatableElementCollection const& extrapolatables,
+    const double t,
+    GlobalVector const& current_solution,
+    LocalToGlobalIndexMap const& dof_table,
+    std::vector<double>& integration_point_values_cache)
+{
+    auto const& int_pt_vals = extrapolatables.getIntegrationPointValues(
+        element_index, t, current_solution, dof_table,
+        integration_point_values_cache);
 
     const auto& global_indices =
         _dof_table_single_component(element_index, 0).rows;
     const auto num_nodes = static_cast<unsigned>(global_indices.size());
 
+    auto const num_values = static_cast<unsigned>(int_pt_vals.size());
+    const auto num_int_pts =
+        getNumberOfIntegrationPoints(num_values, num_components, num_nodes);
+
     auto const& interpolation_matrix =
         _qr_decomposition_cache.find({num_nodes, num_int_pts})->second.A;
 
@@ -308,8 +513,6 @@ void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
     auto const int_pt_vals_mat =
         MathLib::toMatrix(int_pt_vals, num_components, num_int_pts);
 
-    MathLib::LinAlg::setLocalAccessibleVector(
-        *_nodal_values);  // For access in the for-loop.
     for (unsigned comp = 0; comp < num_components; ++comp)
     {
         // filter nodal values of the current element
@@ -38,13 +38,22 @@ class LocalLinearLeastSquaresExtrapolator : public Extrapolator
 {
 public:
     /*! Constructs a new instance.
+     *
+     * If \c number_of_threads is greater than one, the elements are processed
+     * in chunks on that many threads. Within each chunk the elements with the
+     * same numbers of nodes and integration points are extrapolated together
+     * by a single matrix-matrix product. The chunks' results are added to the
+     * nodal values one chunk after another, in the order of the elements.
      *
      * \note
      * The \c dof_table must point to a d.o.f. table for one single-component
      * variable.
+     * For more than one thread the integration point values of different
+     * elements must be safe to be computed concurrently.
      */
     explicit LocalLinearLeastSquaresExtrapolator(
-        NumLib::LocalToGlobalIndexMap const& dof_table);
+        NumLib::LocalToGlobalIndexMap const& dof_table,
+        int const number_of_threads = 1);
 
     void extrapolate(const unsigned num_components,
                      ExtrapolatableElementCollection const& extrapolatables,
@@ -84,6 +93,13 @@ private:
         GlobalVector const& current_solution,
         LocalToGlobalIndexMap const& dof_table, GlobalVector& counts);
 
+    //! Extrapolate all elements in batches on multiple threads.
+    void extrapolateBatched(
+        const unsigned num_components,
+        ExtrapolatableElementCollection const& extrapolatables, const double t,
+        GlobalVector const& current_solution,
+        LocalToGlobalIndexMap const& dof_table, GlobalVector& counts);
+
     //! Compute the residuals for one element
     void calculateResidualElement(
         std::size_t const element_index,
@@ -91,7 +107,8 @@ private:
         ExtrapolatableElementCollection const& extrapolatables,
         const double t,
         GlobalVector const& current_solution,
-        LocalToGlobalIndexMap const& dof_table);
+        LocalToGlobalIndexMap const& dof_table,
+        std::vector<double>& integration_point_values_cache);
 
     std::unique_ptr<GlobalVector> _nodal_values;  //!< extrapolated nodal values
     std::unique_ptr<GlobalVector> _residuals;     //!< extrapolation residuals
@@ -99,8 +116,11 @@ private:
     //! DOF table used for writing to global vectors.
     NumLib::LocalToGlobalIndexMap const& _dof_table_single_component;
 
-    //! Avoids frequent reallocations.
-    std::vector<double> _integration_point_values_cache;
+    //! Number of threads used for extrapolation.
+    int const _number_of_threads;
+
+    //! Avoids frequent reallocations. One cache per thread.
+    std::vector<std::vector<double>> _integration_point_values_caches;
 
     //! Stores a matrix and its Moore-Penrose pseudo-inverse.
     struct CachedData
@@ -123,6 +143,19 @@ private:
      * typeid.
      */
     std::map<std::pair<unsigned, unsigned>, CachedData> _qr_decomposition_cache;
+
+    /*! Returns the cached data for elements with \c num_nodes nodes and
+     * \c num_int_pts integration points. If not cached yet, the data is
+     * computed from the shape matrices of the element with the given
+     * \c element_index.
+     *
+     * \note Not thread-safe. The returned reference stays valid while new
+     * data is added to the cache.
+     */
+    CachedData const& getCachedData(
+        std::size_t const element_index, unsigned const num_nodes,
+        unsigned const num_int_pts,
+        ExtrapolatableElementCollection const& extrapolatables);
 };
 
 }  // namespace NumLib
@@ -0,0 +1,57 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "NumberOfIntegrationPoints.h"
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/MeshEnums.h"
+
+#include "IntegrationGaussLegendrePrism.h"
+#include "IntegrationGaussLegendrePyramid.h"
+#include "IntegrationGaussLegendreTet.h"
+#include "IntegrationGaussLegendreTri.h"
+#include "IntegrationPoint.h"
+
+namespace NumLib
+{
+unsigned getNumberOfGaussLegendreIntegrationPoints(
+    MeshLib::Element const& element, unsigned const integration_order)
+{
+    switch (element.getGeomType())
+    {
+        case MeshLib::MeshElemType::POINT:
+            return IntegrationPoint::getNumberOfPoints(integration_order);
+        case MeshLib::MeshElemType::LINE:
+            return integration_order;
+        case MeshLib::MeshElemType::QUAD:
+            return integration_order * integration_order;
+        case MeshLib::MeshElemType::HEXAHEDRON:
+            return integration_order * integration_order * integration_order;
+        case MeshLib::MeshElemType::TRIANGLE:
+            return IntegrationGaussLegendreTri::getNumberOfPoints(
+                integration_order);
+        case MeshLib::MeshElemType::TETRAHEDRON:
+            return IntegrationGaussLegendreTet::getNumberOfPoints(
+                integration_order);
+        case MeshLib::MeshElemType::PRISM:
+            return IntegrationGaussLegendrePrism::getNumberOfPoints(
+                integration_order);
+        case MeshLib::MeshElemType::PYRAMID:
+            return IntegrationGaussLegendrePyramid::getNumberOfPoints(
+                integration_order);
+        default:
+            OGS_FATAL(
+                "No Gauss-Legendre integration method for element %d of type "
+                "%s.",
+                element.getID(),
+                MeshLib::MeshElemType2String(element.getGeomType()).c_str());
+    }
+}
+}  // namespace NumLib
@@ -0,0 +1,24 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+namespace MeshLib
+{
+class Element;
+}
+
+namespace NumLib
+{
+/// Returns the number of integration points of the Gauss-Legendre integration
+/// method of the given order chosen by the GaussLegendreIntegrationPolicy for
+/// the given element.
+unsigned getNumberOfGaussLegendreIntegrationPoints(
+    MeshLib::Element const& element, unsigned const integration_order);
+}  // namespace NumLib
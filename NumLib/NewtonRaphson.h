@@ -17,12 +17,44 @@
 namespace NumLib
 {
 
+/// Decomposition of the Jacobian in the local Newton iterations. The full
+/// pivoting LU decomposition is the most robust choice, the partial pivoting LU
+/// decomposition is considerably faster for the small fixed-size systems of the
+/// constitutive models but requires a regular Jacobian.
+enum class LocalLinearSolverType
+{
+    FullPivLU,
+    PartialPivLU
+};
+
 struct NewtonRaphsonSolverParameters
 {
     int const maximum_iterations;
     double const error_tolerance;
+    LocalLinearSolverType const linear_solver_type =
+        LocalLinearSolverType::FullPivLU;
 };
 
+/// Calls \c f with a default constructed Eigen decomposition of the given
+/// type for the fixed-size \c JacobianMatrix and returns f's result. The
+/// decomposition does not allocate memory dynamically.
+template <typename JacobianMatrix, typename Function>
+auto invokeWithLocalLinearSolver(LocalLinearSolverType const type,
+                                 Function&& f)
+{
+    static_assert(JacobianMatrix::RowsAtCompileTime != Eigen::Dynamic &&
+                      JacobianMatrix::ColsAtCompileTime != Eigen::Dynamic,
+                  "The local Jacobian must have a fixed size.");
+
+    if (type == LocalLinearSolverType::PartialPivLU)
+    {
+        Eigen::PartialPivLU<JacobianMatrix> linear_solver;
+        return f(linear_solver);
+    }
+    Eigen::FullPivLU<JacobianMatrix> linear_solver;
+    return f(linear_solver);
+}
+
 /// Newton-Raphson solver for system of equations using an Eigen linear solvers
 /// library.
 /// The current implementation does not update the solution itself, but calls a
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -129,6 +130,28 @@ public:
                                       const double dxdot_dx, const double dx_dx,
                                       GlobalMatrix& M, GlobalMatrix& K,
                                       GlobalVector& b, GlobalMatrix& Jac) = 0;
+
+    /*! Enables or disables the assembly of the residual element by element.
+     *
+     * If enabled, assembleWithJacobian() does not assemble the element
+     * contributions to \c M and \c K into the global matrices. Instead,
+     * \f$ M \cdot \hat x + K \cdot x_C \f$ is subtracted from \c b element
+     * by element, such that the residual
+     * \f$ r = M \cdot \hat x + K \cdot x_C - b \f$ is still obtained from
+     * the assembled quantities.
+     *
+     * ODE systems not supporting this mode do not need to override this
+     * method.
+     */
+    virtual void setLocalResidualAssembly(bool const enabled)
+    {
+        if (enabled)
+        {
+            OGS_FATAL(
+                "The local assembly of the residual is not supported by this "
+                "ODE system.");
+        }
+    }
 };
 
 //! @}
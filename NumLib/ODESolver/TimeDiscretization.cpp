@@ -11,6 +11,8 @@
 
 #include "TimeDiscretization.h"
 
+#include "BaseLib/FileTools.h"
+
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 
 namespace NumLib
@@ -59,12 +61,38 @@ double BackwardEuler::getRelativeChangeFromPreviousTimestep(
     return computeRelativeChangeFromPreviousTimestep(x, _x_old, norm_type);
 }
 
+void BackwardEuler::writeState(std::ostream& out) const
+{
+    BaseLib::writeValueBinary(out, _t);
+    MathLib::LinAlg::writeBinary(out, _x_old);
+}
+
+void BackwardEuler::readState(std::istream& in)
+{
+    _t = BaseLib::readBinaryValue<double>(in);
+    MathLib::LinAlg::readBinary(in, _x_old);
+}
+
 double ForwardEuler::getRelativeChangeFromPreviousTimestep(
     GlobalVector const& x, MathLib::VecNormType norm_type)
 {
     return computeRelativeChangeFromPreviousTimestep(x, _x_old, norm_type);
 }
 
+void ForwardEuler::writeState(std::ostream& out) const
+{
+    BaseLib::writeValueBinary(out, _t);
+    BaseLib::writeValueBinary(out, _t_old);
+    MathLib::LinAlg::writeBinary(out, _x_old);
+}
+
+void ForwardEuler::readState(std::istream& in)
+{
+    _t = BaseLib::readBinaryValue<double>(in);
+    _t_old = BaseLib::readBinaryValue<double>(in);
+    MathLib::LinAlg::readBinary(in, _x_old);
+}
+
 double CrankNicolson::getRelativeChangeFromPreviousTimestep(
     GlobalVector const& x, MathLib::VecNormType norm_type)
 {
@@ -98,6 +126,50 @@ void BackwardDifferentiationFormula::pushState(const double,
     }
 }
 
+void BackwardDifferentiationFormula::writeState(std::ostream& out) const
+{
+    BaseLib::writeValueBinary(out, _t);
+    BaseLib::writeValueBinary(out, _offset);
+    BaseLib::writeValueBinary(out, static_cast<std::uint64_t>(_xs_old.size()));
+    for (auto const* x : _xs_old)
+    {
+        MathLib::LinAlg::writeBinary(out, *x);
+    }
+}
+
+void BackwardDifferentiationFormula::readState(std::istream& in)
+{
+    assert(!_xs_old.empty());  // Set by setInitialState().
+
+    _t = BaseLib::readBinaryValue<double>(in);
+    _offset = BaseLib::readBinaryValue<unsigned>(in);
+    auto const number_of_old_solutions =
+        BaseLib::readBinaryValue<std::uint64_t>(in);
+    if (number_of_old_solutions == 0 || number_of_old_solutions > _num_steps ||
+        _offset >= number_of_old_solutions)
+    {
+        OGS_FATAL(
+            "The stored state does not fit to a BDF scheme of order %d.",
+            _num_steps);
+    }
+
+    // The vector set by setInitialState() serves as template for the others.
+    while (_xs_old.size() < number_of_old_solutions)
+    {
+        _xs_old.push_back(
+            &NumLib::GlobalVectorProvider::provider.getVector(*_xs_old[0]));
+    }
+    while (_xs_old.size() > number_of_old_solutions)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_xs_old.back());
+        _xs_old.pop_back();
+    }
+    for (auto* x : _xs_old)
+    {
+        MathLib::LinAlg::readBinary(in, *x);
+    }
+}
+
 namespace detail
 {
 //! Coefficients used in the backward differentiation formulas.
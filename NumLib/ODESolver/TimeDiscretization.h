@@ -224,6 +224,31 @@ public:
     virtual bool needsPreload() const { return false; }
     //! @}
 
+    /*! Writes the current time and the solution history to the given binary
+     * stream, such that the time integration can be continued after a
+     * restart.
+     *
+     * Schemes that keep further internal state, like the CrankNicolson scheme,
+     * do not support this.
+     */
+    virtual void writeState(std::ostream& /*out*/) const
+    {
+        OGS_FATAL(
+            "Writing the state is not supported by the chosen time "
+            "discretization scheme.");
+    }
+
+    /*! Restores the state written by writeState().
+     *
+     * \pre setInitialState() has been called before.
+     */
+    virtual void readState(std::istream& /*in*/)
+    {
+        OGS_FATAL(
+            "Reading the state is not supported by the chosen time "
+            "discretization scheme.");
+    }
+
 protected:
     std::unique_ptr<GlobalVector> _dx;  ///< Used to store \f$ u_{n+1}-u_{n}\f$.
 
@@ -296,6 +321,9 @@ public:
         LinAlg::scale(y, 1.0 / _delta_t);
     }
 
+    void writeState(std::ostream& out) const override;
+    void readState(std::istream& in) override;
+
 private:
     double _t;        //!< \f$ t_C \f$
     double _delta_t;  //!< the timestep size
@@ -368,6 +396,10 @@ public:
     double getDxDx() const override { return 0.0; }
     //! Returns the solution from the preceding timestep.
     GlobalVector const& getXOld() const { return _x_old; }
+
+    void writeState(std::ostream& out) const override;
+    void readState(std::istream& in) override;
+
 private:
     double _t;        //!< \f$ t_C \f$
     double _t_old;    //!< the time of the preceding timestep
@@ -509,6 +541,9 @@ public:
 
     void getWeightedOldX(GlobalVector& y) const override;
 
+    void writeState(std::ostream& out) const override;
+    void readState(std::istream& in) override;
+
 private:
     std::size_t eff_num_steps() const { return _xs_old.size(); }
     const unsigned _num_steps;  //!< The order of the BDF method
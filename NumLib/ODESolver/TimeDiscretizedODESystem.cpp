@@ -43,19 +43,46 @@ namespace NumLib
 TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
                          NonlinearSolverTag::Newton>::
     TimeDiscretizedODESystem(const int process_id, ODE& ode,
-                             TimeDisc& time_discretization)
+                             TimeDisc& time_discretization,
+                             bool const local_residual_assembly)
     : _ode(ode),
       _time_disc(time_discretization),
-      _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
+      _mat_trans(createMatrixTranslator<ODETag>(time_discretization)),
+      _local_residual_assembly(local_residual_assembly)
 {
+    auto const matrix_specification =
+        _ode.getMatrixSpecifications(process_id);
     _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _Jac_id);
+        matrix_specification, _Jac_id);
+    _b = &NumLib::GlobalVectorProvider::provider.getVector(
+        matrix_specification, _b_id);
+
+    if (!_local_residual_assembly)
+    {
+        _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            matrix_specification, _M_id);
+        _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            matrix_specification, _K_id);
+        return;
+    }
+
+    if (_time_disc.needsPreload())
+    {
+        OGS_FATAL(
+            "The local assembly of the residual cannot be used with time "
+            "discretization schemes requiring the matrices of the previous "
+            "timestep, e.g., the Crank-Nicolson scheme.");
+    }
+
+    // M and K stay empty except for contributions of natural boundary
+    // conditions. Hence, no memory is reserved for them.
+    MathLib::MatrixSpecifications const unstructured_matrix_specification{
+        matrix_specification.nrows, matrix_specification.ncols,
+        matrix_specification.ghost_indices, nullptr};
     _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _M_id);
+        unstructured_matrix_specification, _M_id);
     _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _K_id);
-    _b = &NumLib::GlobalVectorProvider::provider.getVector(
-        _ode.getMatrixSpecifications(process_id), _b_id);
+        unstructured_matrix_specification, _K_id);
 }
 
 TimeDiscretizedODESystem<
@@ -88,6 +115,9 @@ void TimeDiscretizedODESystem<
     _Jac->setZero();
 
     _ode.preAssemble(t, x_curr);
+    // The ODE might be shared by several equation systems, e.g., in the
+    // staggered scheme. Hence, the mode is set before each assembly.
+    _ode.setLocalResidualAssembly(_local_residual_assembly);
     _ode.assembleWithJacobian(t, x_curr, xdot, dxdot_dx, dx_dx, *_M, *_K, *_b,
                               *_Jac);
 
@@ -76,9 +76,15 @@ public:
      * \param process_id ID of the ODE to be solved.
      * \param ode the ODE to be wrapped.
      * \param time_discretization the time discretization to be used.
+     * \param local_residual_assembly if true, the global matrices \f$ M \f$
+     *        and \f$ K \f$ are not assembled but their contributions to the
+     *        residual are computed element by element, cf.
+     *        ODE::setLocalResidualAssembly(). Then \f$ M \f$ and \f$ K \f$
+     *        are allocated without sparsity pattern, saving two global matrices.
      */
     explicit TimeDiscretizedODESystem(const int process_id, ODE& ode,
-                                      TimeDisc& time_discretization);
+                                      TimeDisc& time_discretization,
+                                      bool const local_residual_assembly = false);
 
     ~TimeDiscretizedODESystem() override;
 
@@ -134,6 +140,9 @@ private:
     std::vector<NumLib::IndexValueVector<Index>> const* _known_solutions =
         nullptr;  //!< stores precomputed values for known solutions
 
+    //! Whether the residual is assembled element by element.
+    bool const _local_residual_assembly;
+
     GlobalMatrix* _Jac;  //!< the Jacobian of the residual
     GlobalMatrix* _M;    //!< Matrix \f$ M \f$.
     GlobalMatrix* _K;    //!< Matrix \f$ K \f$.
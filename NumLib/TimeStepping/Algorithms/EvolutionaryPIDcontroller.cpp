@@ -17,6 +17,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/Algorithm.h"
+#include "BaseLib/FileTools.h"
 
 namespace NumLib
 {
@@ -173,4 +174,22 @@ void EvolutionaryPIDcontroller::addFixedOutputTimes(
     // Remove possible duplicated elements and sort in descending order.
     BaseLib::makeVectorUnique(_fixed_output_times, std::greater<double>());
 }
+
+void EvolutionaryPIDcontroller::writeState(std::ostream& out) const
+{
+    TimeStepAlgorithm::writeState(out);
+    BaseLib::writeVectorBinary(out, _fixed_output_times);
+    BaseLib::writeValueBinary(out, _e_n_minus1);
+    BaseLib::writeValueBinary(out, _e_n_minus2);
+    BaseLib::writeValueBinary(out, _is_accepted);
+}
+
+void EvolutionaryPIDcontroller::readState(std::istream& in)
+{
+    TimeStepAlgorithm::readState(in);
+    _fixed_output_times = BaseLib::readBinaryVector<double>(in);
+    _e_n_minus1 = BaseLib::readBinaryValue<double>(in);
+    _e_n_minus2 = BaseLib::readBinaryValue<double>(in);
+    _is_accepted = BaseLib::readBinaryValue<bool>(in);
+}
 }  // namespace NumLib
@@ -85,6 +85,9 @@ public:
     void addFixedOutputTimes(
         std::vector<double> const& extra_fixed_output_times) override;
 
+    void writeState(std::ostream& out) const override;
+    void readState(std::istream& in) override;
+
 private:
     const double _kP = 0.075;  ///< Parameter. \see EvolutionaryPIDcontroller
     const double _kI = 0.175;  ///< Parameter. \see EvolutionaryPIDcontroller
@@ -18,6 +18,8 @@
 #include <limits>
 #include <utility>
 
+#include "BaseLib/FileTools.h"
+
 namespace NumLib
 {
 IterationNumberBasedTimeStepping::IterationNumberBasedTimeStepping(
@@ -126,4 +128,18 @@ bool IterationNumberBasedTimeStepping::accepted() const
 {
     return _iter_times <= _max_iter;
 }
+
+void IterationNumberBasedTimeStepping::writeState(std::ostream& out) const
+{
+    TimeStepAlgorithm::writeState(out);
+    BaseLib::writeValueBinary(out, _iter_times);
+    BaseLib::writeValueBinary(out, _n_rejected_steps);
+}
+
+void IterationNumberBasedTimeStepping::readState(std::istream& in)
+{
+    TimeStepAlgorithm::readState(in);
+    _iter_times = BaseLib::readBinaryValue<int>(in);
+    _n_rejected_steps = BaseLib::readBinaryValue<int>(in);
+}
 }  // namespace NumLib
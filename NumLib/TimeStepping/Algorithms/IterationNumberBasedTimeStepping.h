@@ -101,6 +101,9 @@ public:
     /// Return the number of repeated steps.
     int getNumberOfRepeatedSteps() const { return _n_rejected_steps; }
 
+    void writeState(std::ostream& out) const override;
+    void readState(std::istream& in) override;
+
 private:
     /// Calculate the next time step size.
     double getNextTimeStepSize() const;
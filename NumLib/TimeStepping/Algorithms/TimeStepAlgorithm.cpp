@@ -0,0 +1,49 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TimeStepAlgorithm.h"
+
+#include "BaseLib/FileTools.h"
+
+namespace
+{
+void writeTimeStep(std::ostream& out, NumLib::TimeStep const& ts)
+{
+    BaseLib::writeValueBinary(out, ts.previous());
+    BaseLib::writeValueBinary(out, ts.current());
+    BaseLib::writeValueBinary(out, ts.dt());
+    BaseLib::writeValueBinary(out, static_cast<std::uint64_t>(ts.steps()));
+}
+
+NumLib::TimeStep readTimeStep(std::istream& in)
+{
+    auto const previous = BaseLib::readBinaryValue<double>(in);
+    auto const current = BaseLib::readBinaryValue<double>(in);
+    auto const dt = BaseLib::readBinaryValue<double>(in);
+    auto const steps = BaseLib::readBinaryValue<std::uint64_t>(in);
+    return NumLib::TimeStep(previous, current, dt, steps);
+}
+}  // namespace
+
+namespace NumLib
+{
+void TimeStepAlgorithm::writeState(std::ostream& out) const
+{
+    writeTimeStep(out, _ts_prev);
+    writeTimeStep(out, _ts_current);
+    BaseLib::writeVectorBinary(out, _dt_vector);
+}
+
+void TimeStepAlgorithm::readState(std::istream& in)
+{
+    _ts_prev = readTimeStep(in);
+    _ts_current = readTimeStep(in);
+    _dt_vector = BaseLib::readBinaryVector<double>(in);
+}
+}  // namespace NumLib
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <cmath>
+#include <iosfwd>
 #include <vector>
 
 #include "BaseLib/Error.h"
@@ -124,6 +125,14 @@ public:
     {
     }
 
+    /// Writes the state of the time stepping, which is needed to continue it
+    /// after a restart, to the given binary stream.
+    /// Derived classes having additional state must extend this method.
+    virtual void writeState(std::ostream& out) const;
+
+    /// Restores the state written by writeState().
+    virtual void readState(std::istream& in);
+
 protected:
     /// initial time
     const double _t_initial;
@@ -49,6 +49,35 @@ struct ConstantParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(_values, pos);
     }
 
+    void evaluate(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+
+        std::copy(_values.begin(), _values.end(), values);
+    }
+
+    void evaluateAtIntegrationPoints(
+        double const t, MeshLib::Element const& element,
+        Eigen::Ref<typename Parameter<T>::ShapeFunctionValues const> const& N,
+        Eigen::Ref<typename Parameter<T>::RowMajorMatrix> values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluateAtIntegrationPoints(t, element, N, values);
+            return;
+        }
+
+        auto const row_values =
+            Eigen::Map<Eigen::Matrix<T, 1, Eigen::Dynamic> const>(
+                _values.data(), _values.size());
+        values.rowwise() = row_values;
+    }
+
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
         MeshLib::Element const& element, double const /*t*/) const override
     {
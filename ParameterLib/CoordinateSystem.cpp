@@ -80,10 +80,10 @@ Eigen::Matrix<double, 2, 2> CoordinateSystem::transformation<2>(
             "requested.");
     }
 
-    auto e0 = (*_base[0])(0 /* time independent */, pos);
-    auto e1 = (*_base[1])(0 /* time independent */, pos);
+    // The base vectors are the columns of the (column-major) matrix.
     Eigen::Matrix<double, 2, 2> t;
-    t << e0[0], e1[0], e0[1], e1[1];
+    _base[0]->evaluate(0 /* time independent */, pos, t.col(0).data());
+    _base[1]->evaluate(0 /* time independent */, pos, t.col(1).data());
 
     return t;
 }
@@ -99,11 +99,11 @@ Eigen::Matrix<double, 3, 3> CoordinateSystem::transformation<3>(
             "requested.");
     }
 
-    auto e0 = (*_base[0])(0 /* time independent */, pos);
-    auto e1 = (*_base[1])(0 /* time independent */, pos);
-    auto e2 = (*_base[2])(0 /* time independent */, pos);
+    // The base vectors are the columns of the (column-major) matrix.
     Eigen::Matrix<double, 3, 3> t;
-    t << e0[0], e1[0], e2[0], e0[1], e1[1], e2[1], e0[2], e1[2], e2[2];
+    _base[0]->evaluate(0 /* time independent */, pos, t.col(0).data());
+    _base[1]->evaluate(0 /* time independent */, pos, t.col(1).data());
+    _base[2]->evaluate(0 /* time independent */, pos, t.col(2).data());
 
 #ifndef NDEBUG
     if (std::abs(t.determinant() - 1) > std::numeric_limits<double>::epsilon())
@@ -64,6 +64,37 @@ struct CurveScaledParameter final : public Parameter<T>
         return cache;
     }
 
+    void evaluate(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        assert(!this->_coordinate_system ||
+               "Coordinate system not expected to be set for curve scaled "
+               "parameters.");
+
+        _parameter->evaluate(t, pos, values);
+        auto const scaling = _curve.getValue(t);
+
+        auto const num_comp = _parameter->getNumberOfComponents();
+        for (int c = 0; c < num_comp; ++c)
+        {
+            values[c] *= scaling;
+        }
+    }
+
+    void evaluateAtIntegrationPoints(
+        double const t, MeshLib::Element const& element,
+        Eigen::Ref<typename Parameter<T>::ShapeFunctionValues const> const& N,
+        Eigen::Ref<typename Parameter<T>::RowMajorMatrix> values) const override
+    {
+        assert(!this->_coordinate_system ||
+               "Coordinate system not expected to be set for curve scaled "
+               "parameters.");
+
+        _parameter->evaluateAtIntegrationPoints(t, element, N, values);
+        values.leftCols(_parameter->getNumberOfComponents()) *=
+            _curve.getValue(t);
+    }
+
 private:
     MathLib::PiecewiseLinearInterpolation const& _curve;
     Parameter<T> const* _parameter;
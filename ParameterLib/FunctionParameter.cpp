@@ -30,8 +30,12 @@ std::unique_ptr<ParameterBase> createFunctionParameter(
         vec_expressions.emplace_back(expression_str);
     }
 
-    return std::make_unique<FunctionParameter<double>>(name, mesh,
-                                                       vec_expressions);
+    auto const tabulate_nodal_values =
+        //! \ogs_file_param{prj__parameters__parameter__Function__tabulate_nodal_values}
+        config.getConfigParameter<bool>("tabulate_nodal_values", false);
+
+    return std::make_unique<FunctionParameter<double>>(
+        name, mesh, vec_expressions, tabulate_nodal_values);
 }
 
 }  // namespace ParameterLib
@@ -9,12 +9,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <exprtk.hpp>
 
+#include "BaseLib/Error.h"
 #include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
 #include "MeshLib/Node.h"
 
 #include "Parameter.h"
@@ -25,8 +33,13 @@ namespace ParameterLib
 /// A parameter class evaluating functions defined by
 /// user-provided mathematical expressions.
 ///
-/// Currently, x, y, and z are supported as variables
+/// Currently, x, y, z, and t are supported as variables
 /// of the functions.
+///
+/// The evaluation is re-entrant: each OpenMP thread evaluates its own copy of
+/// the compiled expressions. On request, time-independent expressions are
+/// tabulated at all mesh nodes on construction, such that the evaluation at
+/// nodes reduces to a load.
 template <typename T>
 struct FunctionParameter final : public Parameter<T>
 {
@@ -42,77 +55,274 @@ struct FunctionParameter final : public Parameter<T>
      * @param mesh        the parameter's domain of definition.
      * @param vec_expression_str  a vector of mathematical expressions
      * The vector size specifies the number of components of the parameter.
+     * @param tabulate_nodal_values  store the values of time-independent
+     * expressions at all mesh nodes.
      */
     FunctionParameter(std::string const& name,
                       MeshLib::Mesh const& mesh,
-                      std::vector<std::string> const& vec_expression_str)
-        : Parameter<T>(name, &mesh), _vec_expression_str(vec_expression_str)
+                      std::vector<std::string> const& vec_expression_str,
+                      bool const tabulate_nodal_values = false)
+        : Parameter<T>(name, &mesh),
+          _vec_expression_str(vec_expression_str),
+          _is_time_dependent(std::any_of(
+              _vec_expression_str.begin(), _vec_expression_str.end(),
+              [](std::string const& expression_str) {
+                  return dependsOnTime(expression_str);
+              }))
     {
-        _symbol_table.add_constants();
-        _symbol_table.create_variable("x");
-        _symbol_table.create_variable("y");
-        _symbol_table.create_variable("z");
+        // The thread numbers in parallel regions are less than the maximum
+        // number of threads, which is fixed at program start. The number of
+        // assembly threads is limited accordingly, cf.
+        // ProcessLib::Process::setNumberOfAssemblyThreads().
+        int const number_of_threads = getMaxNumberOfThreads();
+        _expression_states.reserve(number_of_threads);
+        for (int i = 0; i < number_of_threads; ++i)
+        {
+            _expression_states.push_back(createExpressionState());
+        }
+
+        if (tabulate_nodal_values && !_is_time_dependent)
+        {
+            tabulateNodalValues();
+        }
+    }
+
+    bool isTimeDependent() const override { return _is_time_dependent; }
 
-        _vec_expression.resize(_vec_expression_str.size());
+    int getNumberOfComponents() const override
+    {
+        return _vec_expression_str.size();
+    }
+
+    std::vector<T> operator()(double const t,
+                              SpatialPosition const& pos) const override
+    {
+        std::vector<T> cache(getNumberOfComponents());
+        evaluateExpressions(t, pos, cache.data());
+
+        if (!this->_coordinate_system)
+        {
+            return cache;
+        }
+
+        return this->rotateWithCoordinateSystem(cache, pos);
+    }
+
+    void evaluate(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+
+        evaluateExpressions(t, pos, values);
+    }
+
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
+        MeshLib::Element const& element, double const t) const override
+    {
+        if (!isTabulated() || this->_coordinate_system)
+        {
+            return Parameter<T>::getNodalValuesOnElement(element, t);
+        }
+
+        auto const n_nodes = element.getNumberOfNodes();
+        auto const n_components = getNumberOfComponents();
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(n_nodes,
+                                                                n_components);
+        for (unsigned i = 0; i < n_nodes; ++i)
+        {
+            result.row(i) = _nodal_values.row(element.getNode(i)->getID());
+        }
+        return result;
+    }
+
+    /// Evaluates the expressions at a batch of points given by the rows of
+    /// \c coordinates and writes the results to the rows of \c values.
+    /// Rotations by a local coordinate system are not supported here.
+    void evaluateAtPoints(
+        double const t,
+        Eigen::Ref<Eigen::Matrix<double, Eigen::Dynamic, 3,
+                                 Eigen::RowMajor> const> const& coordinates,
+        Eigen::Ref<typename Parameter<T>::RowMajorMatrix> values) const
+    {
+        if (this->_coordinate_system)
+        {
+            OGS_FATAL(
+                "The batched evaluation of the function parameter `%s' does "
+                "not support local coordinate systems.",
+                this->name.c_str());
+        }
+        assert(coordinates.rows() == values.rows());
+
+        auto& state = getExpressionState();
+        state.t = t;
+        auto const n_components = getNumberOfComponents();
+        for (Eigen::Index p = 0; p < coordinates.rows(); ++p)
+        {
+            state.x = coordinates(p, 0);
+            state.y = coordinates(p, 1);
+            state.z = coordinates(p, 2);
+            for (int i = 0; i < n_components; i++)
+            {
+                values(p, i) = state.expressions[i].value();
+            }
+        }
+    }
+
+private:
+    /// Variables and compiled expressions of one thread. The expressions are
+    /// bound to the addresses of the variables, therefore the state must not
+    /// be moved after its creation.
+    struct ExpressionState
+    {
+        T x = 0;
+        T y = 0;
+        T z = 0;
+        T t = 0;
+        symbol_table_t symbol_table;
+        std::vector<expression_t> expressions;
+    };
+
+    bool isTabulated() const { return _nodal_values.rows() > 0; }
+
+    static int getMaxNumberOfThreads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    static int getThreadNumber()
+    {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+
+    static bool dependsOnTime(std::string const& expression_str)
+    {
+        std::vector<std::string> variables;
+        if (!exprtk::collect_variables(expression_str, variables))
+        {
+            OGS_FATAL("Error: Could not collect the variables of the "
+                      "expression '%s'.",
+                      expression_str.c_str());
+        }
+        return std::any_of(variables.begin(), variables.end(),
+                           [](std::string const& variable) {
+                               return variable == "t" || variable == "T";
+                           });
+    }
+
+    std::unique_ptr<ExpressionState> createExpressionState() const
+    {
+        auto state = std::make_unique<ExpressionState>();
+        state->symbol_table.add_constants();
+        state->symbol_table.add_variable("x", state->x);
+        state->symbol_table.add_variable("y", state->y);
+        state->symbol_table.add_variable("z", state->z);
+        state->symbol_table.add_variable("t", state->t);
+
+        state->expressions.resize(_vec_expression_str.size());
         for (unsigned i = 0; i < _vec_expression_str.size(); i++)
         {
-            _vec_expression[i].register_symbol_table(_symbol_table);
+            state->expressions[i].register_symbol_table(state->symbol_table);
             parser_t parser;
-            if (!parser.compile(_vec_expression_str[i], _vec_expression[i]))
+            if (!parser.compile(_vec_expression_str[i], state->expressions[i]))
             {
-                OGS_FATAL("Error: %s\tExpression: %s\n", parser.error().c_str(),
+                OGS_FATAL("Error: %s\tExpression: %s\n",
+                          parser.error().c_str(),
                           _vec_expression_str[i].c_str());
             }
         }
+        return state;
     }
 
-    bool isTimeDependent() const override { return false; }
+    ExpressionState& getExpressionState() const
+    {
+        auto const thread_number = getThreadNumber();
+        if (thread_number >= static_cast<int>(_expression_states.size()))
+        {
+            OGS_FATAL(
+                "The function parameter `%s' was evaluated by thread %d, but "
+                "only %d expression states were created.",
+                this->name.c_str(), thread_number,
+                static_cast<int>(_expression_states.size()));
+        }
+        return *_expression_states[thread_number];
+    }
 
-    int getNumberOfComponents() const override
+    void tabulateNodalValues()
     {
-        return _vec_expression.size();
+        auto const& nodes = ParameterBase::_mesh->getNodes();
+        auto const n_nodes = static_cast<std::ptrdiff_t>(nodes.size());
+        auto const n_components = getNumberOfComponents();
+        _nodal_values.resize(n_nodes, n_components);
+
+#pragma omp parallel for
+        for (std::ptrdiff_t n = 0; n < n_nodes; ++n)
+        {
+            auto& state = getExpressionState();
+            auto const& node = *nodes[n];
+            state.x = node[0];
+            state.y = node[1];
+            state.z = node[2];
+            for (int i = 0; i < n_components; i++)
+            {
+                _nodal_values(n, i) = state.expressions[i].value();
+            }
+        }
     }
 
-    std::vector<T> operator()(double const /*t*/,
-                              SpatialPosition const& pos) const override
+    void evaluateExpressions(double const t, SpatialPosition const& pos,
+                             T* const values) const
     {
-        std::vector<T> cache(getNumberOfComponents());
-        auto& x = _symbol_table.get_variable("x")->ref();
-        auto& y = _symbol_table.get_variable("y")->ref();
-        auto& z = _symbol_table.get_variable("z")->ref();
+        auto const n_components = getNumberOfComponents();
+        if (isTabulated() && !pos.getCoordinates() && pos.getNodeID())
+        {
+            auto const node_values = _nodal_values.row(pos.getNodeID().get());
+            std::copy(node_values.data(), node_values.data() + n_components,
+                      values);
+            return;
+        }
+
+        auto& state = getExpressionState();
+        state.t = t;
         if (pos.getCoordinates())
         {
             auto const coords = pos.getCoordinates().get();
-            x = coords[0];
-            y = coords[1];
-            z = coords[2];
+            state.x = coords[0];
+            state.y = coords[1];
+            state.z = coords[2];
         }
         else if (pos.getNodeID())
         {
             auto const& node =
                 *ParameterBase::_mesh->getNode(pos.getNodeID().get());
-            x = node[0];
-            y = node[1];
-            z = node[2];
+            state.x = node[0];
+            state.y = node[1];
+            state.z = node[2];
         }
 
-        for (unsigned i = 0; i < _vec_expression.size(); i++)
+        for (int i = 0; i < n_components; i++)
         {
-            cache[i] = _vec_expression[i].value();
+            values[i] = state.expressions[i].value();
         }
-
-        if (!this->_coordinate_system)
-        {
-            return cache;
-        }
-
-        return this->rotateWithCoordinateSystem(cache, pos);
     }
 
-private:
     std::vector<std::string> const _vec_expression_str;
-    symbol_table_t _symbol_table;
-    std::vector<expression_t> _vec_expression;
+    bool const _is_time_dependent;
+    std::vector<std::unique_ptr<ExpressionState>> _expression_states;
+    /// Values of time-independent expressions at the mesh nodes, one row per
+    /// node. Empty if the values are not tabulated.
+    typename Parameter<T>::RowMajorMatrix _nodal_values;
 };
 
 std::unique_ptr<ParameterBase> createFunctionParameter(
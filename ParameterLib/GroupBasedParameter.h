@@ -60,14 +60,7 @@ struct GroupBasedParameter final : public Parameter<T>
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
-        auto const item_id = getMeshItemID(pos, type<MeshItemType>());
-        assert(item_id);
-        int const index = _property_index[item_id.get()];
-        auto const& values = _vec_values[index];
-        if (values.empty())
-        {
-            OGS_FATAL("No data found for the group index %d", index);
-        }
+        auto const& values = getValues(pos);
 
         if (!this->_coordinate_system)
         {
@@ -77,6 +70,45 @@ struct GroupBasedParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(values, pos);
     }
 
+    void evaluate(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+
+        auto const& group_values = getValues(pos);
+        std::copy(group_values.begin(), group_values.end(), values);
+    }
+
+    void evaluateAtIntegrationPoints(
+        double const t, MeshLib::Element const& element,
+        Eigen::Ref<typename Parameter<T>::ShapeFunctionValues const> const& N,
+        Eigen::Ref<typename Parameter<T>::RowMajorMatrix> values) const override
+    {
+        if (MeshItemType == MeshLib::MeshItemType::Node)
+        {
+            this->interpolateNodalValues(t, element, N, values);
+            return;
+        }
+
+        // Only element-wise groups are constant on an element.
+        if (this->_coordinate_system || values.rows() == 0)
+        {
+            Parameter<T>::evaluateAtIntegrationPoints(t, element, N, values);
+            return;
+        }
+
+        SpatialPosition pos;
+        pos.setElementID(element.getID());
+        auto const& group_values = getValues(pos);
+        values.rowwise() =
+            Eigen::Map<Eigen::Matrix<T, 1, Eigen::Dynamic> const>(
+                group_values.data(), group_values.size());
+    }
+
 private:
     template <MeshLib::MeshItemType ITEM_TYPE>
     struct type
@@ -95,6 +127,19 @@ private:
         return pos.getNodeID();
     }
 
+    std::vector<T> const& getValues(SpatialPosition const& pos) const
+    {
+        auto const item_id = getMeshItemID(pos, type<MeshItemType>());
+        assert(item_id);
+        int const index = _property_index[item_id.get()];
+        auto const& values = _vec_values[index];
+        if (values.empty())
+        {
+            OGS_FATAL("No data found for the group index %d", index);
+        }
+        return values;
+    }
+
     MeshLib::PropertyVector<int> const& _property_index;
     std::vector<std::vector<T>> const _vec_values;
 };
@@ -40,26 +40,49 @@ struct MeshElementParameter final : public Parameter<T>
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
-        auto const e = pos.getElementID();
-        if (!e)
+        std::vector<T> cache(_property.getNumberOfComponents());
+        getValues(pos, cache.data());
+
+        if (!this->_coordinate_system)
         {
-            OGS_FATAL(
-                "Trying to access a MeshElementParameter but the element id is "
-                "not specified.");
+            return cache;
         }
-        auto const num_comp = _property.getNumberOfComponents();
-        std::vector<T> cache(num_comp);
-        for (int c = 0; c < num_comp; ++c)
+
+        return this->rotateWithCoordinateSystem(cache, pos);
+    }
+
+    void evaluate(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        if (this->_coordinate_system)
         {
-            cache[c] = _property.getComponent(*e, c);
+            Parameter<T>::evaluate(t, pos, values);
+            return;
         }
 
-        if (!this->_coordinate_system)
+        getValues(pos, values);
+    }
+
+    void evaluateAtIntegrationPoints(
+        double const t, MeshLib::Element const& element,
+        Eigen::Ref<typename Parameter<T>::ShapeFunctionValues const> const& N,
+        Eigen::Ref<typename Parameter<T>::RowMajorMatrix> values) const override
+    {
+        // The value is constant on the element. With a local coordinate
+        // system the rotation might depend on the integration point, though.
+        if (this->_coordinate_system || values.rows() == 0)
         {
-            return cache;
+            Parameter<T>::evaluateAtIntegrationPoints(t, element, N, values);
+            return;
         }
 
-        return this->rotateWithCoordinateSystem(cache, pos);
+        SpatialPosition pos;
+        pos.setElementID(element.getID());
+        getValues(pos, values.row(0).data());
+        for (Eigen::Index ip = 1; ip < values.rows(); ++ip)
+        {
+            values.row(ip) = values.row(0);
+        }
     }
 
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
@@ -84,6 +107,23 @@ struct MeshElementParameter final : public Parameter<T>
     }
 
 private:
+    /// Copies the unrotated values of the element given in \c pos.
+    void getValues(SpatialPosition const& pos, T* const values) const
+    {
+        auto const e = pos.getElementID();
+        if (!e)
+        {
+            OGS_FATAL(
+                "Trying to access a MeshElementParameter but the element id is "
+                "not specified.");
+        }
+        auto const num_comp = _property.getNumberOfComponents();
+        for (int c = 0; c < num_comp; ++c)
+        {
+            values[c] = _property.getComponent(*e, c);
+        }
+    }
+
     MeshLib::PropertyVector<T> const& _property;
 };
 
@@ -44,19 +44,8 @@ struct MeshNodeParameter final : public Parameter<T>
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
-        auto const n = pos.getNodeID();
-        if (!n)
-        {
-            OGS_FATAL(
-                "Trying to access a MeshNodeParameter but the node id is not "
-                "specified.");
-        }
-        auto const num_comp = _property.getNumberOfComponents();
-        std::vector<T> cache(num_comp);
-        for (int c = 0; c < num_comp; ++c)
-        {
-            cache[c] = _property.getComponent(*n, c);
-        }
+        std::vector<T> cache(_property.getNumberOfComponents());
+        getValues(pos, cache.data());
 
         if (!this->_coordinate_system)
         {
@@ -66,6 +55,26 @@ struct MeshNodeParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(cache, pos);
     }
 
+    void evaluate(double const t, SpatialPosition const& pos,
+                  T* const values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+
+        getValues(pos, values);
+    }
+
+    void evaluateAtIntegrationPoints(
+        double const t, MeshLib::Element const& element,
+        Eigen::Ref<typename Parameter<T>::ShapeFunctionValues const> const& N,
+        Eigen::Ref<typename Parameter<T>::RowMajorMatrix> values) const override
+    {
+        this->interpolateNodalValues(t, element, N, values);
+    }
+
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
         MeshLib::Element const& element, double const t) const override
     {
@@ -73,21 +82,52 @@ struct MeshNodeParameter final : public Parameter<T>
         Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
             n_nodes, getNumberOfComponents());
 
-        SpatialPosition x_position;
-        auto const nodes = element.getNodes();
+        if (this->_coordinate_system)
+        {
+            SpatialPosition x_position;
+            auto const nodes = element.getNodes();
+            for (unsigned i = 0; i < n_nodes; ++i)
+            {
+                x_position.setNodeID(nodes[i]->getID());
+                auto const& values = this->operator()(t, x_position);
+                result.row(i) =
+                    Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
+                        values.data(), values.size());
+            }
+            return result;
+        }
+
+        auto const num_comp = _property.getNumberOfComponents();
         for (unsigned i = 0; i < n_nodes; ++i)
         {
-            x_position.setNodeID(nodes[i]->getID());
-            auto const& values = this->operator()(t, x_position);
-            result.row(i) =
-                Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                    values.data(), values.size());
+            auto const node_id = element.getNode(i)->getID();
+            for (int c = 0; c < num_comp; ++c)
+            {
+                result(i, c) = _property.getComponent(node_id, c);
+            }
         }
 
         return result;
     }
 
 private:
+    /// Copies the unrotated values of the node given in \c pos.
+    void getValues(SpatialPosition const& pos, T* const values) const
+    {
+        auto const n = pos.getNodeID();
+        if (!n)
+        {
+            OGS_FATAL(
+                "Trying to access a MeshNodeParameter but the node id is not "
+                "specified.");
+        }
+        auto const num_comp = _property.getNumberOfComponents();
+        for (int c = 0; c < num_comp; ++c)
+        {
+            values[c] = _property.getComponent(*n, c);
+        }
+    }
+
     MeshLib::PropertyVector<T> const& _property;
 };
 
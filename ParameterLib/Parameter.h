@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <utility>
@@ -141,6 +142,10 @@ struct Parameter : public ParameterBase
 {
     using ParameterBase::ParameterBase;
 
+    //! Row-major matrix of parameter values, one row per position.
+    using RowMajorMatrix =
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
     ~Parameter() override = default;
 
     //! Returns the number of components this Parameter has at every position
@@ -151,6 +156,66 @@ struct Parameter : public ParameterBase
     virtual std::vector<T> operator()(double const t,
                                       SpatialPosition const& pos) const = 0;
 
+    //! Writes the parameter value at the given time and position to the
+    //! caller-provided buffer \c values, which must hold
+    //! getNumberOfComponents() entries. If a local coordinate system rotates a
+    //! diagonal tensor, the buffer must hold the full tensor, i.e., 4 or 9
+    //! entries.
+    //!
+    //! In contrast to operator(), the derived classes implement this method
+    //! without heap allocations, unless a local coordinate system is set.
+    //! The default implementation copies the result of operator().
+    virtual void evaluate(double const t, SpatialPosition const& pos,
+                          T* const values) const
+    {
+        auto const result = this->operator()(t, pos);
+        std::copy(result.begin(), result.end(), values);
+    }
+
+    //! Shape function values at the integration points of an element, one row
+    //! per integration point and one column per element node.
+    using ShapeFunctionValues =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+    //! Writes the parameter values at the integration points of the given
+    //! element to the rows of \c values. The integration points are located by
+    //! the shape function values \c N, one row per integration point; the
+    //! number of columns of \c values must be as for evaluate().
+    //!
+    //! The default implementation calls evaluate() for each integration point
+    //! with the element id, the integration point number and the coordinates
+    //! interpolated from the element nodes. The derived classes may provide
+    //! faster implementations, e.g., a single evaluation for parameters which
+    //! are constant on an element. Parameters defined at the mesh nodes
+    //! interpolate their nodal values, cf. interpolateNodalValues().
+    virtual void evaluateAtIntegrationPoints(
+        double const t, MeshLib::Element const& element,
+        Eigen::Ref<ShapeFunctionValues const> const& N,
+        Eigen::Ref<RowMajorMatrix> values) const
+    {
+        assert(N.rows() == values.rows());
+        assert(N.cols() <=
+               static_cast<Eigen::Index>(element.getNumberOfNodes()));
+
+        SpatialPosition pos;
+        pos.setElementID(element.getID());
+        auto const nodes = element.getNodes();
+        for (Eigen::Index ip = 0; ip < N.rows(); ++ip)
+        {
+            MathLib::TemplatePoint<double, 3> coordinates;
+            for (Eigen::Index i = 0; i < N.cols(); ++i)
+            {
+                for (int d = 0; d < 3; ++d)
+                {
+                    coordinates[d] += N(ip, i) * (*nodes[i])[d];
+                }
+            }
+            pos.setIntegrationPoint(static_cast<unsigned>(ip));
+            pos.setCoordinates(coordinates);
+            evaluate(t, pos, values.row(ip).data());
+        }
+    }
+
     //! Returns a matrix of values for all nodes of the given element.
     //
     // The matrix is of the shape NxC, where N is the number of nodes and C is
@@ -166,25 +231,35 @@ struct Parameter : public ParameterBase
     {
         auto const n_nodes = static_cast<int>(element.getNumberOfNodes());
         auto const n_components = getNumberOfComponents();
-        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(n_nodes,
-                                                                n_components);
+        // Evaluated row by row into a row-major matrix, which is contiguous
+        // in memory for each node.
+        RowMajorMatrix result(n_nodes, n_components);
 
-        // Column vector of values, copied for each node.
         SpatialPosition x_position;
         auto const nodes = element.getNodes();
         for (int i = 0; i < n_nodes; ++i)
         {
             x_position.setAll(
                 nodes[i]->getID(), element.getID(), boost::none, boost::none);
-            auto const& values = this->operator()(t, x_position);
-            auto const row_values =
-                Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                    values.data(), values.size());
-            result.row(i) = row_values;
+            evaluate(t, x_position, result.row(i).data());
         }
 
         return result;
     }
+
+protected:
+    //! Interpolates the values at the element nodes, cf.
+    //! getNodalValuesOnElement(), to the integration points given by the shape
+    //! function values \c N, cf. evaluateAtIntegrationPoints().
+    void interpolateNodalValues(double const t,
+                                MeshLib::Element const& element,
+                                Eigen::Ref<ShapeFunctionValues const> const& N,
+                                Eigen::Ref<RowMajorMatrix> values) const
+    {
+        auto const nodal_values = getNodalValuesOnElement(element, t);
+        values.leftCols(nodal_values.cols()).noalias() =
+            N * nodal_values.topRows(N.cols());
+    }
 };
 
 //! Constructs a new ParameterBase from the given configuration.
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 #include "BaseLib/Error.h"
 
@@ -46,6 +47,10 @@ public:
         OGS_FATAL("not implemented.");
     }
 
+    //! Creates a new Jacobian assembler with the same configuration, used to
+    //! assemble on several threads concurrently.
+    virtual std::unique_ptr<AbstractJacobianAssembler> copy() const = 0;
+
     virtual ~AbstractJacobianAssembler() = default;
 };
 
@@ -10,6 +10,7 @@
 #include "PythonBoundaryCondition.h"
 
 #include <pybind11/pybind11.h>
+#include <cmath>
 #include <iostream>
 
 #include "MeshLib/MeshSearch/NodeSearch.h"
@@ -82,7 +83,8 @@ void PythonBoundaryCondition::getEssentialBCValues(
     FlushStdoutGuard guard(_flush_stdout);
     (void)guard;
 
-    auto const nodes = _bc_data.boundary_mesh.getNodes();
+    auto const& nodes = _bc_data.boundary_mesh.getNodes();
+    auto const num_nodes = _bc_data.boundary_mesh.getNumberOfNodes();
 
     auto const& bulk_node_ids_map =
         *_bc_data.boundary_mesh.getProperties().getPropertyVector<std::size_t>(
@@ -91,19 +93,25 @@ void PythonBoundaryCondition::getEssentialBCValues(
     bc_values.ids.clear();
     bc_values.values.clear();
 
-    bc_values.ids.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
-    bc_values.values.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
+    bc_values.ids.reserve(num_nodes);
+    bc_values.values.reserve(num_nodes);
 
-    std::vector<double> primary_variables;
+    // gather node ids, coordinates and primary variable values
+    using RowMajorMatrix =
+        PythonBoundaryConditionPythonSideInterface::RowMajorMatrix;
+    PythonBoundaryConditionPythonSideInterface::NodeIDs node_ids(num_nodes);
+    RowMajorMatrix coords(num_nodes, 3);
+    RowMajorMatrix primary_variables(
+        num_nodes, _dof_table_boundary->getNumberOfComponents());
 
-    for (auto const* node : _bc_data.boundary_mesh.getNodes())
+    for (std::size_t i = 0; i < num_nodes; ++i)
     {
-        auto const boundary_node_id = node->getID();
+        auto const boundary_node_id = nodes[i]->getID();
         auto const bulk_node_id = bulk_node_ids_map[boundary_node_id];
+        node_ids[i] = boundary_node_id;
 
-        // gather primary variable values
-        primary_variables.clear();
         auto const num_var = _dof_table_boundary->getNumberOfVariables();
+        int global_component = 0;
         for (int var = 0; var < num_var; ++var)
         {
             auto const num_comp =
@@ -128,26 +136,64 @@ void PythonBoundaryCondition::getEssentialBCValues(
                         bulk_node_id, var, comp);
                 }
 
-                primary_variables.push_back(x[dof_idx]);
+                primary_variables(i, global_component++) = x[dof_idx];
             }
         }
 
-        auto* xs = nodes[boundary_node_id]->getCoords();  // TODO DDC problems?
-        auto pair_flag_value = _bc_data.bc_object->getDirichletBCValue(
-            t, {xs[0], xs[1], xs[2]}, boundary_node_id, primary_variables);
-        if (!_bc_data.bc_object->isOverriddenEssential())
+        auto* xs = nodes[i]->getCoords();  // TODO DDC problems?
+        coords.row(i) << xs[0], xs[1], xs[2];
+    }
+
+    // The batched interface is preferred. If it is not overridden in Python,
+    // which is known after the call, the Dirichlet BC values are computed node
+    // by node.
+    Eigen::VectorXd values = _bc_data.bc_object->getDirichletBCValues(
+        t, coords, node_ids, primary_variables);
+    if (_bc_data.bc_object->isOverriddenEssentialBatched())
+    {
+        if (static_cast<std::size_t>(values.size()) != num_nodes)
         {
-            DBUG(
-                "Method `getDirichletBCValue' not overridden in Python "
-                "script.");
-            return;
+            OGS_FATAL(
+                "The Python BC must return one Dirichlet BC value per node. "
+                "%d values expected. %d values returned from Python.",
+                static_cast<int>(num_nodes), static_cast<int>(values.size()));
         }
+    }
+    else
+    {
+        values.resize(num_nodes);
+        std::vector<double> primary_variables_node(primary_variables.cols());
+        for (std::size_t i = 0; i < num_nodes; ++i)
+        {
+            Eigen::Map<Eigen::RowVectorXd>(primary_variables_node.data(),
+                                           primary_variables.cols()) =
+                primary_variables.row(i);
+            auto pair_flag_value = _bc_data.bc_object->getDirichletBCValue(
+                t, {coords(i, 0), coords(i, 1), coords(i, 2)}, node_ids[i],
+                primary_variables_node);
+            if (!_bc_data.bc_object->isOverriddenEssential())
+            {
+                DBUG(
+                    "Method `getDirichletBCValue' not overridden in Python "
+                    "script.");
+                return;
+            }
 
-        if (!pair_flag_value.first)
+            values[i] = pair_flag_value.first
+                            ? pair_flag_value.second
+                            : std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+        if (std::isnan(values[i]))
+        {
             continue;
+        }
 
         MeshLib::Location l(_bc_data.bulk_mesh_id, MeshLib::MeshItemType::Node,
-                            bulk_node_id);
+                            bulk_node_ids_map[node_ids[i]]);
         const auto dof_idx = _bc_data.dof_table_bulk.getGlobalIndex(
             l, _bc_data.global_component_id);
         if (dof_idx == NumLib::MeshComponentMap::nop)
@@ -165,7 +211,7 @@ void PythonBoundaryCondition::getEssentialBCValues(
         if (dof_idx >= 0)
         {
             bc_values.ids.emplace_back(dof_idx);
-            bc_values.values.emplace_back(pair_flag_value.second);
+            bc_values.values.emplace_back(values[i]);
         }
     }
 }
@@ -177,10 +223,18 @@ void PythonBoundaryCondition::applyNaturalBC(const double t,
 {
     FlushStdoutGuard guard(_flush_stdout);
 
+    // The batched interface is preferred. If it is not overridden in Python,
+    // the fluxes are computed integration point by integration point.
+    if (_bc_data.bc_object->isOverriddenNaturalBatched() &&
+        applyNaturalBCBatched(t, x, b, Jac))
+    {
+        return;
+    }
+
     try
     {
         GlobalExecutor::executeMemberOnDereferenced(
-            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
+            &PythonBoundaryConditionLocalAssemblerInterface::assemble,
             _local_assemblers, *_dof_table_boundary, t, x, K, b, Jac);
     }
     catch (MethodNotOverriddenInDerivedClassException const& /*e*/)
@@ -189,6 +243,71 @@ void PythonBoundaryCondition::applyNaturalBC(const double t,
     }
 }
 
+bool PythonBoundaryCondition::applyNaturalBCBatched(const double t,
+                                                    const GlobalVector& x,
+                                                    GlobalVector& b,
+                                                    GlobalMatrix* Jac)
+{
+    using RowMajorMatrix =
+        PythonBoundaryConditionLocalAssemblerInterface::RowMajorMatrix;
+
+    // The integration points of each element are stored contiguously.
+    std::vector<Eigen::Index> offsets;
+    offsets.reserve(_local_assemblers.size() + 1);
+    offsets.push_back(0);
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        offsets.push_back(offsets.back() +
+                          local_assembler->getNumberOfIntegrationPoints());
+    }
+    auto const num_integration_points = offsets.back();
+    auto const num_comp_total = _dof_table_boundary->getNumberOfComponents();
+
+    RowMajorMatrix coords(num_integration_points, 3);
+    RowMajorMatrix primary_variables(num_integration_points, num_comp_total);
+    for (std::size_t e = 0; e < _local_assemblers.size(); ++e)
+    {
+        auto const n = offsets[e + 1] - offsets[e];
+        _local_assemblers[e]->getIntegrationPointValues(
+            *_dof_table_boundary, x, coords.middleRows(offsets[e], n),
+            primary_variables.middleRows(offsets[e], n));
+    }
+
+    auto const fluxes_dFluxes =
+        _bc_data.bc_object->getFluxes(t, coords, primary_variables);
+    if (!_bc_data.bc_object->isOverriddenNaturalBatched())
+    {
+        return false;
+    }
+
+    auto const& fluxes = fluxes_dFluxes.first;
+    auto const& dFluxes = fluxes_dFluxes.second;
+    if (fluxes.size() != num_integration_points ||
+        dFluxes.rows() != num_integration_points ||
+        dFluxes.cols() != num_comp_total)
+    {
+        OGS_FATAL(
+            "The Python BC must return the flux and its derivatives w.r.t. "
+            "each primary variable for each of the %d integration points, "
+            "i.e., arrays of the shapes (%d,) and (%d, %d). Arrays of the "
+            "shapes (%d,) and (%d, %d) returned from Python.",
+            static_cast<int>(num_integration_points),
+            static_cast<int>(num_integration_points),
+            static_cast<int>(num_integration_points), num_comp_total,
+            static_cast<int>(fluxes.size()), static_cast<int>(dFluxes.rows()),
+            static_cast<int>(dFluxes.cols()));
+    }
+
+    for (std::size_t e = 0; e < _local_assemblers.size(); ++e)
+    {
+        auto const n = offsets[e + 1] - offsets[e];
+        _local_assemblers[e]->assembleFromFluxes(
+            e, *_dof_table_boundary, fluxes.segment(offsets[e], n),
+            dFluxes.middleRows(offsets[e], n), b, Jac);
+    }
+    return true;
+}
+
 std::unique_ptr<PythonBoundaryCondition> createPythonBoundaryCondition(
     BaseLib::ConfigTree const& config, MeshLib::Mesh const& boundary_mesh,
     NumLib::LocalToGlobalIndexMap const& dof_table, std::size_t bulk_mesh_id,
@@ -12,8 +12,8 @@
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/IndexValueVector.h"
 #include "ProcessLib/BoundaryCondition/BoundaryCondition.h"
-#include "ProcessLib/BoundaryCondition/GenericNaturalBoundaryConditionLocalAssembler.h"
 
+#include "PythonBoundaryConditionLocalAssemblerInterface.h"
 #include "PythonBoundaryConditionPythonSideInterface.h"
 
 namespace ProcessLib
@@ -57,6 +57,13 @@ public:
                         GlobalVector& b, GlobalMatrix* Jac) override;
 
 private:
+    //! Assembles the natural BC of all boundary elements using a single call
+    //! to PythonBoundaryConditionPythonSideInterface::getFluxes().
+    //!
+    //! \return false if getFluxes() is not overridden in Python.
+    bool applyNaturalBCBatched(const double t, const GlobalVector& x,
+                               GlobalVector& b, GlobalMatrix* Jac);
+
     //! Auxiliary data.
     PythonBoundaryConditionData _bc_data;
 
@@ -64,8 +71,7 @@ private:
     std::unique_ptr<NumLib::LocalToGlobalIndexMap> _dof_table_boundary;
 
     //! Local assemblers for all elements of the boundary mesh.
-    std::vector<
-        std::unique_ptr<GenericNaturalBoundaryConditionLocalAssemblerInterface>>
+    std::vector<std::unique_ptr<PythonBoundaryConditionLocalAssemblerInterface>>
         _local_assemblers;
 
     //! Whether or not to flush standard output before and after each call to
@@ -15,6 +15,7 @@
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "ProcessLib/BoundaryCondition/GenericNaturalBoundaryConditionLocalAssembler.h"
 
+#include "PythonBoundaryConditionLocalAssemblerInterface.h"
 #include "PythonBoundaryConditionPythonSideInterface.h"
 
 namespace ProcessLib
@@ -29,7 +30,8 @@ template <typename ShapeFunction, typename IntegrationMethod,
           unsigned GlobalDim>
 class PythonBoundaryConditionLocalAssembler final
     : public GenericNaturalBoundaryConditionLocalAssembler<
-          ShapeFunction, IntegrationMethod, GlobalDim>
+          ShapeFunction, IntegrationMethod, GlobalDim>,
+      public PythonBoundaryConditionLocalAssemblerInterface
 {
     using Base = GenericNaturalBoundaryConditionLocalAssembler<
         ShapeFunction, IntegrationMethod, GlobalDim>;
@@ -49,6 +51,72 @@ public:
                   NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
                   double const t, const GlobalVector& x, GlobalMatrix& /*K*/,
                   GlobalVector& b, GlobalMatrix* Jac) override
+    {
+        unsigned const num_integration_points =
+            getNumberOfIntegrationPoints();
+        auto const num_comp_total =
+            _data.dof_table_bulk.getNumberOfComponents();
+
+        RowMajorMatrix coords(num_integration_points, 3);
+        RowMajorMatrix primary_variables(num_integration_points,
+                                         num_comp_total);
+        getIntegrationPointValues(dof_table_boundary, x, coords,
+                                  primary_variables);
+
+        Eigen::VectorXd fluxes(num_integration_points);
+        RowMajorMatrix dFluxes(num_integration_points, num_comp_total);
+        std::vector<double> prim_vars_data(num_comp_total);
+
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            MathLib::toVector(prim_vars_data) =
+                primary_variables.row(ip).transpose();
+            auto const flag_flux_dFlux = _data.bc_object->getFlux(
+                t, {coords(ip, 0), coords(ip, 1), coords(ip, 2)},
+                prim_vars_data);
+            if (!_data.bc_object->isOverriddenNatural())
+            {
+                // getFlux() is not overridden in Python, so we can skip the
+                // whole BC assembly (i.e., for all boundary elements).
+                throw MethodNotOverriddenInDerivedClassException{};
+            }
+
+            if (!std::get<0>(flag_flux_dFlux))
+            {
+                // No flux value for this integration point. Skip assembly of
+                // the entire element.
+                return;
+            }
+            fluxes[ip] = std::get<1>(flag_flux_dFlux);
+            auto const& dFlux = std::get<2>(flag_flux_dFlux);
+
+            if (static_cast<int>(dFlux.size()) != num_comp_total)
+            {
+                // This strict check is technically mandatory only if a Jacobian
+                // is assembled. However, it is done as a consistency check also
+                // for cases without Jacobian assembly.
+                OGS_FATAL(
+                    "The Python BC must return the derivative of the flux "
+                    "w.r.t. each primary variable. %d components expected. %d "
+                    "components returned from Python.",
+                    num_comp_total, dFlux.size());
+            }
+            dFluxes.row(ip) = MathLib::toVector(dFlux).transpose();
+        }
+
+        assembleFromFluxes(boundary_element_id, dof_table_boundary, fluxes,
+                           dFluxes, b, Jac);
+    }
+
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return Base::_integration_method.getNumberOfPoints();
+    }
+
+    void getIntegrationPointValues(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        const GlobalVector& x, Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> primary_variables) const override
     {
         using ShapeMatricesType =
             ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
@@ -58,7 +126,7 @@ public:
             &this->_element));
 
         unsigned const num_integration_points =
-            Base::_integration_method.getNumberOfPoints();
+            getNumberOfIntegrationPoints();
         auto const num_var = _data.dof_table_bulk.getNumberOfVariables();
         auto const num_nodes = Base::_element.getNumberOfNodes();
         auto const num_comp_total =
@@ -110,51 +178,46 @@ public:
             }
         }
 
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const& N = Base::_ns_and_weights[ip].N;
+            auto const ip_coords = fe.interpolateCoordinates(N);
+            coords.row(ip) << ip_coords[0], ip_coords[1], ip_coords[2];
+            // Assumption: all primary variables have same shape functions.
+            primary_variables.row(ip).noalias() = N * primary_variables_mat;
+        }
+    }
+
+    void assembleFromFluxes(
+        std::size_t const boundary_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        Eigen::Ref<const Eigen::VectorXd> const& fluxes,
+        Eigen::Ref<const RowMajorMatrix> const& dFluxes, GlobalVector& b,
+        GlobalMatrix* Jac) override
+    {
+        if (fluxes.hasNaN())
+        {
+            // No flux value for some integration point. Skip assembly of the
+            // entire element.
+            return;
+        }
+
+        unsigned const num_integration_points =
+            getNumberOfIntegrationPoints();
+        auto const num_nodes = Base::_element.getNumberOfNodes();
+        auto const num_comp_total =
+            _data.dof_table_bulk.getNumberOfComponents();
+
         Eigen::VectorXd local_rhs = Eigen::VectorXd::Zero(num_nodes);
         Eigen::MatrixXd local_Jac =
             Eigen::MatrixXd::Zero(num_nodes, num_nodes * num_comp_total);
-        std::vector<double> prim_vars_data(num_comp_total);
-        auto prim_vars = MathLib::toVector(prim_vars_data);
 
         for (unsigned ip = 0; ip < num_integration_points; ip++)
         {
             auto const& N = Base::_ns_and_weights[ip].N;
             auto const& w = Base::_ns_and_weights[ip].weight;
-            auto const coords = fe.interpolateCoordinates(N);
-            prim_vars =
-                N * primary_variables_mat;  // Assumption: all primary variables
-                                            // have same shape functions.
-            auto const flag_flux_dFlux =
-                _data.bc_object->getFlux(t, coords, prim_vars_data);
-            if (!_data.bc_object->isOverriddenNatural())
-            {
-                // getFlux() is not overridden in Python, so we can skip the
-                // whole BC assembly (i.e., for all boundary elements).
-                throw MethodNotOverriddenInDerivedClassException{};
-            }
 
-            if (!std::get<0>(flag_flux_dFlux))
-            {
-                // No flux value for this integration point. Skip assembly of
-                // the entire element.
-                return;
-            }
-            auto const flux = std::get<1>(flag_flux_dFlux);
-            auto const& dFlux = std::get<2>(flag_flux_dFlux);
-
-            local_rhs.noalias() += N * (flux * w);
-
-            if (static_cast<int>(dFlux.size()) != num_comp_total)
-            {
-                // This strict check is technically mandatory only if a Jacobian
-                // is assembled. However, it is done as a consistency check also
-                // for cases without Jacobian assembly.
-                OGS_FATAL(
-                    "The Python BC must return the derivative of the flux "
-                    "w.r.t. each primary variable. %d components expected. %d "
-                    "components returned from Python.",
-                    num_comp_total, dFlux.size());
-            }
+            local_rhs.noalias() += N * (fluxes[ip] * w);
 
             if (Jac)
             {
@@ -167,7 +230,7 @@ public:
                     // The assignement -= takes into account the sign convention
                     // of 1st-order in time ODE systems in OpenGeoSys.
                     local_Jac.block(top, left, width, height).noalias() -=
-                        N.transpose() * (dFlux[comp] * w) * N;
+                        N.transpose() * (dFluxes(ip, comp) * w) * N;
                 }
             }
         }
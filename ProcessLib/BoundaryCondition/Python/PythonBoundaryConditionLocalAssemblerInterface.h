@@ -0,0 +1,58 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+
+#include "PythonBoundaryConditionPythonSideInterface.h"
+
+namespace ProcessLib
+{
+//! Local assembler interface of the Python BC. Besides the assembly calling
+//! Python for each integration point, it allows to compute the fluxes at the
+//! integration points of many boundary elements with a single call to Python.
+class PythonBoundaryConditionLocalAssemblerInterface
+{
+public:
+    using RowMajorMatrix =
+        PythonBoundaryConditionPythonSideInterface::RowMajorMatrix;
+
+    //! Assembles the BC calling PythonBoundaryConditionPythonSideInterface::
+    //! getFlux() for each integration point.
+    virtual void assemble(
+        std::size_t const id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary, double const t,
+        const GlobalVector& x, GlobalMatrix& K, GlobalVector& b,
+        GlobalMatrix* Jac) = 0;
+
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the coordinates of and the primary variables at the integration
+    //! points of this element to the rows of \c coords and
+    //! \c primary_variables, respectively.
+    virtual void getIntegrationPointValues(
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        const GlobalVector& x, Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> primary_variables) const = 0;
+
+    //! Assembles the BC from the given fluxes and their derivatives w.r.t. the
+    //! primary variables at the integration points of this element. If any of
+    //! the fluxes is NaN, nothing is assembled.
+    virtual void assembleFromFluxes(
+        std::size_t const id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        Eigen::Ref<const Eigen::VectorXd> const& fluxes,
+        Eigen::Ref<const RowMajorMatrix> const& dFluxes, GlobalVector& b,
+        GlobalMatrix* Jac) = 0;
+
+    virtual ~PythonBoundaryConditionLocalAssemblerInterface() = default;
+};
+
+}  // namespace ProcessLib
@@ -9,6 +9,7 @@
 
 #include "PythonBoundaryConditionModule.h"
 
+#include <pybind11/eigen.h>
 #include <pybind11/stl.h>
 
 #include "PythonBoundaryConditionPythonSideInterface.h"
@@ -43,6 +44,25 @@ public:
         PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
                           getFlux, t, x, primary_variables);
     }
+
+    Eigen::VectorXd getDirichletBCValues(
+        double t, RowMajorMatrix const& x, NodeIDs const& node_ids,
+        RowMajorMatrix const& primary_variables) const override
+    {
+        PYBIND11_OVERLOAD(Eigen::VectorXd,
+                          PythonBoundaryConditionPythonSideInterface,
+                          getDirichletBCValues, t, x, node_ids,
+                          primary_variables);
+    }
+
+    std::pair<Eigen::VectorXd, RowMajorMatrix> getFluxes(
+        double t, RowMajorMatrix const& x,
+        RowMajorMatrix const& primary_variables) const override
+    {
+        using Ret = std::pair<Eigen::VectorXd, RowMajorMatrix>;
+        PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
+                          getFluxes, t, x, primary_variables);
+    }
 };
 
 void pythonBindBoundaryCondition(pybind11::module& m)
@@ -58,6 +78,10 @@ void pythonBindBoundaryCondition(pybind11::module& m)
     pybc.def("getDirichletBCValue",
              &PythonBoundaryConditionPythonSideInterface::getDirichletBCValue);
     pybc.def("getFlux", &PythonBoundaryConditionPythonSideInterface::getFlux);
+    pybc.def("getDirichletBCValues",
+             &PythonBoundaryConditionPythonSideInterface::getDirichletBCValues);
+    pybc.def("getFluxes",
+             &PythonBoundaryConditionPythonSideInterface::getFluxes);
 }
 
 }  // namespace ProcessLib
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 //! Base class for boundary conditions.
@@ -17,6 +19,11 @@ namespace ProcessLib
 class PythonBoundaryConditionPythonSideInterface
 {
 public:
+    //! Row-major matrix, which corresponds to a C-contiguous NumPy array.
+    using RowMajorMatrix =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    using NodeIDs = Eigen::Matrix<std::size_t, Eigen::Dynamic, 1>;
+
     /*!
      * Computes Dirichlet boundary condition values for the provided arguments
      * (time, position of the node, node id, primary variables at the node).
@@ -51,6 +58,52 @@ public:
             false, std::numeric_limits<double>::quiet_NaN(), {}};
     }
 
+    /*!
+     * Batched version of getDirichletBCValue() computing the Dirichlet
+     * boundary condition values for many nodes with a single call.
+     *
+     * The i-th row of \c x and of \c primary_variables holds the position
+     * and the primary variables of the node \c node_ids[i], respectively.
+     *
+     * \return the Dirichlet BC value for each node or NaN if no Dirichlet BC
+     * shall be set at that node.
+     *
+     * If this method is overridden in Python, getDirichletBCValue() is not
+     * called.
+     */
+    virtual Eigen::VectorXd getDirichletBCValues(
+        double /*t*/, RowMajorMatrix const& /*x*/, NodeIDs const& /*node_ids*/,
+        RowMajorMatrix const& /*primary_variables*/) const
+    {
+        _overridden_essential_batched = false;
+        return {};
+    }
+
+    /*!
+     * Batched version of getFlux() computing the fluxes for many integration
+     * points with a single call.
+     *
+     * The i-th row of \c x and of \c primary_variables holds the position
+     * of and the primary variables at the i-th integration point,
+     * respectively. The integration points of each boundary element are
+     * contiguous.
+     *
+     * \return a pair (flux, flux_jacobian) with the flux at each integration
+     * point and the derivatives of the flux w.r.t. all primary variables, one
+     * row per integration point. A NaN flux indicates that no natural BC shall
+     * be set at that position. As with getFlux(), the whole boundary element
+     * is skipped then.
+     *
+     * If this method is overridden in Python, getFlux() is not called.
+     */
+    virtual std::pair<Eigen::VectorXd, RowMajorMatrix> getFluxes(
+        double /*t*/, RowMajorMatrix const& /*x*/,
+        RowMajorMatrix const& /*primary_variables*/) const
+    {
+        _overridden_natural_batched = false;
+        return {};
+    }
+
     //! Tells if getDirichletBCValue() has been overridden in the derived class
     //! in Python.
     //!
@@ -63,6 +116,24 @@ public:
     //! \pre getFlux() must already have been called once.
     bool isOverriddenNatural() const { return _overridden_natural; }
 
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python.
+    //!
+    //! \pre getDirichletBCValues() must already have been called once.
+    bool isOverriddenEssentialBatched() const
+    {
+        return _overridden_essential_batched;
+    }
+
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    //!
+    //! \pre getFluxes() must already have been called once.
+    bool isOverriddenNaturalBatched() const
+    {
+        return _overridden_natural_batched;
+    }
+
     virtual ~PythonBoundaryConditionPythonSideInterface() = default;
 
 private:
@@ -71,5 +142,11 @@ private:
     mutable bool _overridden_essential = true;
     //! Tells if getFlux() has been overridden in the derived class in Python.
     mutable bool _overridden_natural = true;
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python.
+    mutable bool _overridden_essential_batched = true;
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    mutable bool _overridden_natural_batched = true;
 };
 }  // namespace ProcessLib
@@ -393,6 +393,14 @@ void CompareJacobiansJacobianAssembler::assembleWithJacobian(
     }
 }
 
+std::unique_ptr<AbstractJacobianAssembler>
+CompareJacobiansJacobianAssembler::copy() const
+{
+    OGS_FATAL(
+        "The CompareJacobiansJacobianAssembler writes all local Jacobians to a "
+        "single log file and cannot be used for multi-threaded assembly.");
+}
+
 std::unique_ptr<CompareJacobiansJacobianAssembler>
 createCompareJacobiansJacobianAssembler(BaseLib::ConfigTree const& config)
 {
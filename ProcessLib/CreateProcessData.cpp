@@ -95,9 +95,16 @@ std::vector<std::unique_ptr<ProcessData>> createPerProcessData(
                 "in the current project file!");
         }
 
+        auto const local_residual_assembly =
+            //! \ogs_file_param{prj__time_loop__processes__process__local_residual_assembly}
+            pcs_config.getConfigParameter<bool>("local_residual_assembly",
+                                                false);
+
         per_process_data.emplace_back(makeProcessData(
             std::move(timestepper), nl_slv, pcs, std::move(time_disc),
             std::move(conv_crit)));
+        per_process_data.back()->local_residual_assembly =
+            local_residual_assembly;
     }
 
     if (per_process_data.size() != processes.size())
@@ -175,7 +175,7 @@ public:
 
         auto const mu =
             liquid_phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars);
+                .scalarValue(vars);
         GlobalDimMatrixType const K_over_mu = K / mu;
 
         auto const p_nodal_values = Eigen::Map<const NodalVectorType>(
@@ -188,7 +188,7 @@ public:
             auto const rho_w =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars);
+                    .scalarValue(vars);
             auto const b = this->_material_properties.specific_body_force;
             q += K_over_mu * rho_w * b;
         }
@@ -325,7 +325,7 @@ protected:
             auto const mu =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars);
+                    .scalarValue(vars);
             GlobalDimMatrixType const K_over_mu = K / mu;
 
             cache_mat.col(ip).noalias() = -K_over_mu * dNdx * p_nodal_values;
@@ -335,7 +335,7 @@ protected:
                 auto const rho_w =
                     liquid_phase
                         .property(MaterialPropertyLib::PropertyType::density)
-                        .template value<double>(vars);
+                        .scalarValue(vars);
                 auto const b = _material_properties.specific_body_force;
                 // here it is assumed that the vector b is directed 'downwards'
                 cache_mat.col(ip).noalias() += K_over_mu * rho_w * b;
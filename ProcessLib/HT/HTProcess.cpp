@@ -121,7 +121,7 @@ void HTProcess::assembleConcreteProcess(const double t,
         _use_monolithic_scheme ? 0 : _coupled_solutions->process_id;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_tables, t, x, M, K, b,
         _coupled_solutions);
@@ -151,7 +151,7 @@ void HTProcess::assembleWithJacobianConcreteProcess(
     const int process_id =
         _use_monolithic_scheme ? 0 : _coupled_solutions->process_id;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, x, xdot,
         dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -121,7 +121,7 @@ public:
             // constant storage model
             auto const specific_storage =
                 solid_phase.property(MaterialPropertyLib::PropertyType::storage)
-                    .template value<double>(vars);
+                    .scalarValue(vars);
 
             auto const& ip_data = this->_ip_data[ip];
             auto const& N = ip_data.N;
@@ -136,7 +136,7 @@ public:
             auto const porosity =
                 solid_phase
                     .property(MaterialPropertyLib::PropertyType::porosity)
-                    .template value<double>(vars);
+                    .scalarValue(vars);
 
             auto const intrinsic_permeability =
                 intrinsicPermeability<GlobalDim>(
@@ -153,18 +153,18 @@ public:
             auto const specific_heat_capacity_fluid =
                 liquid_phase
                     .property(MaterialPropertyLib::specific_heat_capacity)
-                    .template value<double>(vars);
+                    .scalarValue(vars);
 
             // Use the fluid density model to compute the density
             auto const fluid_density =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars);
+                    .scalarValue(vars);
 
             // Use the viscosity model to compute the viscosity
             auto const viscosity = liquid_phase
                     .property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars);
+                    .scalarValue(vars);
             GlobalDimMatrixType K_over_mu = intrinsic_permeability / viscosity;
 
             GlobalDimVectorType const velocity =
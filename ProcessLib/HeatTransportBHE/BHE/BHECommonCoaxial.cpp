@@ -27,7 +27,7 @@ constexpr std::pair<int, int>
 constexpr int BHECommonCoaxial::number_of_grout_zones;
 
 std::array<double, BHECommonCoaxial::number_of_unknowns>
-BHECommonCoaxial::pipeHeatCapacities() const
+BHECommonCoaxial::calcPipeHeatCapacities() const
 {
     double const& rho_r = refrigerant.density;
     double const& specific_heat_capacity = refrigerant.specific_heat_capacity;
@@ -50,7 +50,7 @@ double BHECommonCoaxial::updateFlowRateAndTemperature(double const T_out,
     return values.temperature;
 }
 std::array<double, BHECommonCoaxial::number_of_unknowns>
-BHECommonCoaxial::pipeHeatConductions() const
+BHECommonCoaxial::calcPipeHeatConductions() const
 {
     double const& lambda_r = refrigerant.thermal_conductivity;
     double const& rho_r = refrigerant.density;
@@ -73,7 +73,7 @@ BHECommonCoaxial::pipeHeatConductions() const
 }
 
 std::array<Eigen::Vector3d, BHECommonCoaxial::number_of_unknowns>
-BHECommonCoaxial::pipeAdvectionVectors() const
+BHECommonCoaxial::calcPipeAdvectionVectors() const
 {
     double const& rho_r = refrigerant.density;
     double const& Cp_r = refrigerant.specific_heat_capacity;
@@ -118,6 +118,14 @@ BHECommonCoaxial::calcThermalResistances(double const Nu_inner_pipe,
 
 void BHECommonCoaxial::updateHeatTransferCoefficients(double const flow_rate)
 {
+    // The refrigerant properties are constant, hence the coefficients change
+    // with the flow rate only, which is constant for most flow controls.
+    if (flow_rate == _flow_rate)
+    {
+        return;
+    }
+    _flow_rate = flow_rate;
+
     auto const tm_flow_properties_annulus =
         calculateThermoMechanicalFlowPropertiesAnnulus(_pipes.inner_pipe,
                                                        _pipes.outer_pipe,
@@ -135,6 +143,8 @@ void BHECommonCoaxial::updateHeatTransferCoefficients(double const flow_rate)
     _thermal_resistances =
         calcThermalResistances(tm_flow_properties.nusselt_number,
                                tm_flow_properties_annulus.nusselt_number);
+    _pipe_heat_conductions = calcPipeHeatConductions();
+    _pipe_advection_vectors = calcPipeAdvectionVectors();
 }
 }  // namespace BHE
 }  // namespace HeatTransportBHE
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include <Eigen/Eigen>
 #include "BHECommon.h"
 #include "FlowAndTemperatureControl.h"
@@ -36,6 +38,7 @@ public:
             _pipes.outer_pipe.area() - _pipes.inner_pipe.outsideArea();
         cross_section_area_grout =
             borehole_geometry.area() - _pipes.outer_pipe.outsideArea();
+        _pipe_heat_capacities = calcPipeHeatCapacities();
     }
 
     static constexpr int number_of_unknowns = 3;
@@ -51,15 +54,27 @@ public:
     std::array<double, number_of_unknowns> calcThermalResistances(
         double const Nu_inner_pipe, double const Nu_annulus_pipe);
 
-    std::array<double, number_of_unknowns> pipeHeatCapacities() const;
+    /// The pipe coefficients are evaluated from the refrigerant and grout
+    /// properties whenever the flow rate changes and are cached in between,
+    /// i.e., they are not recomputed for each element and time step.
+    std::array<double, number_of_unknowns> const& pipeHeatCapacities() const
+    {
+        return _pipe_heat_capacities;
+    }
 
     static constexpr std::pair<int, int> inflow_outflow_bc_component_ids[] = {
         {0, 1}};
 
-    std::array<double, number_of_unknowns> pipeHeatConductions() const;
+    std::array<double, number_of_unknowns> const& pipeHeatConductions() const
+    {
+        return _pipe_heat_conductions;
+    }
 
-    std::array<Eigen::Vector3d, number_of_unknowns> pipeAdvectionVectors()
-        const;
+    std::array<Eigen::Vector3d, number_of_unknowns> const&
+    pipeAdvectionVectors() const
+    {
+        return _pipe_advection_vectors;
+    }
 
     double cross_section_area_inner_pipe, cross_section_area_annulus,
         cross_section_area_grout;
@@ -67,6 +82,13 @@ public:
 protected:
     void updateHeatTransferCoefficients(double const flow_rate);
 
+    std::array<double, number_of_unknowns> calcPipeHeatCapacities() const;
+
+    std::array<double, number_of_unknowns> calcPipeHeatConductions() const;
+
+    std::array<Eigen::Vector3d, number_of_unknowns> calcPipeAdvectionVectors()
+        const;
+
     PipeConfigurationCoaxial const _pipes;
 
     virtual std::array<double, 2> velocities() const = 0;
@@ -83,6 +105,14 @@ protected:
 
     /// Flow velocity inside the pipes and annulus. Depends on the flow_rate.
     double _flow_velocity_inner, _flow_velocity_annulus;
+
+    /// The flow rate for which the heat transfer coefficients were computed
+    /// last.
+    double _flow_rate = std::numeric_limits<double>::quiet_NaN();
+
+    std::array<double, number_of_unknowns> _pipe_heat_capacities;
+    std::array<double, number_of_unknowns> _pipe_heat_conductions;
+    std::array<Eigen::Vector3d, number_of_unknowns> _pipe_advection_vectors;
 };
 }  // namespace BHE
 }  // namespace HeatTransportBHE
@@ -28,7 +28,8 @@ BHE_1U::BHE_1U(BoreholeGeometry const& borehole,
                FlowAndTemperatureControl const& flowAndTemperatureControl,
                PipeConfiguration1U const& pipes)
     : BHECommon{borehole, refrigerant, grout, flowAndTemperatureControl},
-      _pipes(pipes)
+      _pipes(pipes),
+      _pipe_heat_capacities(calcPipeHeatCapacities())
 {
     // Initialize thermal resistances.
     auto values = apply_visitor(
@@ -40,8 +41,8 @@ BHE_1U::BHE_1U(BoreholeGeometry const& borehole,
     updateHeatTransferCoefficients(values.flow_rate);
 }
 
-std::array<double, BHE_1U::number_of_unknowns> BHE_1U::pipeHeatCapacities()
-    const
+std::array<double, BHE_1U::number_of_unknowns>
+BHE_1U::calcPipeHeatCapacities() const
 {
     double const& rho_r = refrigerant.density;
     double const& specific_heat_capacity = refrigerant.specific_heat_capacity;
@@ -55,8 +56,8 @@ std::array<double, BHE_1U::number_of_unknowns> BHE_1U::pipeHeatCapacities()
              /*g2*/ (1.0 - porosity_g) * rho_g * heat_cap_g}};
 }
 
-std::array<double, BHE_1U::number_of_unknowns> BHE_1U::pipeHeatConductions()
-    const
+std::array<double, BHE_1U::number_of_unknowns>
+BHE_1U::calcPipeHeatConductions() const
 {
     double const& lambda_r = refrigerant.thermal_conductivity;
     double const& rho_r = refrigerant.density;
@@ -82,7 +83,7 @@ std::array<double, BHE_1U::number_of_unknowns> BHE_1U::pipeHeatConductions()
 }
 
 std::array<Eigen::Vector3d, BHE_1U::number_of_unknowns>
-BHE_1U::pipeAdvectionVectors() const
+BHE_1U::calcPipeAdvectionVectors() const
 {
     double const& rho_r = refrigerant.density;
     double const& Cp_r = refrigerant.specific_heat_capacity;
@@ -168,14 +169,23 @@ std::pair<double, double> thermalResistancesGroutSoil(double chi,
 constexpr std::pair<int, int> BHE_1U::inflow_outflow_bc_component_ids[];
 
 void BHE_1U::updateHeatTransferCoefficients(double const flow_rate)
-
 {
+    // The refrigerant properties are constant, hence the coefficients change
+    // with the flow rate only, which is constant for most flow controls.
+    if (flow_rate == _flow_rate)
+    {
+        return;
+    }
+    _flow_rate = flow_rate;
+
     auto const tm_flow_properties = calculateThermoMechanicalFlowPropertiesPipe(
         _pipes.inlet, borehole_geometry.length, refrigerant, flow_rate);
 
     _flow_velocity = tm_flow_properties.velocity;
     _thermal_resistances =
         calcThermalResistances(tm_flow_properties.nusselt_number);
+    _pipe_heat_conductions = calcPipeHeatConductions();
+    _pipe_advection_vectors = calcPipeAdvectionVectors();
 }
 
 /// Nu is the Nusselt number.
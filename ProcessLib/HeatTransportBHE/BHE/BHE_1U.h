@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include <Eigen/Eigen>
 
 #include "BaseLib/Error.h"
@@ -48,12 +50,24 @@ public:
     static constexpr int number_of_unknowns = 4;
     static constexpr int number_of_grout_zones = 2;
 
-    std::array<double, number_of_unknowns> pipeHeatCapacities() const;
+    /// The pipe coefficients are evaluated from the refrigerant and grout
+    /// properties whenever the flow rate changes and are cached in between,
+    /// i.e., they are not recomputed for each element and time step.
+    std::array<double, number_of_unknowns> const& pipeHeatCapacities() const
+    {
+        return _pipe_heat_capacities;
+    }
 
-    std::array<double, number_of_unknowns> pipeHeatConductions() const;
+    std::array<double, number_of_unknowns> const& pipeHeatConductions() const
+    {
+        return _pipe_heat_conductions;
+    }
 
-    std::array<Eigen::Vector3d, number_of_unknowns> pipeAdvectionVectors()
-        const;
+    std::array<Eigen::Vector3d, number_of_unknowns> const&
+    pipeAdvectionVectors() const
+    {
+        return _pipe_advection_vectors;
+    }
 
     template <int NPoints,
               typename SingleUnknownMatrixType,
@@ -150,6 +164,13 @@ public:
 private:
     void updateHeatTransferCoefficients(double const flow_rate);
 
+    std::array<double, number_of_unknowns> calcPipeHeatCapacities() const;
+
+    std::array<double, number_of_unknowns> calcPipeHeatConductions() const;
+
+    std::array<Eigen::Vector3d, number_of_unknowns> calcPipeAdvectionVectors()
+        const;
+
     std::array<double, number_of_unknowns> calcThermalResistances(
         double const Nu);
 
@@ -164,6 +185,14 @@ private:
 
     /// Flow velocity inside the pipes. Depends on the flow_rate.
     double _flow_velocity;
+
+    /// The flow rate for which the heat transfer coefficients were computed
+    /// last.
+    double _flow_rate = std::numeric_limits<double>::quiet_NaN();
+
+    std::array<double, number_of_unknowns> _pipe_heat_capacities;
+    std::array<double, number_of_unknowns> _pipe_heat_conductions;
+    std::array<Eigen::Vector3d, number_of_unknowns> _pipe_advection_vectors;
 };
 }  // namespace BHE
 }  // namespace HeatTransportBHE
@@ -10,6 +10,8 @@
 #include "HeatTransportBHEProcess.h"
 
 #include <cassert>
+
+#include "NumLib/Assembler/ElementColoring.h"
 #include "ProcessLib/HeatTransportBHE/BHE/MeshUtils.h"
 #include "ProcessLib/HeatTransportBHE/LocalAssemblers/CreateLocalAssemblers.h"
 
@@ -170,7 +172,7 @@ void HeatTransportBHEProcess::assembleConcreteProcess(const double t,
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b,
         _coupled_solutions);
@@ -197,6 +199,58 @@ void HeatTransportBHEProcess::computeSecondaryVariableConcrete(
         getDOFTable(process_id), t, x, _coupled_solutions);
 }
 
+std::vector<std::size_t> HeatTransportBHEProcess::computeAssemblyElementColors()
+    const
+{
+    auto const& elements = _mesh.getElements();
+    std::vector<bool> is_bhe_element(elements.size(), false);
+    for (auto const& bhe_elements : _bheMeshData.BHE_elements)
+    {
+        for (auto const* e : bhe_elements)
+        {
+            is_bhe_element[e->getID()] = true;
+        }
+    }
+
+    std::vector<MeshLib::Element*> soil_elements;
+    soil_elements.reserve(elements.size());
+    std::copy_if(begin(elements), end(elements),
+                 std::back_inserter(soil_elements),
+                 [&](auto const* e) { return !is_bhe_element[e->getID()]; });
+
+    std::vector<std::size_t> colors(elements.size(), NumLib::no_element_color);
+    std::size_t number_of_colors =
+        NumLib::colorElements(soil_elements, 0, colors);
+
+    // The BHE elements grouped by the BHE type given by the index of the type
+    // in the BHE::BHETypes variant.
+    std::vector<std::vector<MeshLib::Element*>> bhe_elements_by_type;
+    int const n_BHEs = _process_data._vec_BHE_property.size();
+    for (int i = 0; i < n_BHEs; i++)
+    {
+        auto const type = static_cast<std::size_t>(
+            _process_data._vec_BHE_property[i].which());
+        if (type >= bhe_elements_by_type.size())
+        {
+            bhe_elements_by_type.resize(type + 1);
+        }
+        auto const& bhe_elements = _bheMeshData.BHE_elements[i];
+        bhe_elements_by_type[type].insert(bhe_elements_by_type[type].end(),
+                                          bhe_elements.begin(),
+                                          bhe_elements.end());
+    }
+
+    for (auto const& bhe_elements : bhe_elements_by_type)
+    {
+        number_of_colors =
+            NumLib::colorElements(bhe_elements, number_of_colors, colors);
+    }
+
+    DBUG("Colored the HeatTransportBHE elements with %d colors.",
+         number_of_colors);
+    return colors;
+}
+
 void HeatTransportBHEProcess::createBHEBoundaryConditionTopBottom(
     std::vector<std::vector<MeshLib::Node*>> const& all_bhe_nodes)
 {
@@ -61,6 +61,12 @@ private:
         const double dxdot_dx, const double dx_dx, GlobalMatrix& M,
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac) override;
 
+    /// Colors the soil elements first and then the BHE elements grouped by
+    /// the BHE type, such that the elements of one color share the local
+    /// assembler type. Since different BHEs do not share nodes, each BHE type
+    /// needs only a few colors containing the elements of all its BHEs.
+    std::vector<std::size_t> computeAssemblyElementColors() const override;
+
     void createBHEBoundaryConditionTopBottom(
         std::vector<std::vector<MeshLib::Node*>> const& all_bhe_nodes);
 
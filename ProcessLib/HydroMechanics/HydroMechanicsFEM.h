@@ -69,6 +69,13 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        eps = eps_prev;
+        sigma_eff = sigma_eff_prev;
+        material_state_variables->popState();
+    }
+
     template <typename DisplacementVectorType>
     typename BMatricesType::KelvinMatrixType updateConstitutiveRelation(
         double const t,
@@ -77,18 +84,15 @@ struct IntegrationPointData final
         DisplacementVectorType const& /*u*/,
         double const T)
     {
-        auto&& solution = solid_material.integrateStress(
-            t, x_position, dt, eps_prev, eps, sigma_eff_prev,
-            *material_state_variables, T);
-
-        if (!solution)
+        // The material state is updated in place.
+        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+        if (!solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_prev, eps, sigma_eff_prev,
+                *material_state_variables, T, sigma_eff, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma_eff, material_state_variables, C) = std::move(*solution);
-
         return C;
     }
 
@@ -168,6 +172,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
     void computeSecondaryVariableConcrete(
         double const t, std::vector<double> const& local_x) override;
     void postNonLinearSolverConcrete(std::vector<double> const& local_x,
@@ -283,7 +283,7 @@ void HydroMechanicsProcess<DisplacementDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
+    _assembly_executor.executeMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         dof_table, t, x, M, K, b, _coupled_solutions);
 }
@@ -330,7 +330,7 @@ void HydroMechanicsProcess<DisplacementDim>::
         _use_monolithic_scheme ? 0 : _coupled_solutions->process_id;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, x,
         xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -380,6 +380,18 @@ void HydroMechanicsProcess<DisplacementDim>::preTimestepConcreteProcess(
     }
 }
 
+template <int DisplacementDim>
+void HydroMechanicsProcess<DisplacementDim>::rollbackTimestepConcreteProcess(
+    GlobalVector const& /*x*/, int const /*process_id*/)
+{
+    DBUG("Rollback time step HydroMechanicsProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
 template <int DisplacementDim>
 void HydroMechanicsProcess<DisplacementDim>::postTimestepConcreteProcess(
     GlobalVector const& x, const double /*t*/, const double /*delta_t*/,
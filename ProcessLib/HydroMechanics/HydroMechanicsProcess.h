@@ -85,6 +85,9 @@ private:
                                     double const dt,
                                     const int process_id) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
     void postTimestepConcreteProcess(GlobalVector const& x, const double t,
                                      const double delta_t,
                                      int const process_id) override;
@@ -563,7 +563,7 @@ void HydroMechanicsProcess<GlobalDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
+    _assembly_executor.executeMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         dof_table, t, x, M, K, b, _coupled_solutions);
 }
@@ -583,7 +583,7 @@ void HydroMechanicsProcess<GlobalDim>::assembleWithJacobianConcreteProcess(
     // Call global assembler for each local assembly item.
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
        dof_table = {std::ref(*_local_to_global_index_map)};
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t, x,
         xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -616,6 +616,18 @@ void HydroMechanicsProcess<GlobalDim>::preTimestepConcreteProcess(
         x, t, dt);
 }
 
+template <int GlobalDim>
+void HydroMechanicsProcess<GlobalDim>::rollbackTimestepConcreteProcess(
+    GlobalVector const& /*x*/, int const /*process_id*/)
+{
+    DBUG("Rollback time step HydroMechanicsProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
 // ------------------------------------------------------------------------------------
 // template instantiation
 // ------------------------------------------------------------------------------------
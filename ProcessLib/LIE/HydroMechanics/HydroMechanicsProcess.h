@@ -75,6 +75,9 @@ private:
                                     double const dt,
                                     const int /*process_id*/) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
 private:
     HydroMechanicsProcessData<GlobalDim> _process_data;
 
@@ -56,6 +56,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& data : _ip_data)
+        {
+            data.popState();
+        }
+    }
+
     void computeSecondaryVariableConcreteWithVector(
         const double t, Eigen::VectorXd const& local_x) override;
 
@@ -113,6 +113,10 @@ public:
         computeSecondaryVariableConcreteWithVector(t, _local_u);
     }
 
+    /// Resets the material state of all integration points to the state of
+    /// the beginning of the time step after the time step has been rejected.
+    virtual void popState() = 0;
+
 protected:
     virtual void assembleWithJacobianConcrete(double const t,
                                               Eigen::VectorXd const& local_u,
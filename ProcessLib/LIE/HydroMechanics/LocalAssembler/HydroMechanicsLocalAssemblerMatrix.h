@@ -57,6 +57,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& data : _ip_data)
+        {
+            data.popState();
+        }
+    }
+
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
@@ -58,6 +58,12 @@ struct IntegrationPointDataFracture final
         sigma_eff_prev = sigma_eff;
     }
 
+    void popState()
+    {
+        w = w_prev;
+        sigma_eff = sigma_eff_prev;
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
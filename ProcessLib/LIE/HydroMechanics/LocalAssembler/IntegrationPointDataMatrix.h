@@ -61,6 +61,13 @@ struct IntegrationPointDataMatrix final
         material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        eps = eps_prev;
+        sigma_eff = sigma_eff_prev;
+        material_state_variables->popState();
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
@@ -55,6 +55,14 @@ struct IntegrationPointDataFracture final
         _material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        _w = _w_prev;
+        _sigma = _sigma_prev;
+        _aperture = _aperture_prev;
+        _material_state_variables->popState();
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
@@ -53,6 +53,13 @@ struct IntegrationPointDataMatrix final
         _material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        _eps = _eps_prev;
+        _sigma = _sigma_prev;
+        _material_state_variables->popState();
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
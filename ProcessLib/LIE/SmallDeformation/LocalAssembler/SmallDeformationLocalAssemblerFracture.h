@@ -91,6 +91,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
     void computeSecondaryVariableConcreteWithVector(
         const double t, Eigen::VectorXd const& local_x) override;
 
@@ -177,6 +177,10 @@ public:
         NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
         std::vector<double>& cache) const = 0;
 
+    /// Resets the material state of all integration points to the state of
+    /// the beginning of the time step after the time step has been rejected.
+    virtual void popState() = 0;
+
 protected:
     virtual void computeSecondaryVariableConcreteWithVector(
         double const t, Eigen::VectorXd const& local_u) = 0;
@@ -90,6 +90,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
     void computeSecondaryVariableConcreteWithVector(
         double const t, Eigen::VectorXd const& local_x) override;
 
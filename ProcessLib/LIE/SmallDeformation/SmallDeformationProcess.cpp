@@ -551,7 +551,7 @@ void SmallDeformationProcess<DisplacementDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b,
         _coupled_solutions);
@@ -573,7 +573,7 @@ void SmallDeformationProcess<DisplacementDim>::
 
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t,
         x, xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -594,6 +594,18 @@ void SmallDeformationProcess<DisplacementDim>::preTimestepConcreteProcess(
         _local_assemblers, pv.getActiveElementIDs(),
         *_local_to_global_index_map, x, t, dt);
 }
+
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::rollbackTimestepConcreteProcess(
+    GlobalVector const& /*x*/, int const /*process_id*/)
+{
+    DBUG("Rollback time step SmallDeformationProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
 // ------------------------------------------------------------------------------------
 // template instantiation
 // ------------------------------------------------------------------------------------
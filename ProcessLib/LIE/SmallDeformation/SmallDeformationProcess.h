@@ -72,6 +72,9 @@ private:
                                     double const dt,
                                     const int /*process_id*/) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
 private:
     SmallDeformationProcessData<DisplacementDim> _process_data;
 
@@ -0,0 +1,130 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BackgroundOutputWriter.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/IO/VtkIO/PVDFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Properties.h"
+#include "ProcessOutput.h"
+
+namespace ProcessLib
+{
+BackgroundOutputWriter::BackgroundOutputWriter(
+    std::size_t const max_pending_outputs, bool const compress_output,
+    int const data_mode)
+    : _max_pending_outputs(max_pending_outputs),
+      _compress_output(compress_output),
+      _data_mode(data_mode)
+{
+    assert(_max_pending_outputs > 0);
+    _thread = std::thread(&BackgroundOutputWriter::run, this);
+}
+
+BackgroundOutputWriter::~BackgroundOutputWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _job_queued.notify_one();
+    _thread.join();
+}
+
+void BackgroundOutputWriter::write(std::string file_path,
+                                   MeshLib::Mesh const& mesh,
+                                   MeshLib::IO::PVDFile* const pvd_file,
+                                   std::string vtu_file_name, double const t)
+{
+    std::unique_ptr<MeshLib::Properties> staging_properties;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _job_done.wait(lock, [this] {
+            return _number_of_pending_outputs < _max_pending_outputs;
+        });
+
+        auto const it = std::find_if(
+            _free_staging_properties.begin(), _free_staging_properties.end(),
+            [&mesh](auto const& free_properties) {
+                return free_properties.first == &mesh;
+            });
+        if (it != _free_staging_properties.end())
+        {
+            staging_properties = std::move(it->second);
+            _free_staging_properties.erase(it);
+        }
+    }
+
+    // The staging properties are not accessed by the background thread, hence
+    // the snapshot can be taken without holding the lock.
+    if (staging_properties)
+    {
+        *staging_properties = mesh.getProperties();
+    }
+    else
+    {
+        staging_properties =
+            std::make_unique<MeshLib::Properties>(mesh.getProperties());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back({&mesh, std::move(staging_properties),
+                         std::move(file_path), pvd_file,
+                         std::move(vtu_file_name), t});
+        _number_of_pending_outputs++;
+    }
+    _job_queued.notify_one();
+}
+
+void BackgroundOutputWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _job_done.wait(lock, [this] { return _number_of_pending_outputs == 0; });
+}
+
+void BackgroundOutputWriter::run()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _job_queued.wait(lock, [this] { return _stop || !_jobs.empty(); });
+            if (_jobs.empty())
+            {
+                return;  // Stopped and all jobs are done.
+            }
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+
+        makeOutput(job.file_path, *job.mesh, *job.staging_properties,
+                   _compress_output, _data_mode);
+        if (job.pvd_file != nullptr)
+        {
+            job.pvd_file->addVTUFile(job.vtu_file_name, job.t);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _free_staging_properties.emplace_back(
+                job.mesh, std::move(job.staging_properties));
+            _number_of_pending_outputs--;
+        }
+        _job_done.notify_all();
+    }
+}
+
+}  // namespace ProcessLib
@@ -0,0 +1,110 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+class Properties;
+
+namespace IO
+{
+class PVDFile;
+}  // namespace IO
+}  // namespace MeshLib
+
+namespace ProcessLib
+{
+/*! Writes VTU files and updates the corresponding PVD files on a background
+ * thread.
+ *
+ * When an output is queued, the mesh properties are copied into staging
+ * properties, such that the caller can continue modifying them. The nodes and
+ * elements are not copied but read from the mesh when the output is written;
+ * they must not change before. The staging properties are reused for
+ * subsequent outputs of the same mesh. The outputs are written one after
+ * another in the order they have been queued, which keeps the PVD files
+ * ordered.
+ */
+class BackgroundOutputWriter final
+{
+public:
+    /// \param max_pending_outputs maximum number of queued outputs not yet
+    ///        written. Queueing another output blocks until one of them has
+    ///        been written. This also bounds the number of staging properties
+    ///        kept per mesh.
+    /// \param compress_output     enables zlib-compression of the VTU files.
+    /// \param data_mode           vtk's data mode, cf.
+    ///                            Output::_output_file_data_mode.
+    BackgroundOutputWriter(std::size_t const max_pending_outputs,
+                           bool const compress_output, int const data_mode);
+
+    BackgroundOutputWriter(BackgroundOutputWriter const&) = delete;
+    BackgroundOutputWriter& operator=(BackgroundOutputWriter const&) = delete;
+
+    /// Writes all pending outputs before returning.
+    ~BackgroundOutputWriter();
+
+    /// Queues writing \c mesh with a snapshot of its properties to
+    /// \c file_path.
+    /// If \c pvd_file is given, the file \c vtu_file_name with time \c t is
+    /// added to it after the VTU file has been written.
+    void write(std::string file_path, MeshLib::Mesh const& mesh,
+               MeshLib::IO::PVDFile* const pvd_file = nullptr,
+               std::string vtu_file_name = "", double const t = 0);
+
+    /// Blocks until all queued outputs have been written.
+    void flush();
+
+private:
+    struct Job
+    {
+        MeshLib::Mesh const* mesh;
+        std::unique_ptr<MeshLib::Properties> staging_properties;
+        std::string file_path;
+        MeshLib::IO::PVDFile* pvd_file;
+        std::string vtu_file_name;
+        double t;
+    };
+
+    void run();
+
+    std::size_t const _max_pending_outputs;
+    bool const _compress_output;
+    int const _data_mode;
+
+    std::mutex _mutex;
+    //! Signals new jobs or the end of the writer to the background thread.
+    std::condition_variable _job_queued;
+    //! Signals finished jobs to the queueing thread.
+    std::condition_variable _job_done;
+
+    std::deque<Job> _jobs;
+    //! Number of queued jobs including the one being written.
+    std::size_t _number_of_pending_outputs = 0;
+    //! Staging properties not used by any pending job with their meshes.
+    std::vector<std::pair<MeshLib::Mesh const*,
+                          std::unique_ptr<MeshLib::Properties>>>
+        _free_staging_properties;
+    bool _stop = false;
+
+    std::thread _thread;
+};
+
+}  // namespace ProcessLib
@@ -131,11 +131,22 @@ std::unique_ptr<Output> createOutput(
         //! \ogs_file_param{prj__time_loop__output__output_iteration_results}
         config.getConfigParameter<bool>("output_iteration_results", false);
 
+    auto const asynchronous_output_queue_size =
+        //! \ogs_file_param{prj__time_loop__output__asynchronous_output_queue_size}
+        config.getConfigParameter<std::size_t>(
+            "asynchronous_output_queue_size", 0);
+    if (asynchronous_output_queue_size > 0)
+    {
+        INFO("Writing output asynchronously with at most %d pending outputs.",
+             asynchronous_output_queue_size);
+    }
+
     return std::make_unique<Output>(
         output_directory, prefix, compress_output, data_mode,
         output_iteration_results, std::move(repeats_each_steps),
         std::move(fixed_output_times), std::move(process_output),
-        std::move(mesh_names_for_output), meshes);
+        std::move(mesh_names_for_output), meshes,
+        asynchronous_output_queue_size);
 }
 
 }  // namespace ProcessLib
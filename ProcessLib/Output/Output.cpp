@@ -99,7 +99,8 @@ Output::Output(std::string output_directory, std::string prefix,
                std::vector<double>&& fixed_output_times,
                ProcessOutput&& process_output,
                std::vector<std::string>&& mesh_names_for_output,
-               std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes)
+               std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes,
+               std::size_t const asynchronous_output_queue_size)
     : _output_directory(std::move(output_directory)),
       _output_file_prefix(std::move(prefix)),
       _output_file_compression(compress_output),
@@ -111,6 +112,12 @@ Output::Output(std::string output_directory, std::string prefix,
       _mesh_names_for_output(mesh_names_for_output),
       _meshes(meshes)
 {
+    if (asynchronous_output_queue_size > 0)
+    {
+        _background_writer = std::make_unique<BackgroundOutputWriter>(
+            asynchronous_output_queue_size, _output_file_compression,
+            _output_file_data_mode);
+    }
 }
 
 void Output::addProcess(ProcessLib::Process const& process,
@@ -124,6 +131,62 @@ void Output::addProcess(ProcessLib::Process const& process,
                                      std::forward_as_tuple(filename));
 }
 
+void Output::writeCheckpoint(std::ostream& out)
+{
+    if (_background_writer)
+    {
+        _background_writer->flush();
+    }
+
+    BaseLib::writeVectorBinary(out, _fixed_output_times);
+    BaseLib::writeValueBinary(
+        out, static_cast<std::uint64_t>(_process_to_process_data.size()));
+    for (auto const& process_data : _process_to_process_data)
+    {
+        auto const& datasets = process_data.second.pvd_file.getDataSets();
+        BaseLib::writeValueBinary(out,
+                                  static_cast<std::uint64_t>(datasets.size()));
+        for (auto const& dataset : datasets)
+        {
+            BaseLib::writeValueBinary(out, dataset.first);
+            BaseLib::writeVectorBinary(
+                out,
+                std::vector<char>(dataset.second.begin(), dataset.second.end()));
+        }
+    }
+}
+
+void Output::readCheckpoint(std::istream& in)
+{
+    _fixed_output_times = BaseLib::readBinaryVector<double>(in);
+    auto const number_of_process_data =
+        BaseLib::readBinaryValue<std::uint64_t>(in);
+    if (!in || number_of_process_data != _process_to_process_data.size())
+    {
+        OGS_FATAL(
+            "The output state in the checkpoint does not match the %d output "
+            "processes.",
+            static_cast<int>(_process_to_process_data.size()));
+    }
+
+    for (auto& process_data : _process_to_process_data)
+    {
+        std::vector<std::pair<double, std::string>> datasets(
+            BaseLib::readBinaryValue<std::uint64_t>(in));
+        for (auto& dataset : datasets)
+        {
+            dataset.first = BaseLib::readBinaryValue<double>(in);
+            auto const file_name = BaseLib::readBinaryVector<char>(in);
+            dataset.second.assign(file_name.begin(), file_name.end());
+        }
+        if (!in)
+        {
+            OGS_FATAL("Could not read the output state from the checkpoint.");
+        }
+        process_data.second.pvd_file.setDataSets(std::move(datasets));
+    }
+}
+
 // TODO return a reference.
 Output::ProcessData* Output::findProcessData(Process const& process,
                                              const int process_id)
@@ -159,13 +222,16 @@ void Output::doOutputAlways(Process const& process,
     BaseLib::RunTime time_output;
     time_output.start();
 
+    ProcessData* process_data = findProcessData(process, process_id);
+
     bool output_secondary_variable = true;
     // Need to add variables of process to vtu even no output takes place.
     processOutputData(t, x, process.getMesh(), process.getDOFTable(process_id),
                       process.getProcessVariables(process_id),
                       process.getSecondaryVariables(),
                       output_secondary_variable,
-                      process.getIntegrationPointWriter(), _process_output);
+                      process.getIntegrationPointWriter(), _process_output,
+                      &process_data->bulk_mesh_gather_lists);
 
     // For the staggered scheme for the coupling, only the last process, which
     // gives the latest solution within a coupling loop, is allowed to make
@@ -184,11 +250,18 @@ void Output::doOutputAlways(Process const& process,
 
     DBUG("output to %s", output_file_path.c_str());
 
-    ProcessData* process_data = findProcessData(process, process_id);
-    process_data->pvd_file.addVTUFile(output_file_name, t);
+    if (_background_writer)
+    {
+        _background_writer->write(output_file_path, process.getMesh(),
+                                  &process_data->pvd_file, output_file_name, t);
+    }
+    else
+    {
+        process_data->pvd_file.addVTUFile(output_file_name, t);
 
-    makeOutput(output_file_path, process.getMesh(), _output_file_compression,
-               _output_file_data_mode);
+        makeOutput(output_file_path, process.getMesh(),
+                   _output_file_compression, _output_file_data_mode);
+    }
 
     for (auto const& mesh_output_name : _mesh_names_for_output)
     {
@@ -203,22 +276,27 @@ void Output::doOutputAlways(Process const& process,
             },
             "Need mesh '" + mesh_output_name + "' for the output.");
 
-        std::vector<MeshLib::Node*> const& nodes = mesh.getNodes();
-        DBUG(
-            "Found %d nodes for output at mesh '%s'.",
-            nodes.size(), mesh.getName().c_str());
-
-        MeshLib::MeshSubset mesh_subset(mesh, nodes);
-        std::unique_ptr<NumLib::LocalToGlobalIndexMap> mesh_dof_table(
-            process.getDOFTable(process_id)
-                .deriveBoundaryConstrainedMap(std::move(mesh_subset)));
+        auto& mesh_output_data =
+            process_data->mesh_output_data[mesh_output_name];
+        if (!mesh_output_data.dof_table)
+        {
+            std::vector<MeshLib::Node*> const& nodes = mesh.getNodes();
+            DBUG("Found %d nodes for output at mesh '%s'.", nodes.size(),
+                 mesh.getName().c_str());
+
+            MeshLib::MeshSubset mesh_subset(mesh, nodes);
+            mesh_output_data.dof_table =
+                process.getDOFTable(process_id)
+                    .deriveBoundaryConstrainedMap(std::move(mesh_subset));
+        }
 
         output_secondary_variable = false;
-        processOutputData(t, x, mesh, *mesh_dof_table,
+        processOutputData(t, x, mesh, *mesh_output_data.dof_table,
                           process.getProcessVariables(process_id),
                           process.getSecondaryVariables(),
                           output_secondary_variable,
-                          process.getIntegrationPointWriter(), _process_output);
+                          process.getIntegrationPointWriter(), _process_output,
+                          &mesh_output_data.gather_lists);
 
         std::string const mesh_output_file_name =
             constructFileName(mesh.getName(), process_id, timestep, t) + ".vtu";
@@ -231,8 +309,15 @@ void Output::doOutputAlways(Process const& process,
         // output is mesh related instead of process related. This would also
         // allow for merging bulk mesh output and arbitrary mesh output.
 
-        makeOutput(mesh_output_file_path, mesh, _output_file_compression,
-                   _output_file_data_mode);
+        if (_background_writer)
+        {
+            _background_writer->write(mesh_output_file_path, mesh);
+        }
+        else
+        {
+            makeOutput(mesh_output_file_path, mesh, _output_file_compression,
+                       _output_file_data_mode);
+        }
     }
     INFO("[time] Output of timestep %d took %g s.", timestep,
          time_output.elapsed());
@@ -284,12 +369,15 @@ void Output::doOutputNonlinearIteration(Process const& process,
     BaseLib::RunTime time_output;
     time_output.start();
 
+    ProcessData* process_data = findProcessData(process, process_id);
+
     bool const output_secondary_variable = true;
     processOutputData(t, x, process.getMesh(), process.getDOFTable(process_id),
                       process.getProcessVariables(process_id),
                       process.getSecondaryVariables(),
                       output_secondary_variable,
-                      process.getIntegrationPointWriter(), _process_output);
+                      process.getIntegrationPointWriter(), _process_output,
+                      &process_data->bulk_mesh_gather_lists);
 
     // For the staggered scheme for the coupling, only the last process, which
     // gives the latest solution within a coupling loop, is allowed to make
@@ -300,9 +388,6 @@ void Output::doOutputNonlinearIteration(Process const& process,
         return;
     }
 
-    // Only check whether a process data is available for output.
-    findProcessData(process, process_id);
-
     std::string const output_file_name =
         constructFileName(_output_file_prefix, process_id, timestep, t) +
         "_nliter_" + std::to_string(iteration) + ".vtu";
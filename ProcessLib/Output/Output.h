@@ -9,10 +9,14 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <map>
+#include <memory>
 #include <utility>
 
+#include "BackgroundOutputWriter.h"
 #include "MeshLib/IO/VtkIO/PVDFile.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "ProcessOutput.h"
 
 namespace ProcessLib
@@ -46,7 +50,8 @@ public:
            std::vector<double>&& fixed_output_times,
            ProcessOutput&& process_output,
            std::vector<std::string>&& mesh_names_for_output,
-           std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes);
+           std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes,
+           std::size_t const asynchronous_output_queue_size = 0);
 
     //! TODO doc. Opens a PVD file for each process.
     void addProcess(ProcessLib::Process const& process, const int process_id);
@@ -80,6 +85,15 @@ public:
 
     std::vector<double> getFixedOutputTimes() {return _fixed_output_times;}
 
+    //! Writes the state of the output, i.e., the contents of the PVD files
+    //! and the fixed output times not reached yet, to the given binary stream.
+    //! Pending asynchronous outputs are written before.
+    void writeCheckpoint(std::ostream& out);
+
+    //! Restores the state written by writeCheckpoint(). All processes must
+    //! have been added in the same order as for writing.
+    void readCheckpoint(std::istream& in);
+
 private:
     struct ProcessData
     {
@@ -88,6 +102,21 @@ private:
         }
 
         MeshLib::IO::PVDFile pvd_file;
+
+        //! Gather lists for the output of the process' bulk mesh.
+        PrimaryVariableGatherLists bulk_mesh_gather_lists;
+
+        //! Cached data for the output of the meshes in
+        //! Output::_mesh_names_for_output.
+        struct MeshOutputData
+        {
+            //! The process' DOF table constrained to the output mesh.
+            std::unique_ptr<NumLib::LocalToGlobalIndexMap> dof_table;
+            PrimaryVariableGatherLists gather_lists;
+        };
+
+        //! Output data of the additional output meshes, keyed by mesh name.
+        std::map<std::string, MeshOutputData> mesh_output_data;
     };
 
     std::string const _output_directory;
@@ -124,8 +153,11 @@ private:
     ProcessOutput const _process_output;
     std::vector<std::string> const _mesh_names_for_output;
     std::vector<std::unique_ptr<MeshLib::Mesh>> const& _meshes;
-};
-
 
+    //! Writes the VTU and PVD files in the background if asynchronous output
+    //! is enabled, otherwise nullptr. Declared last such that pending outputs
+    //! are written before the PVD files are destroyed.
+    std::unique_ptr<BackgroundOutputWriter> _background_writer;
+};
 
 }  // namespace ProcessLib
@@ -126,6 +126,66 @@ static void addSecondaryVariableResiduals(
 
 namespace ProcessLib
 {
+static PrimaryVariableGatherLists computePrimaryVariableGatherLists(
+    GlobalVector const& x,
+    NumLib::LocalToGlobalIndexMap const& dof_table,
+    std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables,
+    std::set<std::string> const& output_variables)
+{
+    PrimaryVariableGatherLists gather_lists(process_variables.size());
+
+    int global_component_offset = 0;
+    int global_component_offset_next = 0;
+
+    const auto number_of_dof_variables = dof_table.getNumberOfVariables();
+    for (int variable_id = 0;
+         variable_id < static_cast<int>(process_variables.size());
+         ++variable_id)
+    {
+        ProcessVariable const& pv = process_variables[variable_id];
+        int const n_components = pv.getNumberOfComponents();
+        // If (number_of_dof_variables==1), the case is either the staggered
+        // scheme being applied or a single PDE being solved.
+        const int sub_meshset_id =
+            (number_of_dof_variables == 1) ? 0 : variable_id;
+
+        if (number_of_dof_variables > 1)
+        {
+            global_component_offset = global_component_offset_next;
+            global_component_offset_next += n_components;
+        }
+
+        if (output_variables.find(pv.getName()) == output_variables.cend())
+        {
+            continue;
+        }
+
+        auto& gather_list = gather_lists[variable_id];
+        for (int component_id = 0; component_id < n_components; ++component_id)
+        {
+            auto const& mesh_subset =
+                dof_table.getMeshSubset(sub_meshset_id, component_id);
+            auto const mesh_id = mesh_subset.getMeshID();
+            for (auto const* node : mesh_subset.getNodes())
+            {
+                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                          node->getID());
+
+                auto const global_component_id =
+                    global_component_offset + component_id;
+                auto const index = dof_table.getLocalIndex(
+                    l, global_component_id, x.getRangeBegin(), x.getRangeEnd());
+
+                gather_list.emplace_back(
+                    node->getID() * n_components + component_id, index);
+            }
+        }
+    }
+
+    return gather_lists;
+}
+
 void processOutputData(
     const double t,
     GlobalVector const& x,
@@ -137,7 +197,8 @@ void processOutputData(
     bool const output_secondary_variable,
     std::vector<std::unique_ptr<IntegrationPointWriter>> const&
         integration_point_writer,
-    ProcessOutput const& process_output)
+    ProcessOutput const& process_output,
+    PrimaryVariableGatherLists* const gather_lists)
 {
     DBUG("Process output data.");
 
@@ -157,28 +218,20 @@ void processOutputData(
     auto const& output_variables = process_output.output_variables;
     std::set<std::string> already_output;
 
-    int global_component_offset = 0;
-    int global_component_offset_next = 0;
+    PrimaryVariableGatherLists local_gather_lists;
+    auto& primary_variable_gather_lists =
+        gather_lists ? *gather_lists : local_gather_lists;
+    if (primary_variable_gather_lists.empty())
+    {
+        primary_variable_gather_lists = computePrimaryVariableGatherLists(
+            x, dof_table, process_variables, output_variables);
+    }
 
-    const auto number_of_dof_variables = dof_table.getNumberOfVariables();
-    // primary variables
     for (int variable_id = 0;
          variable_id < static_cast<int>(process_variables.size());
          ++variable_id)
     {
         ProcessVariable& pv = process_variables[variable_id];
-        int const n_components = pv.getNumberOfComponents();
-        // If (number_of_dof_variables==1), the case is either the staggered
-        // scheme being applied or a single PDE being solved.
-        const int sub_meshset_id =
-            (number_of_dof_variables == 1) ? 0 : variable_id;
-
-        if (number_of_dof_variables > 1)
-        {
-            global_component_offset = global_component_offset_next;
-            global_component_offset_next += n_components;
-        }
-
         if (output_variables.find(pv.getName()) == output_variables.cend())
         {
             continue;
@@ -188,29 +241,13 @@ void processOutputData(
 
         DBUG("  process variable %s", pv.getName().c_str());
 
-        auto const num_comp = pv.getNumberOfComponents();
         auto& output_data = *MeshLib::getOrCreateMeshProperty<double>(
-            mesh, pv.getName(), MeshLib::MeshItemType::Node, num_comp);
+            mesh, pv.getName(), MeshLib::MeshItemType::Node,
+            pv.getNumberOfComponents());
 
-
-        for (int component_id = 0; component_id < num_comp; ++component_id)
+        for (auto const& indices : primary_variable_gather_lists[variable_id])
         {
-            auto const& mesh_subset =
-                dof_table.getMeshSubset(sub_meshset_id, component_id);
-            auto const mesh_id = mesh_subset.getMeshID();
-            for (auto const* node : mesh_subset.getNodes())
-            {
-                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
-                                          node->getID());
-
-                auto const global_component_id =
-                    global_component_offset + component_id;
-                auto const index = dof_table.getLocalIndex(
-                    l, global_component_id, x.getRangeBegin(), x.getRangeEnd());
-
-                output_data[node->getID() * n_components + component_id] =
-                    x_copy[index];
-            }
+            output_data[indices.first] = x_copy[indices.second];
         }
     }
 
@@ -248,4 +285,14 @@ void makeOutput(std::string const& file_name, MeshLib::Mesh& mesh,
     vtu_interface.writeToFile(file_name);
 }
 
+void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
+                MeshLib::Properties const& properties,
+                bool const compress_output, int const data_mode)
+{
+    DBUG("Writing output to '%s'.", file_name.c_str());
+    MeshLib::IO::VtuInterface vtu_interface(&mesh, data_mode, compress_output);
+    vtu_interface.setProperties(&properties);
+    vtu_interface.writeToFile(file_name);
+}
+
 }  // namespace ProcessLib
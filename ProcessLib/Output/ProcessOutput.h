@@ -26,8 +26,20 @@ struct ProcessOutput final
     bool const output_residuals;
 };
 
+//! Gather lists copying the nodal values of the primary variables from the
+//! local part of the global solution vector to the mesh properties. For each
+//! process variable a list of pairs (index into the mesh property, index into
+//! the solution vector) is stored; the lists of variables not being output
+//! are empty.
+using PrimaryVariableGatherLists =
+    std::vector<std::vector<std::pair<std::size_t, GlobalIndexType>>>;
+
 ///
 /// Prepare the output data, i.e. add the solution to vtu data structure.
+///
+/// If \c gather_lists is given, the gather lists are computed on the first call
+/// and reused in subsequent calls, which is valid as long as the mesh, the DOF
+/// table and the output variables do not change.
 void processOutputData(
     const double t,
     GlobalVector const& x,
@@ -39,7 +51,8 @@ void processOutputData(
     bool const output_secondary_variable,
     std::vector<std::unique_ptr<IntegrationPointWriter>> const&
         integration_point_writer,
-    ProcessOutput const& process_output);
+    ProcessOutput const& process_output,
+    PrimaryVariableGatherLists* const gather_lists = nullptr);
 
 //! Writes output to the given \c file_name using the VTU file format.
 ///
@@ -48,4 +61,10 @@ void processOutputData(
 void makeOutput(std::string const& file_name, MeshLib::Mesh& mesh,
                 bool const compress_output, int const data_mode);
 
+//! Writes the nodes and elements of \c mesh with the given \c properties
+//! instead of the mesh's own properties to \c file_name.
+void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
+                MeshLib::Properties const& properties,
+                bool const compress_output, int const data_mode);
+
 }  // namespace ProcessLib
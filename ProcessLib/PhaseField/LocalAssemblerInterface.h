@@ -50,6 +50,10 @@ struct PhaseFieldLocalAssemblerInterface
         GlobalVector const& x, double const t, double& elastic_energy,
         double& surface_energy, double& pressure_work,
         CoupledSolutionsForStaggeredScheme const* const cpl_xs) = 0;
+
+    /// Resets the material state of all integration points to the state of
+    /// the beginning of the time step after the time step has been rejected.
+    virtual void popState() = 0;
 };
 
 }  // namespace PhaseField
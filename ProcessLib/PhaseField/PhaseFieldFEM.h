@@ -68,6 +68,13 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        history_variable = history_variable_prev;
+        eps = eps_prev;
+        material_state_variables->popState();
+    }
+
     template <typename DisplacementVectorType>
     void updateConstitutiveRelation(double const t,
                                     ParameterLib::SpatialPosition const& x,
@@ -220,6 +227,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
     void computeCrackIntegral(
         std::size_t mesh_item_id,
         std::vector<
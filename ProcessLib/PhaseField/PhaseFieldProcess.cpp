@@ -199,7 +199,7 @@ void PhaseFieldProcess<DisplacementDim>::assembleConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_tables, t, x, M, K, b,
         _coupled_solutions);
@@ -234,7 +234,7 @@ void PhaseFieldProcess<DisplacementDim>::assembleWithJacobianConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t,
         x, xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -265,6 +265,18 @@ void PhaseFieldProcess<DisplacementDim>::preTimestepConcreteProcess(
         pv.getActiveElementIDs(), getDOFTable(process_id), x, t, dt);
 }
 
+template <int DisplacementDim>
+void PhaseFieldProcess<DisplacementDim>::rollbackTimestepConcreteProcess(
+    GlobalVector const& /*x*/, int const /*process_id*/)
+{
+    DBUG("Rollback time step PhaseFieldProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
 template <int DisplacementDim>
 void PhaseFieldProcess<DisplacementDim>::postTimestepConcreteProcess(
     GlobalVector const& x, const double /*t*/, const double /*delta_t*/,
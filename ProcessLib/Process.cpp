@@ -9,7 +9,14 @@
 
 #include "Process.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "BaseLib/Functional.h"
+#include "BaseLib/RunTime.h"
+#include "NumLib/Assembler/ElementColoring.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
@@ -19,6 +26,24 @@
 #include "ProcessVariable.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
 
+namespace
+{
+void cacheGlobalMatrixOffsets(NumLib::LocalToGlobalIndexMap const& dof_table,
+                              GlobalMatrix& A)
+{
+#ifndef USE_PETSC
+    A.cacheLocalMatrixOffsets(&dof_table, dof_table.size(),
+                              [&dof_table](std::size_t const mesh_item_id) {
+                                  return NumLib::getIndices(mesh_item_id,
+                                                            dof_table);
+                              });
+#else
+    (void)dof_table;
+    (void)A;
+#endif
+}
+}  // namespace
+
 namespace ProcessLib
 {
 Process::Process(
@@ -94,10 +119,18 @@ void Process::initialize()
     DBUG("Initialize process.");
 
     DBUG("Construct dof mappings.");
+    BaseLib::RunTime time_dof_table;
+    time_dof_table.start();
     constructDofTable();
+    INFO("[time] Constructing the DOF table took %g s.",
+         time_dof_table.elapsed());
 
     DBUG("Compute sparsity pattern");
+    BaseLib::RunTime time_sparsity_pattern;
+    time_sparsity_pattern.start();
     computeSparsityPattern();
+    INFO("[time] Computing the sparsity pattern took %g s.",
+         time_sparsity_pattern.elapsed());
 
     DBUG("Initialize the extrapolator");
     initializeExtrapolator();
@@ -111,6 +144,66 @@ void Process::initialize()
     initializeBoundaryConditions();
 }
 
+void Process::setNumberOfAssemblyThreads(int number_of_threads)
+{
+    if (number_of_threads < 1)
+    {
+        OGS_FATAL("The number of assembly threads must be positive, got %d.",
+                  number_of_threads);
+    }
+#ifdef USE_PETSC
+    if (number_of_threads > 1)
+    {
+        OGS_FATAL(
+            "Multi-threaded assembly is not supported with PETSc; use MPI "
+            "parallelization instead.");
+    }
+#endif
+#ifndef _OPENMP
+    if (number_of_threads > 1)
+    {
+        WARN(
+            "OGS has been built without OpenMP support. The global assembly "
+            "will run on a single thread.");
+        return;
+    }
+#else
+    // Thread-local data, e.g. of the function parameters, is allocated for
+    // the maximum number of OpenMP threads only.
+    if (number_of_threads > omp_get_max_threads())
+    {
+        WARN(
+            "The number of assembly threads %d is limited to the maximum "
+            "number of OpenMP threads %d. Set OMP_NUM_THREADS to use more "
+            "threads.",
+            number_of_threads, omp_get_max_threads());
+        number_of_threads = omp_get_max_threads();
+    }
+#endif
+
+    INFO("Global assembly will run on %d thread(s).", number_of_threads);
+    _global_assembler.setNumberOfThreads(number_of_threads);
+    _assembly_executor = NumLib::ParallelExecutor(
+        number_of_threads, computeAssemblyElementColors());
+}
+
+std::vector<std::size_t> Process::computeAssemblyElementColors() const
+{
+    return NumLib::computeElementColors(_mesh);
+}
+
+void Process::setCacheGlobalMatrixOffsets(bool const cache_offsets)
+{
+#ifdef USE_PETSC
+    if (cache_offsets)
+    {
+        WARN("Caching global matrix offsets is not available with PETSc.");
+    }
+#else
+    _cache_global_matrix_offsets = cache_offsets;
+#endif
+}
+
 void Process::setInitialConditions(const int process_id, double const t,
                                    GlobalVector& x)
 {
@@ -196,10 +289,18 @@ void Process::assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
 {
     MathLib::LinAlg::setLocalAccessibleVector(x);
 
-    assembleConcreteProcess(t, x, M, K, b);
-
     const auto pcs_id =
         (_coupled_solutions) != nullptr ? _coupled_solutions->process_id : 0;
+
+    if (_cache_global_matrix_offsets)
+    {
+        auto const& dof_table = getDOFTable(pcs_id);
+        cacheGlobalMatrixOffsets(dof_table, M);
+        cacheGlobalMatrixOffsets(dof_table, K);
+    }
+
+    assembleConcreteProcess(t, x, M, K, b);
+
     // the last argument is for the jacobian, nullptr is for a unused jacobian
     _boundary_conditions[pcs_id].applyNaturalBC(t, x, K, b, nullptr);
 
@@ -216,12 +317,27 @@ void Process::assembleWithJacobian(const double t, GlobalVector const& x,
     MathLib::LinAlg::setLocalAccessibleVector(x);
     MathLib::LinAlg::setLocalAccessibleVector(xdot);
 
+    const auto pcs_id =
+        (_coupled_solutions) != nullptr ? _coupled_solutions->process_id : 0;
+
+    if (_cache_global_matrix_offsets)
+    {
+        auto const& dof_table = getDOFTable(pcs_id);
+        // In the local residual assembly M and K only receive contributions
+        // of natural boundary conditions and must not get the full sparsity
+        // pattern inserted.
+        if (!_global_assembler.isLocalResidualAssembly())
+        {
+            cacheGlobalMatrixOffsets(dof_table, M);
+            cacheGlobalMatrixOffsets(dof_table, K);
+        }
+        cacheGlobalMatrixOffsets(dof_table, Jac);
+    }
+
     assembleWithJacobianConcreteProcess(t, x, xdot, dxdot_dx, dx_dx, M, K, b,
                                         Jac);
 
     // TODO: apply BCs to Jacobian.
-    const auto pcs_id =
-        (_coupled_solutions) != nullptr ? _coupled_solutions->process_id : 0;
     _boundary_conditions[pcs_id].applyNaturalBC(t, x, K, b, &Jac);
 
     // the last argument is for the jacobian, nullptr is for a unused jacobian
@@ -311,7 +427,8 @@ void Process::initializeExtrapolator()
 
     std::unique_ptr<NumLib::Extrapolator> extrapolator(
         new NumLib::LocalLinearLeastSquaresExtrapolator(
-            *dof_table_single_component));
+            *dof_table_single_component,
+            _assembly_executor.getNumberOfThreads()));
 
     // TODO: Later on the DOF table can change during the simulation!
     _extrapolator_data = ExtrapolatorData(
@@ -365,6 +482,12 @@ void Process::postTimestep(GlobalVector const& x, const double t,
     postTimestepConcreteProcess(x, t, delta_t, process_id);
 }
 
+void Process::rollbackTimestep(GlobalVector const& x, int const process_id)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    rollbackTimestepConcreteProcess(x, process_id);
+}
+
 void Process::postNonLinearSolver(GlobalVector const& x, const double t,
                                   int const process_id)
 {
@@ -398,4 +521,14 @@ NumLib::IterationResult Process::postIteration(const GlobalVector& x)
     return postIterationConcreteProcess(x);
 }
 
+void Process::writeCheckpoint(std::ostream& /*out*/) const
+{
+    OGS_FATAL("The process does not support checkpoints.");
+}
+
+void Process::readCheckpoint(std::istream& /*in*/)
+{
+    OGS_FATAL("The process does not support checkpoints.");
+}
+
 }  // namespace ProcessLib
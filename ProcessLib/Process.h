@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <tuple>
 
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/NamedFunctionCaller.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
@@ -64,6 +66,12 @@ public:
     void postTimestep(GlobalVector const& x, const double t,
                       const double delta_t, int const process_id);
 
+    /// Restores the process internal state, e.g. the material state at the
+    /// integration points, of the beginning of a rejected time step. The
+    /// solution \c x has already been reset to the previous time step's
+    /// solution.
+    void rollbackTimestep(GlobalVector const& x, int const process_id);
+
     /// Calculates secondary variables, e.g. stress and strain for deformation
     /// analysis, only after nonlinear solver being successfully conducted.
     void postNonLinearSolver(GlobalVector const& x, const double t,
@@ -79,6 +87,25 @@ public:
 
     void initialize();
 
+    /// Enables the assembly of the local assemblers' contributions into the
+    /// global matrices and vectors on the given number of threads.
+    /// Elements sharing mesh nodes are never assembled concurrently.
+    /// The extrapolator created in initialize() uses the same number of
+    /// threads. The number of threads is limited to the maximum number of
+    /// OpenMP threads.
+    ///
+    /// \note All material models and parameters used by the local assemblers
+    /// must be safe to be evaluated concurrently.
+    void setNumberOfAssemblyThreads(int const number_of_threads);
+
+    /// Enables caching the positions of the local matrix entries in the
+    /// global matrices. Then the local matrices are added to the global ones
+    /// without searching the sparse matrix rows, which pays off for large
+    /// local matrices at the cost of one offset per local matrix entry of
+    /// every element. In the local residual assembly only the Jacobian's
+    /// offsets are cached.
+    void setCacheGlobalMatrixOffsets(bool const cache_offsets);
+
     void setInitialConditions(const int process_id, const double t,
                               GlobalVector& x);
 
@@ -105,6 +132,11 @@ public:
                               GlobalMatrix& K, GlobalVector& b,
                               GlobalMatrix& Jac) final;
 
+    void setLocalResidualAssembly(bool const enabled) final
+    {
+        _global_assembler.setLocalResidualAssembly(enabled);
+    }
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t, GlobalVector const& x) const final
     {
@@ -137,6 +169,19 @@ public:
         return _integration_point_writer;
     }
 
+    /// \return true if the process implements writeCheckpoint() and
+    /// readCheckpoint(), i.e. it can store and restore its complete
+    /// integration point state.
+    virtual bool isCheckpointSupported() const { return false; }
+
+    /// Writes the complete integration point state, i.e. all integration
+    /// point data and the material state variables, as binary into the given
+    /// stream, such that a resumed simulation continues exactly.
+    virtual void writeCheckpoint(std::ostream& out) const;
+
+    /// Restores the integration point state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& in);
+
     // Used as a call back for CalculateSurfaceFlux process.
 
     virtual Eigen::Vector3d getFlux(std::size_t /*element_id*/,
@@ -177,6 +222,11 @@ private:
     /// processes. It is called by initialize().
     virtual void initializeBoundaryConditions();
 
+    /// Colors of the mesh elements for the multi-threaded assembly, cf.
+    /// NumLib::ParallelExecutor. Processes may override this to group elements
+    /// of the same kind into common colors.
+    virtual std::vector<std::size_t> computeAssemblyElementColors() const;
+
     virtual void setInitialConditionsConcreteProcess(GlobalVector const& /*x*/,
                                                      double const /*t*/)
     {
@@ -210,6 +260,11 @@ private:
     {
     }
 
+    virtual void rollbackTimestepConcreteProcess(GlobalVector const& /*x*/,
+                                                 int const /*process_id*/)
+    {
+    }
+
     virtual void postNonLinearSolverConcreteProcess(GlobalVector const& /*x*/,
                                                     const double /*t*/,
                                                     int const /*process_id*/)
@@ -273,6 +328,13 @@ protected:
 
     VectorMatrixAssembler _global_assembler;
 
+    /// Runs the _global_assembler over the local assemblers, either serially
+    /// or multi-threaded, cf. setNumberOfAssemblyThreads().
+    NumLib::ParallelExecutor _assembly_executor;
+
+    /// \see setCacheGlobalMatrixOffsets().
+    bool _cache_global_matrix_offsets = false;
+
     const bool _use_monolithic_scheme;
 
     /// Pointer to CoupledSolutionsForStaggeredScheme, which contains the
@@ -50,6 +50,7 @@ struct ProcessData
           time_disc(std::move(pd.time_disc)),
           tdisc_ode_sys(std::move(pd.tdisc_ode_sys)),
           mat_strg(pd.mat_strg),
+          local_residual_assembly(pd.local_residual_assembly),
           process(pd.process)
     {
         pd.mat_strg = nullptr;
@@ -62,6 +63,11 @@ struct ProcessData
     //! or the ending time, the flag is set to true.
     bool skip_time_stepping = false;
 
+    //! Set if preTimestep() of the process has been called in the current
+    //! time step. Only such processes are rolled back if the time step is
+    //! rejected.
+    bool timestep_started = false;
+
     //! Tag containing the missing type information necessary to cast the
     //! other members of this struct to their concrety types.
     NumLib::NonlinearSolverTag const nonlinear_solver_tag;
@@ -75,6 +81,11 @@ struct ProcessData
     //! cast of \c tdisc_ode_sys to NumLib::InternalMatrixStorage
     NumLib::InternalMatrixStorage* mat_strg = nullptr;
 
+    //! If true, the residual is assembled element by element and the global
+    //! matrices M and K are not assembled. Only used with the Newton-Raphson
+    //! method.
+    bool local_residual_assembly = false;
+
     /// Process ID. It is alway 0 when the monolithic scheme is used or
     /// a single process is modelled.
     int process_id = 0;
@@ -69,6 +69,13 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        eps = eps_prev;
+        sigma_eff = sigma_eff_prev;
+        material_state_variables->popState();
+    }
+
     template <typename DisplacementVectorType>
     typename BMatricesType::KelvinMatrixType updateConstitutiveRelation(
         double const t,
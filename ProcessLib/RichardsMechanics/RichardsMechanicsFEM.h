@@ -101,6 +101,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
     void computeSecondaryVariableConcrete(
         double const t, std::vector<double> const& local_x) override;
 
@@ -243,7 +243,7 @@ void RichardsMechanicsProcess<DisplacementDim>::assembleConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b,
         _coupled_solutions);
@@ -291,7 +291,7 @@ void RichardsMechanicsProcess<DisplacementDim>::
         _use_monolithic_scheme ? 0 : _coupled_solutions->process_id;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, x,
         xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -341,6 +341,18 @@ void RichardsMechanicsProcess<DisplacementDim>::preTimestepConcreteProcess(
     }
 }
 
+template <int DisplacementDim>
+void RichardsMechanicsProcess<DisplacementDim>::rollbackTimestepConcreteProcess(
+    GlobalVector const& /*x*/, int const /*process_id*/)
+{
+    DBUG("Rollback time step RichardsMechanicsProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
 template <int DisplacementDim>
 void RichardsMechanicsProcess<
     DisplacementDim>::postNonLinearSolverConcreteProcess(GlobalVector const& x,
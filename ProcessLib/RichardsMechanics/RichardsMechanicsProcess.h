@@ -85,6 +85,9 @@ private:
                                     double const dt,
                                     const int process_id) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
     void postNonLinearSolverConcreteProcess(GlobalVector const& x,
                                             const double t,
                                             int const process_id) override;
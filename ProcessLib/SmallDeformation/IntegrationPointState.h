@@ -0,0 +1,95 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <iosfwd>
+#include <vector>
+
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "SmallDeformationProcessData.h"
+
+namespace ProcessLib
+{
+namespace SmallDeformation
+{
+/// Keeps the stresses and strains of the last accepted time step and lets the
+/// local assemblers push back their material state at the beginning of a time
+/// step.
+///
+/// The stresses and strains are stored in contiguous arrays and are copied at
+/// once.
+template <int DisplacementDim, typename LocalAssemblers>
+void pushBackIntegrationPointState(
+    SmallDeformationProcessData<DisplacementDim>& process_data,
+    LocalAssemblers const& local_assemblers,
+    std::vector<std::size_t> const& active_element_ids,
+    NumLib::LocalToGlobalIndexMap const& dof_table, GlobalVector const& x,
+    double const t, double const dt)
+{
+    auto& ip_data = process_data.integration_point_data;
+    auto const& fields = process_data.integration_point_data_fields;
+    ip_data.copyField(fields.sigma, fields.sigma_prev);
+    ip_data.copyField(fields.eps, fields.eps_prev);
+
+    GlobalExecutor::executeSelectedMemberOnDereferenced(
+        &ProcessLib::LocalAssemblerInterface::preTimestep, local_assemblers,
+        active_element_ids, dof_table, x, t, dt);
+}
+
+/// Restores the state of the last accepted time step after a rejected time
+/// step. The fields of the last accepted time step are still intact, because
+/// they are overwritten by pushBackIntegrationPointState() only.
+template <int DisplacementDim, typename LocalAssemblers>
+void popIntegrationPointState(
+    SmallDeformationProcessData<DisplacementDim>& process_data,
+    LocalAssemblers const& local_assemblers)
+{
+    auto& ip_data = process_data.integration_point_data;
+    auto const& fields = process_data.integration_point_data_fields;
+    ip_data.copyField(fields.sigma_prev, fields.sigma);
+    ip_data.copyField(fields.eps_prev, fields.eps);
+
+    for (auto const& local_assembler : local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
+/// Writes the integration point fields and the material state of all local
+/// assemblers as binary into the given stream.
+template <int DisplacementDim, typename LocalAssemblers>
+void writeIntegrationPointState(
+    SmallDeformationProcessData<DisplacementDim> const& process_data,
+    LocalAssemblers const& local_assemblers, std::ostream& out)
+{
+    process_data.integration_point_data.writeFields(out);
+    for (auto const& local_assembler : local_assemblers)
+    {
+        local_assembler->writeMaterialState(out);
+    }
+}
+
+/// Restores the state written by writeIntegrationPointState().
+template <int DisplacementDim, typename LocalAssemblers>
+void readIntegrationPointState(
+    SmallDeformationProcessData<DisplacementDim>& process_data,
+    LocalAssemblers const& local_assemblers, std::istream& in)
+{
+    process_data.integration_point_data.readFields(in);
+    for (auto const& local_assembler : local_assemblers)
+    {
+        local_assembler->readMaterialState(in);
+    }
+}
+
+}  // namespace SmallDeformation
+}  // namespace ProcessLib
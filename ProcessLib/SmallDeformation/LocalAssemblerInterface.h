@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <vector>
 
 #include "MaterialLib/SolidModels/MechanicsBase.h"
@@ -55,6 +56,17 @@ struct SmallDeformationLocalAssemblerInterface
     virtual typename MaterialLib::Solids::MechanicsBase<
         DisplacementDim>::MaterialStateVariables const&
     getMaterialStateVariablesAt(unsigned /*integration_point*/) const = 0;
+
+    /// Resets the material state of all integration points to the state of
+    /// the beginning of the time step after the time step has been rejected.
+    virtual void popState() = 0;
+
+    /// Writes the material state variables of all integration points as
+    /// binary into the given stream.
+    virtual void writeMaterialState(std::ostream& out) const = 0;
+
+    /// Restores the material state variables written by writeMaterialState().
+    virtual void readMaterialState(std::istream& in) = 0;
 };
 
 }  // namespace SmallDeformation
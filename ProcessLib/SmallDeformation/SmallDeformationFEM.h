@@ -37,18 +37,35 @@ template <typename BMatricesType, typename ShapeMatricesType,
           int DisplacementDim>
 struct IntegrationPointData final
 {
-    explicit IntegrationPointData(
+    using KelvinVectorType = typename BMatricesType::KelvinVectorType;
+
+    /// The stresses, strains and the free energy density are views to the
+    /// given process-wide \c store.
+    IntegrationPointData(
         MaterialLib::Solids::MechanicsBase<DisplacementDim> const&
-            solid_material)
-        : solid_material(solid_material),
+            solid_material,
+        IntegrationPointDataStore& store,
+        IntegrationPointDataFields const& fields, std::size_t const element_id,
+        unsigned const integration_point)
+        : sigma(store.value<KelvinVectorType>(fields.sigma, element_id,
+                                              integration_point)),
+          sigma_prev(store.value<KelvinVectorType>(
+              fields.sigma_prev, element_id, integration_point)),
+          eps(store.value<KelvinVectorType>(fields.eps, element_id,
+                                            integration_point)),
+          eps_prev(store.value<KelvinVectorType>(fields.eps_prev, element_id,
+                                                 integration_point)),
+          free_energy_density(*store.data(fields.free_energy_density,
+                                          element_id, integration_point)),
+          solid_material(solid_material),
           material_state_variables(
               solid_material.createMaterialStateVariables())
     {
     }
 
-    typename BMatricesType::KelvinVectorType sigma, sigma_prev;
-    typename BMatricesType::KelvinVectorType eps, eps_prev;
-    double free_energy_density = 0;
+    Eigen::Map<KelvinVectorType> sigma, sigma_prev;
+    Eigen::Map<KelvinVectorType> eps, eps_prev;
+    double& free_energy_density;
 
     MaterialLib::Solids::MechanicsBase<DisplacementDim> const& solid_material;
     std::unique_ptr<typename MaterialLib::Solids::MechanicsBase<
@@ -59,24 +76,15 @@ struct IntegrationPointData final
     typename ShapeMatricesType::NodalRowVectorType N;
     typename ShapeMatricesType::GlobalDimNodalMatrixType dNdx;
 
-    void pushBackState()
-    {
-        eps_prev = eps;
-        sigma_prev = sigma;
-        material_state_variables->pushBackState();
-    }
+    /// The previous stresses and strains are updated for all integration
+    /// points at once by the process, cf.
+    /// IntegrationPointDataStore::copyField().
+    void pushBackState() { material_state_variables->pushBackState(); }
+    void popState() { material_state_variables->popState(); }
 
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
-/// Used for the extrapolation of the integration point values. It is ordered
-/// (and stored) by integration points.
-template <typename ShapeMatrixType>
-struct SecondaryData
-{
-    std::vector<ShapeMatrixType, Eigen::aligned_allocator<ShapeMatrixType>> N;
-};
-
 template <typename ShapeFunction, typename IntegrationMethod,
           int DisplacementDim>
 class SmallDeformationLocalAssembler
@@ -91,6 +99,7 @@ public:
     using BMatricesType = BMatrixPolicyType<ShapeFunction, DisplacementDim>;
 
     using BMatrixType = typename BMatricesType::BMatrixType;
+    using KelvinVectorType = typename BMatricesType::KelvinVectorType;
     using StiffnessMatrixType = typename BMatricesType::StiffnessMatrixType;
     using NodalForceVectorType = typename BMatricesType::NodalForceVectorType;
     using NodalDisplacementVectorType =
@@ -118,8 +127,18 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
+        auto& ip_data_store = _process_data.integration_point_data;
+        if (ip_data_store.getNumberOfIntegrationPoints(e.getID()) !=
+            n_integration_points)
+        {
+            OGS_FATAL(
+                "The integration point data store has %d integration points "
+                "for element %d, but the local assembler has %d.",
+                ip_data_store.getNumberOfIntegrationPoints(e.getID()),
+                e.getID(), n_integration_points);
+        }
+
         _ip_data.reserve(n_integration_points);
-        _secondary_data.N.resize(n_integration_points);
 
         auto const shape_matrices =
             initShapeMatrices<ShapeFunction, ShapeMatricesType,
@@ -132,9 +151,12 @@ public:
                 _process_data.material_ids,
                 e.getID());
 
+        // The stresses and strains are zero initialized by the store.
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            _ip_data.emplace_back(solid_material);
+            _ip_data.emplace_back(solid_material, ip_data_store,
+                                  _process_data.integration_point_data_fields,
+                                  e.getID(), ip);
             auto& ip_data = _ip_data[ip];
             auto const& sm = shape_matrices[ip];
             _ip_data[ip].integration_weight =
@@ -143,19 +165,6 @@ public:
 
             ip_data.N = sm.N;
             ip_data.dNdx = sm.dNdx;
-
-            static const int kelvin_vector_size =
-                MathLib::KelvinVector::KelvinVectorDimensions<
-                    DisplacementDim>::value;
-            // Initialize current time step values
-            ip_data.sigma.setZero(kelvin_vector_size);
-            ip_data.eps.setZero(kelvin_vector_size);
-
-            // Previous time step values are not initialized and are set later.
-            ip_data.sigma_prev.resize(kelvin_vector_size);
-            ip_data.eps_prev.resize(kelvin_vector_size);
-
-            _secondary_data.N[ip] = shape_matrices[ip].N;
         }
     }
 
@@ -244,29 +253,29 @@ public:
                 typename BMatricesType::BMatrixType>(dNdx, N, x_coord,
                                                      _is_axially_symmetric);
 
-            auto const& eps_prev = _ip_data[ip].eps_prev;
-            auto const& sigma_prev = _ip_data[ip].sigma_prev;
+            // The material models take Kelvin vectors; the previous values
+            // are copied from the integration point data store.
+            KelvinVectorType const eps_prev = _ip_data[ip].eps_prev;
+            KelvinVectorType const sigma_prev = _ip_data[ip].sigma_prev;
 
-            auto& eps = _ip_data[ip].eps;
-            auto& sigma = _ip_data[ip].sigma;
-            auto& state = _ip_data[ip].material_state_variables;
+            auto& state = *_ip_data[ip].material_state_variables;
 
-            eps.noalias() =
+            KelvinVectorType const eps =
                 B *
                 Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
                     local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
+            _ip_data[ip].eps = eps;
 
-            auto&& solution = _ip_data[ip].solid_material.integrateStress(
-                t, x_position, _process_data.dt, eps_prev, eps, sigma_prev,
-                *state, _process_data.reference_temperature);
-
-            if (!solution)
+            // The material state is updated in place.
+            KelvinVectorType sigma;
+            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+            if (!_ip_data[ip].solid_material.integrateStressInPlace(
+                    t, x_position, _process_data.dt, eps_prev, eps, sigma_prev,
+                    state, _process_data.reference_temperature, sigma, C))
             {
                 OGS_FATAL("Computation of local constitutive relation failed.");
             }
-
-            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-            std::tie(sigma, state, C) = std::move(*solution);
+            _ip_data[ip].sigma = sigma;
 
             auto const rho = _process_data.solid_density(t, x_position)[0];
             auto const& b = _process_data.specific_body_force;
@@ -289,6 +298,30 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
+    void writeMaterialState(std::ostream& out) const override
+    {
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.material_state_variables->serialize(out);
+        }
+    }
+
+    void readMaterialState(std::istream& in) override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.material_state_variables->deserialize(in);
+        }
+    }
+
     void postTimestepConcrete(std::vector<double> const& /*local_x*/) override
     {
         unsigned const n_integration_points =
@@ -326,7 +359,7 @@ public:
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
-        auto const& N = _secondary_data.N[integration_point];
+        auto const& N = _ip_data[integration_point].N;
 
         // assumes N is stored contiguously in memory
         return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
@@ -338,36 +371,26 @@ public:
         NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
         std::vector<double>& cache) const override
     {
-        cache.clear();
-        cache.reserve(_ip_data.size());
-
-        for (auto const& ip_data : _ip_data)
-        {
-            cache.push_back(ip_data.free_energy_density);
-        }
+        auto const* const values = _process_data.integration_point_data.data(
+            _process_data.integration_point_data_fields.free_energy_density,
+            _element.getID());
+        cache.assign(values, values + _ip_data.size());
 
         return cache;
     }
 
     std::size_t setSigma(double const* values)
     {
-        auto const kelvin_vector_size =
-            MathLib::KelvinVector::KelvinVectorDimensions<
-                DisplacementDim>::value;
         auto const n_integration_points = _ip_data.size();
 
-        std::vector<double> ip_sigma_values;
-        auto sigma_values =
-            Eigen::Map<Eigen::Matrix<double, kelvin_vector_size, Eigen::Dynamic,
-                                     Eigen::ColMajor> const>(
-                values, kelvin_vector_size, n_integration_points);
-
-        for (unsigned ip = 0; ip < n_integration_points; ++ip)
-        {
-            _ip_data[ip].sigma =
-                MathLib::KelvinVector::symmetricTensorToKelvinVector(
-                    sigma_values.col(ip));
-        }
+        auto sigma = elementKelvinVectors(
+            _process_data.integration_point_data_fields.sigma);
+        sigma = Eigen::Map<Eigen::Matrix<double, kelvin_vector_size,
+                                         Eigen::Dynamic> const>(
+            values, kelvin_vector_size, n_integration_points);
+        // Symmetric tensor to Kelvin vector conversion, cf.
+        // MathLib::KelvinVector::symmetricTensorToKelvinVector().
+        sigma.template bottomRows<kelvin_vector_size - 3>() *= std::sqrt(2.);
 
         return n_integration_points;
     }
@@ -377,9 +400,6 @@ public:
     // There should be only one.
     std::vector<double> getSigma() const override
     {
-        auto const kelvin_vector_size =
-            MathLib::KelvinVector::KelvinVectorDimensions<
-                DisplacementDim>::value;
         auto const n_integration_points = _ip_data.size();
 
         std::vector<double> ip_sigma_values;
@@ -387,12 +407,13 @@ public:
             double, Eigen::Dynamic, kelvin_vector_size, Eigen::RowMajor>>(
             ip_sigma_values, n_integration_points, kelvin_vector_size);
 
-        for (unsigned ip = 0; ip < n_integration_points; ++ip)
-        {
-            auto const& sigma = _ip_data[ip].sigma;
-            cache_mat.row(ip) =
-                MathLib::KelvinVector::kelvinVectorToSymmetricTensor(sigma);
-        }
+        cache_mat = elementKelvinVectors(
+                        _process_data.integration_point_data_fields.sigma)
+                        .transpose();
+        // Kelvin vector to symmetric tensor conversion, cf.
+        // MathLib::KelvinVector::kelvinVectorToSymmetricTensor().
+        cache_mat.template rightCols<kelvin_vector_size - 3>() /=
+            std::sqrt(2.);
 
         return ip_sigma_values;
     }
@@ -403,24 +424,8 @@ public:
         NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
         std::vector<double>& cache) const override
     {
-        static const int kelvin_vector_size =
-            MathLib::KelvinVector::KelvinVectorDimensions<
-                DisplacementDim>::value;
-        auto const num_intpts = _ip_data.size();
-
-        cache.clear();
-        auto cache_mat = MathLib::createZeroedMatrix<Eigen::Matrix<
-            double, kelvin_vector_size, Eigen::Dynamic, Eigen::RowMajor>>(
-            cache, kelvin_vector_size, num_intpts);
-
-        for (unsigned ip = 0; ip < num_intpts; ++ip)
-        {
-            auto const& sigma = _ip_data[ip].sigma;
-            cache_mat.col(ip) =
-                MathLib::KelvinVector::kelvinVectorToSymmetricTensor(sigma);
-        }
-
-        return cache;
+        return getIntPtSymmetricTensors(
+            _process_data.integration_point_data_fields.sigma, cache);
     }
 
     std::vector<double> const& getIntPtEpsilon(
@@ -429,24 +434,8 @@ public:
         NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
         std::vector<double>& cache) const override
     {
-        auto const kelvin_vector_size =
-            MathLib::KelvinVector::KelvinVectorDimensions<
-                DisplacementDim>::value;
-        auto const num_intpts = _ip_data.size();
-
-        cache.clear();
-        auto cache_mat = MathLib::createZeroedMatrix<Eigen::Matrix<
-            double, kelvin_vector_size, Eigen::Dynamic, Eigen::RowMajor>>(
-            cache, kelvin_vector_size, num_intpts);
-
-        for (unsigned ip = 0; ip < num_intpts; ++ip)
-        {
-            auto const& eps = _ip_data[ip].eps;
-            cache_mat.col(ip) =
-                MathLib::KelvinVector::kelvinVectorToSymmetricTensor(eps);
-        }
-
-        return cache;
+        return getIntPtSymmetricTensors(
+            _process_data.integration_point_data_fields.eps, cache);
     }
 
     unsigned getNumberOfIntegrationPoints() const override
@@ -462,6 +451,49 @@ public:
     }
 
 private:
+    static constexpr int kelvin_vector_size =
+        MathLib::KelvinVector::KelvinVectorDimensions<DisplacementDim>::value;
+
+    /// View to the Kelvin vectors of the given field at all integration
+    /// points of the element.
+    Eigen::Map<Eigen::Matrix<double, kelvin_vector_size, Eigen::Dynamic>>
+    elementKelvinVectors(int const field)
+    {
+        return _process_data.integration_point_data
+            .template elementValues<kelvin_vector_size>(field,
+                                                        _element.getID());
+    }
+
+    Eigen::Map<
+        Eigen::Matrix<double, kelvin_vector_size, Eigen::Dynamic> const>
+    elementKelvinVectors(int const field) const
+    {
+        auto const& ip_data_store = _process_data.integration_point_data;
+        return ip_data_store.template elementValues<kelvin_vector_size>(
+            field, _element.getID());
+    }
+
+    /// Converts the Kelvin vectors of the given field to symmetric tensors
+    /// stored in the \c cache, one component after another.
+    std::vector<double> const& getIntPtSymmetricTensors(
+        int const field, std::vector<double>& cache) const
+    {
+        auto const num_intpts = _ip_data.size();
+
+        cache.clear();
+        auto cache_mat = MathLib::createZeroedMatrix<Eigen::Matrix<
+            double, kelvin_vector_size, Eigen::Dynamic, Eigen::RowMajor>>(
+            cache, kelvin_vector_size, num_intpts);
+
+        cache_mat = elementKelvinVectors(field);
+        // Kelvin vector to symmetric tensor conversion, cf.
+        // MathLib::KelvinVector::kelvinVectorToSymmetricTensor().
+        cache_mat.template bottomRows<kelvin_vector_size - 3>() /=
+            std::sqrt(2.);
+
+        return cache;
+    }
+
     SmallDeformationProcessData<DisplacementDim>& _process_data;
 
     std::vector<
@@ -472,7 +504,6 @@ private:
 
     IntegrationMethod _integration_method;
     MeshLib::Element const& _element;
-    SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
     bool const _is_axially_symmetric;
 
     static const int displacement_size =
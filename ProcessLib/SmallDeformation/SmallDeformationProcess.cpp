@@ -16,6 +16,7 @@
 #include "ProcessLib/Process.h"
 #include "ProcessLib/SmallDeformation/CreateLocalAssemblers.h"
 
+#include "IntegrationPointState.h"
 #include "SmallDeformationFEM.h"
 
 namespace ProcessLib
@@ -78,6 +79,23 @@ void SmallDeformationProcess<DisplacementDim>::initializeConcreteProcess(
 {
     using nlohmann::json;
 
+    // The integration point data of all elements is allocated at once before
+    // the local assemblers are created, which keep views to their part.
+    auto const kelvin_vector_size =
+        MathLib::KelvinVector::KelvinVectorDimensions<DisplacementDim>::value;
+    auto& ip_data_store = _process_data.integration_point_data;
+    ip_data_store =
+        IntegrationPointDataStore(mesh.getElements(), integration_order);
+    auto& fields = _process_data.integration_point_data_fields;
+    fields.sigma = ip_data_store.addField("sigma", kelvin_vector_size);
+    fields.sigma_prev =
+        ip_data_store.addField("sigma_prev", kelvin_vector_size);
+    fields.eps = ip_data_store.addField("epsilon", kelvin_vector_size);
+    fields.eps_prev =
+        ip_data_store.addField("epsilon_prev", kelvin_vector_size);
+    fields.free_energy_density =
+        ip_data_store.addField("free_energy_density", 1);
+
     ProcessLib::SmallDeformation::createLocalAssemblers<
         DisplacementDim, SmallDeformationLocalAssembler>(
         mesh.getElements(), dof_table, _local_assemblers,
@@ -240,7 +258,7 @@ void SmallDeformationProcess<DisplacementDim>::assembleConcreteProcess(
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b,
         _coupled_solutions);
@@ -263,7 +281,7 @@ void SmallDeformationProcess<DisplacementDim>::
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t, x,
         xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -284,10 +302,9 @@ void SmallDeformationProcess<DisplacementDim>::preTimestepConcreteProcess(
 
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
-    GlobalExecutor::executeSelectedMemberOnDereferenced(
-        &LocalAssemblerInterface::preTimestep, _local_assemblers,
-        pv.getActiveElementIDs(), *_local_to_global_index_map,
-        x, t, dt);
+    pushBackIntegrationPointState(_process_data, _local_assemblers,
+                                  pv.getActiveElementIDs(),
+                                  *_local_to_global_index_map, x, t, dt);
 }
 
 template <int DisplacementDim>
@@ -310,6 +327,28 @@ void SmallDeformationProcess<DisplacementDim>::postTimestepConcreteProcess(
     material_forces->copyValues(*_material_forces);
 }
 
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::rollbackTimestepConcreteProcess(
+    GlobalVector const& /*x*/, int const /*process_id*/)
+{
+    DBUG("Rollback time step SmallDeformationProcess.");
+
+    popIntegrationPointState(_process_data, _local_assemblers);
+}
+
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::writeCheckpoint(
+    std::ostream& out) const
+{
+    writeIntegrationPointState(_process_data, _local_assemblers, out);
+}
+
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::readCheckpoint(std::istream& in)
+{
+    readIntegrationPointState(_process_data, _local_assemblers, in);
+}
+
 template class SmallDeformationProcess<2>;
 template class SmallDeformationProcess<3>;
 
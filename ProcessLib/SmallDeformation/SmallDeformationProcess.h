@@ -74,6 +74,10 @@ public:
     bool isLinear() const override;
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+    void writeCheckpoint(std::ostream& out) const override;
+    void readCheckpoint(std::istream& in) override;
+
 private:
     using LocalAssemblerInterface =
         SmallDeformationLocalAssemblerInterface<DisplacementDim>;
@@ -100,6 +104,9 @@ private:
                                      const double delta_t,
                                      int const process_id) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
 private:
     SmallDeformationProcessData<DisplacementDim> _process_data;
 
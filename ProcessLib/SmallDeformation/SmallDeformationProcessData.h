@@ -15,6 +15,7 @@
 #include <Eigen/Eigen>
 
 #include "ParameterLib/Parameter.h"
+#include "ProcessLib/Utils/IntegrationPointDataStore.h"
 
 namespace MaterialLib
 {
@@ -28,6 +29,17 @@ namespace ProcessLib
 {
 namespace SmallDeformation
 {
+/// Indices of the integration point data fields of the SmallDeformation
+/// process, cf. SmallDeformationProcessData::integration_point_data.
+struct IntegrationPointDataFields
+{
+    int sigma = -1;
+    int sigma_prev = -1;
+    int eps = -1;
+    int eps_prev = -1;
+    int free_energy_density = -1;
+};
+
 template <int DisplacementDim>
 struct SmallDeformationProcessData
 {
@@ -75,6 +87,11 @@ struct SmallDeformationProcessData
     double dt = 0;
     double t = 0;
     double const reference_temperature;
+
+    /// Stresses, strains and the free energy density at the integration
+    /// points of all elements.
+    IntegrationPointDataStore integration_point_data;
+    IntegrationPointDataFields integration_point_data_fields;
 };
 
 }  // namespace SmallDeformation
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "BaseLib/FileTools.h"
 #include "IntegrationPointDataNonlocalInterface.h"
 #include "MaterialLib/SolidModels/Ehlers.h"
 
@@ -66,6 +67,49 @@ struct IntegrationPointData final : public IntegrationPointDataNonlocalInterface
         material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        eps = eps_prev;
+        sigma = sigma_prev;
+        damage = damage_prev;
+        kappa_d = kappa_d_prev;
+        material_state_variables->popState();
+    }
+
+    /// Writes the complete state as binary into the given stream.
+    void writeState(std::ostream& out) const
+    {
+        for (auto const* v : {&sigma, &sigma_prev, &eps, &eps_prev})
+        {
+            BaseLib::writeValuesBinary(out, v->data(), v->size());
+        }
+        for (double const v : {free_energy_density, damage, damage_prev,
+                                kappa_d, kappa_d_prev})
+        {
+            BaseLib::writeValueBinary(out, v);
+        }
+        BaseLib::writeValueBinary(out, active_self);
+        BaseLib::writeValueBinary(out, activated);
+        material_state_variables->serialize(out);
+    }
+
+    /// Restores the state written by writeState().
+    void readState(std::istream& in)
+    {
+        for (auto* v : {&sigma, &sigma_prev, &eps, &eps_prev})
+        {
+            BaseLib::readBinaryValues(in, v->data(), v->size());
+        }
+        for (double* v : {&free_energy_density, &damage, &damage_prev,
+                          &kappa_d, &kappa_d_prev})
+        {
+            *v = BaseLib::readBinaryValue<double>(in);
+        }
+        active_self = BaseLib::readBinaryValue<bool>(in);
+        activated = BaseLib::readBinaryValue<bool>(in);
+        material_state_variables->deserialize(in);
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <memory>
 #include <vector>
 
@@ -98,6 +99,17 @@ struct SmallDeformationNonlocalLocalAssemblerInterface
 
     virtual IntegrationPointDataNonlocalInterface* getIPDataPtr(
         int const ip) = 0;
+
+    /// Writes the complete state of all integration points as binary into
+    /// the given stream.
+    virtual void writeCheckpoint(std::ostream& out) const = 0;
+
+    /// Restores the state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& in) = 0;
+
+    /// Resets the material state of all integration points to the state of
+    /// the beginning of the time step after the time step has been rejected.
+    virtual void popState() = 0;
 };
 
 }  // namespace SmallDeformationNonlocal
@@ -527,6 +527,30 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
+    void writeCheckpoint(std::ostream& out) const override
+    {
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.writeState(out);
+        }
+    }
+
+    void readCheckpoint(std::istream& in) override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.readState(in);
+        }
+    }
+
     void computeCrackIntegral(std::size_t mesh_item_id,
                               NumLib::LocalToGlobalIndexMap const& dof_table,
                               GlobalVector const& x,
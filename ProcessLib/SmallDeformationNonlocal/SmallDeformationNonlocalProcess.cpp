@@ -235,7 +235,7 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::assembleConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b, _coupled_solutions);
 }
@@ -275,7 +275,7 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t, x, xdot,
         dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -305,6 +305,19 @@ void SmallDeformationNonlocalProcess<
         pv.getActiveElementIDs(), *_local_to_global_index_map, x, t, dt);
 }
 
+template <int DisplacementDim>
+void SmallDeformationNonlocalProcess<
+    DisplacementDim>::rollbackTimestepConcreteProcess(GlobalVector const& /*x*/,
+                                                      int const /*process_id*/)
+{
+    DBUG("Rollback time step SmallDeformationNonlocalProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
 template <int DisplacementDim>
 NumLib::IterationResult
 SmallDeformationNonlocalProcess<DisplacementDim>::postIterationConcreteProcess(
@@ -328,6 +341,26 @@ SmallDeformationNonlocalProcess<DisplacementDim>::postIterationConcreteProcess(
     return NumLib::IterationResult::SUCCESS;
 }
 
+template <int DisplacementDim>
+void SmallDeformationNonlocalProcess<DisplacementDim>::writeCheckpoint(
+    std::ostream& out) const
+{
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        local_assembler->writeCheckpoint(out);
+    }
+}
+
+template <int DisplacementDim>
+void SmallDeformationNonlocalProcess<DisplacementDim>::readCheckpoint(
+    std::istream& in)
+{
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        local_assembler->readCheckpoint(in);
+    }
+}
+
 template class SmallDeformationNonlocalProcess<2>;
 template class SmallDeformationNonlocalProcess<3>;
 
@@ -48,6 +48,10 @@ public:
     bool isLinear() const override;
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+    void writeCheckpoint(std::ostream& out) const override;
+    void readCheckpoint(std::istream& in) override;
+
 private:
     void initializeConcreteProcess(
         NumLib::LocalToGlobalIndexMap const& dof_table,
@@ -70,6 +74,9 @@ private:
                                     double const dt,
                                     int const /*process_id*/) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
     NumLib::IterationResult postIterationConcreteProcess(
         GlobalVector const& x) override;
 
@@ -77,11 +77,83 @@ void PythonSourceTerm::integrate(const double t, const GlobalVector& x,
 {
     FlushStdoutGuard guard(_flush_stdout);
 
+    // The batched interface is preferred. If it is not overridden in Python,
+    // the fluxes are computed integration point by integration point.
+    if (_source_term_data.source_term_object->isOverriddenBatched() &&
+        integrateBatched(t, x, b, Jac))
+    {
+        return;
+    }
+
     GlobalExecutor::executeMemberOnDereferenced(
         &PythonSourceTermLocalAssemblerInterface::assemble, _local_assemblers,
         *_source_term_dof_table, t, x, b, Jac);
 }
 
+bool PythonSourceTerm::integrateBatched(const double t, const GlobalVector& x,
+                                        GlobalVector& b,
+                                        GlobalMatrix* Jac) const
+{
+    using RowMajorMatrix =
+        PythonSourceTermLocalAssemblerInterface::RowMajorMatrix;
+
+    // The integration points of each element are stored contiguously.
+    std::vector<Eigen::Index> offsets;
+    offsets.reserve(_local_assemblers.size() + 1);
+    offsets.push_back(0);
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        offsets.push_back(offsets.back() +
+                          local_assembler->getNumberOfIntegrationPoints());
+    }
+    auto const num_integration_points = offsets.back();
+    auto const num_comp_total = _source_term_dof_table->getNumberOfComponents();
+
+    RowMajorMatrix coords(num_integration_points, 3);
+    RowMajorMatrix primary_variables(num_integration_points, num_comp_total);
+    for (std::size_t e = 0; e < _local_assemblers.size(); ++e)
+    {
+        auto const n = offsets[e + 1] - offsets[e];
+        _local_assemblers[e]->getIntegrationPointValues(
+            *_source_term_dof_table, x, coords.middleRows(offsets[e], n),
+            primary_variables.middleRows(offsets[e], n));
+    }
+
+    auto const fluxes_dFluxes = _source_term_data.source_term_object->getFluxes(
+        t, coords, primary_variables);
+    if (!_source_term_data.source_term_object->isOverriddenBatched())
+    {
+        return false;
+    }
+
+    auto const& fluxes = fluxes_dFluxes.first;
+    auto const& dFluxes = fluxes_dFluxes.second;
+    if (fluxes.size() != num_integration_points ||
+        dFluxes.rows() != num_integration_points ||
+        dFluxes.cols() != num_comp_total)
+    {
+        OGS_FATAL(
+            "The Python source term must return the flux and its derivatives "
+            "w.r.t. each primary variable for each of the %d integration "
+            "points, i.e., arrays of the shapes (%d,) and (%d, %d). Arrays of "
+            "the shapes (%d,) and (%d, %d) returned from Python.",
+            static_cast<int>(num_integration_points),
+            static_cast<int>(num_integration_points),
+            static_cast<int>(num_integration_points), num_comp_total,
+            static_cast<int>(fluxes.size()), static_cast<int>(dFluxes.rows()),
+            static_cast<int>(dFluxes.cols()));
+    }
+
+    for (std::size_t e = 0; e < _local_assemblers.size(); ++e)
+    {
+        auto const n = offsets[e + 1] - offsets[e];
+        _local_assemblers[e]->assembleFromFluxes(
+            e, *_source_term_dof_table, fluxes.segment(offsets[e], n),
+            dFluxes.middleRows(offsets[e], n), b, Jac);
+    }
+    return true;
+}
+
 }  // namespace Python
 }  // namespace SourceTerms
 }  // namespace ProcessLib
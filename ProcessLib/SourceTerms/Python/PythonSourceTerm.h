@@ -55,6 +55,14 @@ public:
                    GlobalMatrix* jac) const override;
 
 private:
+    //! Integrates the source term with a single call to
+    //! PythonSourceTermPythonSideInterface::getFluxes() for all integration
+    //! points of the source term mesh.
+    //!
+    //! \return false if getFluxes() is not overridden in Python.
+    bool integrateBatched(const double t, GlobalVector const& x,
+                          GlobalVector& b, GlobalMatrix* Jac) const;
+
     //! Auxiliary data.
     PythonSourceTermData _source_term_data;
 
@@ -90,15 +90,67 @@ public:
                   double const t, const GlobalVector& x, GlobalVector& b,
                   GlobalMatrix* Jac) override
     {
-        using ShapeMatricesType =
-            ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+        unsigned const num_integration_points =
+            getNumberOfIntegrationPoints();
+        auto const num_comp_total =
+            dof_table_source_term.getNumberOfComponents();
+
+        RowMajorMatrix coords(num_integration_points, 3);
+        RowMajorMatrix primary_variables(num_integration_points,
+                                         num_comp_total);
+        getIntegrationPointValues(dof_table_source_term, x, coords,
+                                  primary_variables);
+
+        Eigen::VectorXd fluxes(num_integration_points);
+        RowMajorMatrix dFluxes(num_integration_points, num_comp_total);
+        std::vector<double> prim_vars_data(num_comp_total);
+
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            MathLib::toVector(prim_vars_data) =
+                primary_variables.row(ip).transpose();
+            auto const flux_dflux = _data.source_term_object->getFlux(
+                t, {coords(ip, 0), coords(ip, 1), coords(ip, 2)},
+                prim_vars_data);
+            fluxes[ip] = flux_dflux.first;
+            auto const& dflux = flux_dflux.second;
+
+            if (static_cast<int>(dflux.size()) != num_comp_total)
+            {
+                // This strict check is technically mandatory only if a
+                // Jacobian is assembled. However, it is done as a
+                // consistency check also for cases without Jacobian
+                // assembly.
+                OGS_FATAL(
+                    "The Python source term must return the derivative of "
+                    "the flux w.r.t. each primary variable. %d components "
+                    "expected. %d components returned from Python.",
+                    num_comp_total, dflux.size());
+            }
+            dFluxes.row(ip) = MathLib::toVector(dflux).transpose();
+        }
+
+        assembleFromFluxes(source_term_element_id, dof_table_source_term,
+                           fluxes, dFluxes, b, Jac);
+    }
+
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return _integration_method.getNumberOfPoints();
+    }
+
+    void getIntegrationPointValues(
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        const GlobalVector& x, Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> primary_variables) const override
+    {
         using FemType =
             NumLib::TemplateIsoparametric<ShapeFunction, ShapeMatricesType>;
         FemType fe(*static_cast<const typename ShapeFunction::MeshElement*>(
             &_element));
 
         unsigned const num_integration_points =
-            _integration_method.getNumberOfPoints();
+            getNumberOfIntegrationPoints();
         auto const num_var = dof_table_source_term.getNumberOfVariables();
         auto const num_nodes = ShapeFunction::NPOINTS;
         auto const num_comp_total =
@@ -150,39 +202,39 @@ public:
             }
         }
 
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const& N = _ip_data[ip].N;
+            auto const ip_coords = fe.interpolateCoordinates(N);
+            coords.row(ip) << ip_coords[0], ip_coords[1], ip_coords[2];
+            // Assumption: all primary variables have same shape functions.
+            primary_variables.row(ip).noalias() = N * primary_variables_mat;
+        }
+    }
+
+    void assembleFromFluxes(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        Eigen::Ref<const Eigen::VectorXd> const& fluxes,
+        Eigen::Ref<const RowMajorMatrix> const& dFluxes, GlobalVector& b,
+        GlobalMatrix* Jac) override
+    {
+        unsigned const num_integration_points =
+            getNumberOfIntegrationPoints();
+        auto const num_nodes = ShapeFunction::NPOINTS;
+        auto const num_comp_total =
+            dof_table_source_term.getNumberOfComponents();
+
         NodalRowVectorType local_rhs = Eigen::VectorXd::Zero(num_nodes);
         NodalMatrixType local_Jac =
             Eigen::MatrixXd::Zero(num_nodes, num_nodes * num_comp_total);
-        std::vector<double> prim_vars_data(num_comp_total);
-        auto prim_vars = MathLib::toVector(prim_vars_data);
 
         for (unsigned ip = 0; ip < num_integration_points; ip++)
         {
             auto const& ip_data = _ip_data[ip];
             auto const& N = ip_data.N;
-            auto const& coords = fe.interpolateCoordinates(N);
-            // Assumption: all primary variables have same shape functions.
-            prim_vars = N * primary_variables_mat;
-
             auto const& w = ip_data.integration_weight;
-            auto const flux_dflux =
-                _data.source_term_object->getFlux(t, coords, prim_vars_data);
-            auto const& flux = flux_dflux.first;
-            auto const& dflux = flux_dflux.second;
-            local_rhs.noalias() += N * (flux * w);
-
-            if (static_cast<int>(dflux.size()) != num_comp_total)
-            {
-                // This strict check is technically mandatory only if a
-                // Jacobian is assembled. However, it is done as a
-                // consistency check also for cases without Jacobian
-                // assembly.
-                OGS_FATAL(
-                    "The Python source term must return the derivative of "
-                    "the flux w.r.t. each primary variable. %d components "
-                    "expected. %d components returned from Python.",
-                    num_comp_total, dflux.size());
-            }
+            local_rhs.noalias() += N * (fluxes[ip] * w);
 
             if (Jac)
             {
@@ -195,7 +247,7 @@ public:
                     // The assignement -= takes into account the sign convention
                     // of 1st-order in time ODE systems in OpenGeoSys.
                     local_Jac.block(top, left, width, height).noalias() -=
-                        ip_data.N.transpose() * (dflux[comp] * w) * N;
+                        ip_data.N.transpose() * (dFluxes(ip, comp) * w) * N;
                 }
             }
         }
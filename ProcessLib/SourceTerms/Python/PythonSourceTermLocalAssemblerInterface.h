@@ -10,22 +10,49 @@
 
 #pragma once
 
+#include "PythonSourceTermPythonSideInterface.h"
+
 namespace ProcessLib
 {
 namespace SourceTerms
 {
 namespace Python
 {
-
+//! Local assembler interface of the Python source term. Besides the assembly
+//! calling Python for each integration point, it allows to compute the fluxes
+//! at the integration points of many elements with a single call to Python.
 class PythonSourceTermLocalAssemblerInterface
 {
 public:
+    using RowMajorMatrix = PythonSourceTermPythonSideInterface::RowMajorMatrix;
+
+    //! Assembles the source term calling PythonSourceTermPythonSideInterface::
+    //! getFlux() for each integration point.
     virtual void assemble(
         std::size_t const source_term_element_id,
         NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
         double const t, const GlobalVector& x, GlobalVector& b,
         GlobalMatrix* Jac) = 0;
 
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the coordinates of and the primary variables at the integration
+    //! points of this element to the rows of \c coords and
+    //! \c primary_variables, respectively.
+    virtual void getIntegrationPointValues(
+        NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
+        const GlobalVector& x, Eigen::Ref<RowMajorMatrix> coords,
+        Eigen::Ref<RowMajorMatrix> primary_variables) const = 0;
+
+    //! Assembles the source term from the given fluxes and their derivatives
+    //! w.r.t. the primary variables at the integration points of this element.
+    virtual void assembleFromFluxes(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
+        Eigen::Ref<const Eigen::VectorXd> const& fluxes,
+        Eigen::Ref<const RowMajorMatrix> const& dFluxes, GlobalVector& b,
+        GlobalMatrix* Jac) = 0;
+
     virtual ~PythonSourceTermLocalAssemblerInterface() = default;
 };
 
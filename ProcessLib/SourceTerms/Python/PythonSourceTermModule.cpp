@@ -9,6 +9,7 @@
 
 #include "PythonSourceTermModule.h"
 
+#include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "PythonSourceTermPythonSideInterface.h"
@@ -34,8 +35,17 @@ public:
         std::vector<double> const& primary_variables) const override
     {
         using Ret = std::pair<double, std::vector<double>>;
-        PYBIND11_OVERLOAD_PURE(Ret, PythonSourceTermPythonSideInterface,
-                               getFlux, t, x, primary_variables);
+        PYBIND11_OVERLOAD(Ret, PythonSourceTermPythonSideInterface, getFlux,
+                          t, x, primary_variables);
+    }
+
+    std::pair<Eigen::VectorXd, RowMajorMatrix> getFluxes(
+        double t, RowMajorMatrix const& x,
+        RowMajorMatrix const& primary_variables) const override
+    {
+        using Ret = std::pair<Eigen::VectorXd, RowMajorMatrix>;
+        PYBIND11_OVERLOAD(Ret, PythonSourceTermPythonSideInterface, getFluxes,
+                          t, x, primary_variables);
     }
 };
 
@@ -50,6 +60,7 @@ void pythonBindSourceTerm(pybind11::module& m)
     pybc.def(py::init());
 
     pybc.def("getFlux", &PythonSourceTermPythonSideInterface::getFlux);
+    pybc.def("getFluxes", &PythonSourceTermPythonSideInterface::getFluxes);
 }
 
 }  // namespace Python
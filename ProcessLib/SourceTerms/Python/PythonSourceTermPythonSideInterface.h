@@ -9,6 +9,10 @@
 
 #pragma once
 
+#include <Eigen/Core>
+
+#include "BaseLib/Error.h"
+
 namespace ProcessLib
 {
 namespace SourceTerms
@@ -21,18 +25,63 @@ namespace Python
 class PythonSourceTermPythonSideInterface
 {
 public:
+    //! Row-major matrix, which corresponds to a C-contiguous NumPy array.
+    using RowMajorMatrix =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
     /*!
      * Computes the flux for the provided arguments (time, position of the node,
      * primary variables at the node).
      *
      * \return flux Flux of the source term at that node and derivative of the
      * flux w.r.t. all primary variables.
+     *
+     * Only needs to be overridden in Python if getFluxes() is not.
      */
     virtual std::pair<double, std::vector<double>> getFlux(
         double /*t*/, std::array<double, 3> const& /*x*/,
-        std::vector<double> const& /*primary_variables*/) const = 0;
+        std::vector<double> const& /*primary_variables*/) const
+    {
+        OGS_FATAL(
+            "The Python source term implements neither getFlux() nor "
+            "getFluxes().");
+    }
+
+    /*!
+     * Batched version of getFlux() computing the fluxes for many integration
+     * points with a single call.
+     *
+     * The i-th row of \c x and of \c primary_variables holds the position
+     * of and the primary variables at the i-th integration point,
+     * respectively. The integration points of each source term element are
+     * contiguous.
+     *
+     * \return a pair (flux, flux_jacobian) with the flux at each integration
+     * point and the derivatives of the flux w.r.t. all primary variables, one
+     * row per integration point.
+     *
+     * If this method is overridden in Python, getFlux() is not called.
+     */
+    virtual std::pair<Eigen::VectorXd, RowMajorMatrix> getFluxes(
+        double /*t*/, RowMajorMatrix const& /*x*/,
+        RowMajorMatrix const& /*primary_variables*/) const
+    {
+        _overridden_batched = false;
+        return {};
+    }
+
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    //!
+    //! \pre getFluxes() must already have been called once.
+    bool isOverriddenBatched() const { return _overridden_batched; }
 
     virtual ~PythonSourceTermPythonSideInterface() = default;
+
+private:
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    mutable bool _overridden_batched = true;
 };
 }  // namespace Python
 }  // namespace SourceTerms
@@ -39,6 +39,10 @@ struct ThermoMechanicalPhaseFieldLocalAssemblerInterface
         GlobalVector const& /*current_solution*/,
         NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
         std::vector<double>& cache) const = 0;
+
+    /// Resets the material state of all integration points to the state of
+    /// the beginning of the time step after the time step has been rejected.
+    virtual void popState() = 0;
 };
 
 }  // namespace ThermoMechanicalPhaseField
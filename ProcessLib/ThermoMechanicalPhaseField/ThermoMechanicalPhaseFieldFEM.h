@@ -67,6 +67,12 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        eps = eps_prev;
+        material_state_variables->popState();
+    }
+
     using Invariants = MathLib::KelvinVector::Invariants<
         MathLib::KelvinVector::KelvinVectorDimensions<DisplacementDim>::value>;
 
@@ -233,6 +239,14 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
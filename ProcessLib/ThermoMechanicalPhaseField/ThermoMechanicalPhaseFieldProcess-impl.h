@@ -213,7 +213,7 @@ void ThermoMechanicalPhaseFieldProcess<
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b,
         _coupled_solutions);
@@ -266,7 +266,7 @@ void ThermoMechanicalPhaseFieldProcess<DisplacementDim>::
         _use_monolithic_scheme ? 0 : _coupled_solutions->process_id;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_tables, t, x,
         xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -297,6 +297,19 @@ void ThermoMechanicalPhaseFieldProcess<
         getDOFTable(process_id), x, t, dt);
 }
 
+template <int DisplacementDim>
+void ThermoMechanicalPhaseFieldProcess<
+    DisplacementDim>::rollbackTimestepConcreteProcess(GlobalVector const& /*x*/,
+                                                      int const /*process_id*/)
+{
+    DBUG("Rollback time step ThermoMechanicalPhaseFieldProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
 template <int DisplacementDim>
 void ThermoMechanicalPhaseFieldProcess<
     DisplacementDim>::postTimestepConcreteProcess(GlobalVector const& x,
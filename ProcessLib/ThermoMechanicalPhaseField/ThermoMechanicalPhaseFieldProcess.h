@@ -103,6 +103,9 @@ private:
                                     double const dt,
                                     const int process_id) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
     void postTimestepConcreteProcess(GlobalVector const& x, double const t,
                                      double const dt,
                                      int const process_id) override;
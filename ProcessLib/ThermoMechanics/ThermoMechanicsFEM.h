@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 
+#include "BaseLib/FileTools.h"
 #include "MaterialLib/SolidModels/SelectSolidConstitutiveRelation.h"
 #include "MathLib/KelvinVector.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
@@ -72,6 +73,41 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void popState()
+    {
+        eps = eps_prev;
+        eps_m = eps_m_prev;
+        sigma = sigma_prev;
+        solid_density = solid_density_prev;
+        material_state_variables->popState();
+    }
+
+    /// Writes the complete state as binary into the given stream.
+    void writeState(std::ostream& out) const
+    {
+        for (auto const* v :
+             {&sigma, &sigma_prev, &eps, &eps_prev, &eps_m, &eps_m_prev})
+        {
+            BaseLib::writeValuesBinary(out, v->data(), v->size());
+        }
+        BaseLib::writeValueBinary(out, solid_density);
+        BaseLib::writeValueBinary(out, solid_density_prev);
+        material_state_variables->serialize(out);
+    }
+
+    /// Restores the state written by writeState().
+    void readState(std::istream& in)
+    {
+        for (auto* v :
+             {&sigma, &sigma_prev, &eps, &eps_prev, &eps_m, &eps_m_prev})
+        {
+            BaseLib::readBinaryValues(in, v->data(), v->size());
+        }
+        solid_density = BaseLib::readBinaryValue<double>(in);
+        solid_density_prev = BaseLib::readBinaryValue<double>(in);
+        material_state_variables->deserialize(in);
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
@@ -409,6 +445,30 @@ public:
         }
     }
 
+    void popState() override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.popState();
+        }
+    }
+
+    void writeCheckpoint(std::ostream& out) const override
+    {
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.writeState(out);
+        }
+    }
+
+    void readCheckpoint(std::istream& in) override
+    {
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.readState(in);
+        }
+    }
+
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
@@ -207,7 +207,7 @@ void ThermoMechanicsProcess<DisplacementDim>::assembleConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b,
         _coupled_solutions);
@@ -231,7 +231,7 @@ void ThermoMechanicsProcess<DisplacementDim>::
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeSelectedMemberDereferenced(
+    _assembly_executor.executeSelectedMemberDereferenced(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
         _local_assemblers, pv.getActiveElementIDs(), dof_table, t, x,
         xdot, dxdot_dx, dx_dx, M, K, b, Jac, _coupled_solutions);
@@ -255,6 +255,18 @@ void ThermoMechanicsProcess<DisplacementDim>::preTimestepConcreteProcess(
         dt);
 }
 
+template <int DisplacementDim>
+void ThermoMechanicsProcess<DisplacementDim>::rollbackTimestepConcreteProcess(
+    GlobalVector const& /*x*/, int const /*process_id*/)
+{
+    DBUG("Rollback time step ThermoMechanicsProcess.");
+
+    for (auto& local_assembler : _local_assemblers)
+    {
+        local_assembler->popState();
+    }
+}
+
 template <int DisplacementDim>
 void ThermoMechanicsProcess<DisplacementDim>::postTimestepConcreteProcess(
     GlobalVector const& x, const double /*t*/, const double /*delta_t*/,
@@ -270,6 +282,25 @@ void ThermoMechanicsProcess<DisplacementDim>::postTimestepConcreteProcess(
         *_local_to_global_index_map, x);
 }
 
+template <int DisplacementDim>
+void ThermoMechanicsProcess<DisplacementDim>::writeCheckpoint(
+    std::ostream& out) const
+{
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        local_assembler->writeCheckpoint(out);
+    }
+}
+
+template <int DisplacementDim>
+void ThermoMechanicsProcess<DisplacementDim>::readCheckpoint(std::istream& in)
+{
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        local_assembler->readCheckpoint(in);
+    }
+}
+
 template class ThermoMechanicsProcess<2>;
 template class ThermoMechanicsProcess<3>;
 
@@ -81,6 +81,10 @@ public:
     bool isLinear() const override;
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+    void writeCheckpoint(std::ostream& out) const override;
+    void readCheckpoint(std::istream& in) override;
+
 private:
     void initializeConcreteProcess(
         NumLib::LocalToGlobalIndexMap const& dof_table,
@@ -100,6 +104,9 @@ private:
         GlobalVector const& x, double const t, double const dt,
         const int process_id) override;
 
+    void rollbackTimestepConcreteProcess(GlobalVector const& x,
+                                         int const process_id) override;
+
     void postTimestepConcreteProcess(GlobalVector const& x, const double t,
                                      const double delta_t,
                                      int const process_id) override;
@@ -9,7 +9,17 @@
 
 #include "UncoupledProcessesTimeLoop.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#ifdef USE_PETSC
+#include <petsc.h>
+#endif
+
 #include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
 #include "BaseLib/RunTime.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
@@ -77,6 +87,13 @@ void setTimeDiscretizedODESystem(
         // because the Newton ODESystem derives from the Picard ODESystem.
         // So no further checks are needed here.
 
+        if (process_data.local_residual_assembly)
+        {
+            WARN(
+                "The local assembly of the residual is only available for the "
+                "Newton-Raphson method and will be ignored.");
+        }
+
         process_data.tdisc_ode_sys = std::make_unique<
             NumLib::TimeDiscretizedODESystem<ODETag, Tag::Picard>>(
             process_data.process_id, ode_sys, *process_data.time_disc);
@@ -91,7 +108,8 @@ void setTimeDiscretizedODESystem(
         {
             process_data.tdisc_ode_sys = std::make_unique<
                 NumLib::TimeDiscretizedODESystem<ODETag, Tag::Newton>>(
-                process_data.process_id, *ode_newton, *process_data.time_disc);
+                process_data.process_id, *ode_newton, *process_data.time_disc,
+                process_data.local_residual_assembly);
         }
         else
         {
@@ -155,6 +173,32 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
         createOutput(config.getConfigSubtree("output"), output_directory,
                      meshes);
 
+    CheckpointSettings checkpoint_settings;
+    if (auto const checkpoint_config =
+            //! \ogs_file_param{prj__time_loop__checkpoint}
+        config.getConfigSubtreeOptional("checkpoint"))
+    {
+        checkpoint_settings.each_steps =
+            //! \ogs_file_param{prj__time_loop__checkpoint__each_steps}
+            checkpoint_config->getConfigParameter<unsigned>("each_steps");
+        auto const prefix =
+            //! \ogs_file_param{prj__time_loop__checkpoint__prefix}
+            checkpoint_config->getConfigParameter<std::string>("prefix",
+                                                               "checkpoint");
+        checkpoint_settings.resume =
+            //! \ogs_file_param{prj__time_loop__checkpoint__resume}
+            checkpoint_config->getConfigParameter<bool>("resume", false);
+
+        checkpoint_settings.file_name =
+            BaseLib::joinPaths(output_directory, prefix);
+#ifdef USE_PETSC
+        int rank;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+        checkpoint_settings.file_name += "_" + std::to_string(rank);
+#endif
+        checkpoint_settings.file_name += ".ckpt";
+    }
+
     auto per_process_data = createPerProcessData(
         //! \ogs_file_param{prj__time_loop__processes}
         config.getConfigSubtree("processes"), processes, nonlinear_solvers);
@@ -187,7 +231,8 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
 
     return std::make_unique<UncoupledProcessesTimeLoop>(
         std::move(output), std::move(per_process_data), max_coupling_iterations,
-        std::move(global_coupling_conv_criteria), start_time, end_time);
+        std::move(global_coupling_conv_criteria), start_time, end_time,
+        std::move(checkpoint_settings));
 }
 
 std::vector<GlobalVector*> setInitialConditions(
@@ -279,13 +324,15 @@ UncoupledProcessesTimeLoop::UncoupledProcessesTimeLoop(
     const int global_coupling_max_iterations,
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
         global_coupling_conv_crit,
-    const double start_time, const double end_time)
+    const double start_time, const double end_time,
+    CheckpointSettings checkpoint_settings)
     : _output(std::move(output)),
       _per_process_data(std::move(per_process_data)),
       _start_time(start_time),
       _end_time(end_time),
       _global_coupling_max_iterations(global_coupling_max_iterations),
-      _global_coupling_conv_crit(std::move(global_coupling_conv_crit))
+      _global_coupling_conv_crit(std::move(global_coupling_conv_crit)),
+      _checkpoint_settings(std::move(checkpoint_settings))
 {
 }
 
@@ -401,10 +448,13 @@ double UncoupledProcessesTimeLoop::computeTimeStepping(
     // Update the solution of the previous time step in time_disc.
     for (std::size_t i = 0; i < _per_process_data.size(); i++)
     {
-        const auto& ppd = *_per_process_data[i];
+        auto& ppd = *_per_process_data[i];
         auto& timestepper = ppd.timestepper;
         timestepper->resetCurrentTimeStep(dt);
 
+        bool const timestep_started = ppd.timestep_started;
+        ppd.timestep_started = false;
+
         if (ppd.skip_time_stepping)
         {
             continue;
@@ -433,6 +483,12 @@ double UncoupledProcessesTimeLoop::computeTimeStepping(
                     "and it will be repeated with a reduced step size.",
                     accepted_steps + 1, _repeating_times_of_rejected_step);
                 time_disc->popState(x);
+                // Processes not reached before the failure still hold the
+                // state of the last accepted time step.
+                if (timestep_started)
+                {
+                    ppd.process.rollbackTimestep(x, i);
+                }
             }
         }
     }
@@ -511,19 +567,38 @@ bool UncoupledProcessesTimeLoop::loop()
 
     const bool is_staggered_coupling = setCoupledSolutions();
 
-    // Output initial conditions
-    {
-        const bool output_initial_condition = true;
-        outputSolutions(output_initial_condition, is_staggered_coupling, 0,
-                        _start_time, *_output, &Output::doOutput);
-    }
-
     double t = _start_time;
     std::size_t accepted_steps = 0;
     std::size_t rejected_steps = 0;
     NumLib::NonlinearSolverStatus nonlinear_solver_status{true, 0};
+    double dt = 0;
+
+    if (_checkpoint_settings.each_steps > 0 || _checkpoint_settings.resume)
+    {
+        for (auto const& process_data : _per_process_data)
+        {
+            if (!process_data->process.isCheckpointSupported())
+            {
+                OGS_FATAL(
+                    "Checkpoints are enabled, but the process with "
+                    "process_id %d cannot store and restore its complete "
+                    "integration point state.",
+                    process_data->process_id);
+            }
+        }
+    }
+
+    if (!readCheckpoint(t, dt, accepted_steps, rejected_steps))
+    {
+        // Output initial conditions
+        {
+            const bool output_initial_condition = true;
+            outputSolutions(output_initial_condition, is_staggered_coupling, 0,
+                            _start_time, *_output, &Output::doOutput);
+        }
 
-    double dt = computeTimeStepping(0.0, t, accepted_steps, rejected_steps);
+        dt = computeTimeStepping(0.0, t, accepted_steps, rejected_steps);
+    }
 
     while (t < _end_time)
     {
@@ -567,6 +642,12 @@ bool UncoupledProcessesTimeLoop::loop()
             const bool output_initial_condition = false;
             outputSolutions(output_initial_condition, is_staggered_coupling,
                             timesteps, t, *_output, &Output::doOutput);
+
+            if (_checkpoint_settings.each_steps > 0 &&
+                accepted_steps % _checkpoint_settings.each_steps == 0)
+            {
+                writeCheckpoint(t, dt, accepted_steps, rejected_steps);
+            }
         }
 
         if (t + dt > _end_time ||
@@ -602,6 +683,163 @@ bool UncoupledProcessesTimeLoop::loop()
     return nonlinear_solver_status.error_norms_met;
 }
 
+//! Identifies checkpoint files and their format version.
+static char const checkpoint_magic[8] = {'O', 'G', 'S', 'C', 'K', 'P', 'T', 2};
+
+//! Returns each process of the given process data once in the order of their
+//! first occurrence. A process solved by the staggered scheme occurs once per
+//! process_id, but its integration point state is stored only once.
+static std::vector<Process*> uniqueProcesses(
+    std::vector<std::unique_ptr<ProcessData>> const& per_process_data)
+{
+    std::vector<Process*> processes;
+    for (auto const& ppd : per_process_data)
+    {
+        if (std::find(processes.begin(), processes.end(), &ppd->process) ==
+            processes.end())
+        {
+            processes.push_back(&ppd->process);
+        }
+    }
+    return processes;
+}
+
+void UncoupledProcessesTimeLoop::writeCheckpoint(
+    double const t, double const dt, std::size_t const accepted_steps,
+    std::size_t const rejected_steps) const
+{
+    BaseLib::RunTime time_checkpoint;
+    time_checkpoint.start();
+
+    auto const tmp_file_name = _checkpoint_settings.file_name + ".tmp";
+    {
+        std::ofstream out(tmp_file_name, std::ios::binary);
+        if (!out)
+        {
+            OGS_FATAL("Could not open the checkpoint file '%s' for writing.",
+                      tmp_file_name.c_str());
+        }
+
+        out.write(checkpoint_magic, sizeof(checkpoint_magic));
+        BaseLib::writeValueBinary(out, t);
+        BaseLib::writeValueBinary(out, dt);
+        BaseLib::writeValueBinary(out,
+                                  static_cast<std::uint64_t>(accepted_steps));
+        BaseLib::writeValueBinary(out,
+                                  static_cast<std::uint64_t>(rejected_steps));
+        BaseLib::writeValueBinary(out, _repeating_times_of_rejected_step);
+
+        BaseLib::writeValueBinary(
+            out, static_cast<std::uint64_t>(_per_process_data.size()));
+        for (std::size_t i = 0; i < _per_process_data.size(); i++)
+        {
+            auto const& ppd = *_per_process_data[i];
+            BaseLib::writeValueBinary(out, ppd.skip_time_stepping);
+            ppd.timestepper->writeState(out);
+            ppd.time_disc->writeState(out);
+            MathLib::LinAlg::writeBinary(out, *_process_solutions[i]);
+        }
+        for (auto const* process : uniqueProcesses(_per_process_data))
+        {
+            process->writeCheckpoint(out);
+        }
+
+        _output->writeCheckpoint(out);
+
+        if (!out)
+        {
+            OGS_FATAL("Could not write the checkpoint file '%s'.",
+                      tmp_file_name.c_str());
+        }
+    }
+
+    if (std::rename(tmp_file_name.c_str(),
+                    _checkpoint_settings.file_name.c_str()) != 0)
+    {
+        OGS_FATAL("Could not rename the checkpoint file '%s' to '%s'.",
+                  tmp_file_name.c_str(),
+                  _checkpoint_settings.file_name.c_str());
+    }
+
+    INFO("[time] Writing the checkpoint at time %g took %g s.", t,
+         time_checkpoint.elapsed());
+}
+
+bool UncoupledProcessesTimeLoop::readCheckpoint(double& t, double& dt,
+                                                std::size_t& accepted_steps,
+                                                std::size_t& rejected_steps)
+{
+    if (!_checkpoint_settings.resume)
+    {
+        return false;
+    }
+
+    std::ifstream in(_checkpoint_settings.file_name, std::ios::binary);
+    if (!in)
+    {
+        INFO("No checkpoint file '%s' found. Starting from the beginning.",
+             _checkpoint_settings.file_name.c_str());
+        return false;
+    }
+
+    char magic[sizeof(checkpoint_magic)];
+    in.read(magic, sizeof(magic));
+    if (!in || !std::equal(std::begin(magic), std::end(magic),
+                           std::begin(checkpoint_magic)))
+    {
+        OGS_FATAL("The file '%s' is not a compatible checkpoint file.",
+                  _checkpoint_settings.file_name.c_str());
+    }
+
+    t = BaseLib::readBinaryValue<double>(in);
+    dt = BaseLib::readBinaryValue<double>(in);
+    accepted_steps = BaseLib::readBinaryValue<std::uint64_t>(in);
+    rejected_steps = BaseLib::readBinaryValue<std::uint64_t>(in);
+    _repeating_times_of_rejected_step = BaseLib::readBinaryValue<int>(in);
+    _last_step_rejected = false;
+
+    if (BaseLib::readBinaryValue<std::uint64_t>(in) != _per_process_data.size())
+    {
+        OGS_FATAL(
+            "The checkpoint file '%s' has been written for a different number "
+            "of processes.",
+            _checkpoint_settings.file_name.c_str());
+    }
+    for (std::size_t i = 0; i < _per_process_data.size(); i++)
+    {
+        auto& ppd = *_per_process_data[i];
+        ppd.skip_time_stepping = BaseLib::readBinaryValue<bool>(in);
+        ppd.timestepper->readState(in);
+        ppd.time_disc->readState(in);
+        MathLib::LinAlg::readBinary(in, *_process_solutions[i]);
+    }
+    for (auto* process : uniqueProcesses(_per_process_data))
+    {
+        process->readCheckpoint(in);
+    }
+
+    _output->readCheckpoint(in);
+
+    if (!in)
+    {
+        OGS_FATAL("Could not read the checkpoint file '%s'.",
+                  _checkpoint_settings.file_name.c_str());
+    }
+
+    if (!_solutions_of_last_cpl_iteration.empty())
+    {
+        for (std::size_t i = 0; i < _process_solutions.size(); i++)
+        {
+            MathLib::LinAlg::copy(*_process_solutions[i],
+                                  *_solutions_of_last_cpl_iteration[i]);
+        }
+    }
+
+    INFO("Resuming from the checkpoint '%s' at time step #%u and time %g.",
+         _checkpoint_settings.file_name.c_str(), accepted_steps, t);
+    return true;
+}
+
 static std::string const nonlinear_fixed_dt_fails_info =
     "Nonlinear solver fails. Because the time stepper FixedTimeStepping is "
     "used, the program has to be terminated.";
@@ -628,6 +866,7 @@ UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
         auto& x = *_process_solutions[process_id];
         auto& pcs = process_data->process;
         pcs.preTimestep(x, t, dt, process_id);
+        process_data->timestep_started = true;
 
         nonlinear_solver_status = solveOneTimeStepOneProcess(
             process_id, x, timestep_id, t, dt, *process_data, *_output);
@@ -687,16 +926,21 @@ UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
         {
             auto& x = *_process_solutions[process_id];
             process_data->process.preTimestep(x, t, dt, process_id);
+            process_data->timestep_started = true;
             ++process_id;
         }
     }
 
+    std::vector<double> process_solve_times(_per_process_data.size(), 0.);
+    int number_of_coupling_iterations = 0;
+
     NumLib::NonlinearSolverStatus nonlinear_solver_status{true, 0};
     bool coupling_iteration_converged = true;
     for (int global_coupling_iteration = 0;
          global_coupling_iteration < _global_coupling_max_iterations;
          global_coupling_iteration++, resetCouplingConvergenceCriteria())
     {
+        number_of_coupling_iterations = global_coupling_iteration + 1;
         // TODO(wenqing): use process name
         coupling_iteration_converged = true;
         int process_id = 0;
@@ -724,6 +968,7 @@ UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
             nonlinear_solver_status = solveOneTimeStepOneProcess(
                 process_id, x, timestep_id, t, dt, *process_data, *_output);
             process_data->nonlinear_solver_status = nonlinear_solver_status;
+            process_solve_times[process_id] += time_timestep_process.elapsed();
 
             INFO(
                 "[time] Solving process #%u took %g s in time step #%u "
@@ -789,6 +1034,14 @@ UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
             timestep_id, t);
     }
 
+    INFO("The staggered coupling took %d iterations in time step #%u.",
+         number_of_coupling_iterations, timestep_id);
+    for (std::size_t i = 0; i < _per_process_data.size(); i++)
+    {
+        INFO("[time] Solving process #%u took %g s in total in time step #%u.",
+             i, process_solve_times[i], timestep_id);
+    }
+
     int process_id = 0;
     for (auto& process_data : _per_process_data)
     {
@@ -9,8 +9,9 @@
 
 #pragma once
 
-#include <memory>
 #include <functional>
+#include <memory>
+#include <string>
 
 #include <logog/include/logog.hpp>
 
@@ -29,6 +30,19 @@ namespace ProcessLib
 {
 struct ProcessData;
 
+/// Settings for writing checkpoints, from which an interrupted simulation can
+/// be resumed.
+struct CheckpointSettings
+{
+    /// Path of the checkpoint file.
+    std::string file_name;
+    /// A checkpoint is written every \c each_steps accepted time steps. Zero
+    /// disables checkpointing.
+    unsigned each_steps = 0;
+    /// Resume the simulation from the checkpoint file if it exists.
+    bool resume = false;
+};
+
 /// Time loop capable of time-integrating several processes at once.
 /// TODO: Rename to, e.g., TimeLoop, since it is not for purely uncoupled stuff
 /// anymore.
@@ -41,7 +55,8 @@ public:
         const int global_coupling_max_iterations,
         std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
             global_coupling_conv_crit,
-        const double start_time, const double end_time);
+        const double start_time, const double end_time,
+        CheckpointSettings checkpoint_settings = {});
 
     bool loop();
 
@@ -87,6 +102,8 @@ private:
     /// criteria of the coupling iteration.
     std::vector<GlobalVector*> _solutions_of_last_cpl_iteration;
 
+    CheckpointSettings const _checkpoint_settings;
+
     /**
      * \brief Member to solver non coupled systems of equations, which can be
      *        a single system of equations, or several systems of equations
@@ -129,6 +146,21 @@ private:
                                std::size_t& accepted_steps,
                                std::size_t& rejected_steps);
 
+    /// Writes the state of the time loop after an accepted time step to the
+    /// checkpoint file. The file is replaced only after it has been written
+    /// completely.
+    void writeCheckpoint(double const t, double const dt,
+                         std::size_t const accepted_steps,
+                         std::size_t const rejected_steps) const;
+
+    /// Restores the state written by writeCheckpoint() if resuming is enabled
+    /// and the checkpoint file exists. Must be called after the initial
+    /// conditions have been set.
+    ///
+    /// \return true if the state has been restored.
+    bool readCheckpoint(double& t, double& dt, std::size_t& accepted_steps,
+                        std::size_t& rejected_steps);
+
     template <typename OutputClass, typename OutputClassMember>
     void outputSolutions(bool const output_initial_condition,
                          bool const is_staggered_coupling, unsigned timestep,
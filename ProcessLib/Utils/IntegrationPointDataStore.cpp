@@ -0,0 +1,140 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "IntegrationPointDataStore.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "NumLib/Fem/Integration/NumberOfIntegrationPoints.h"
+
+namespace ProcessLib
+{
+IntegrationPointDataStore::IntegrationPointDataStore(
+    std::vector<unsigned> const& number_of_integration_points)
+{
+    _offsets.reserve(number_of_integration_points.size() + 1);
+    _offsets.push_back(0);
+    for (auto const n : number_of_integration_points)
+    {
+        _offsets.push_back(_offsets.back() + n);
+    }
+}
+
+IntegrationPointDataStore::IntegrationPointDataStore(
+    std::vector<MeshLib::Element*> const& elements,
+    unsigned const integration_order)
+{
+    _offsets.resize(elements.size() + 1);
+    _offsets[0] = 0;
+    for (auto const* e : elements)
+    {
+        // The number of integration points is stored at the next position
+        // and then summed up.
+        _offsets[e->getID() + 1] =
+            NumLib::getNumberOfGaussLegendreIntegrationPoints(
+                *e, integration_order);
+    }
+    std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+}
+
+int IntegrationPointDataStore::addField(std::string name,
+                                        int const number_of_components)
+{
+    if (findField(name) >= 0)
+    {
+        OGS_FATAL("The integration point data field '%s' exists already.",
+                  name.c_str());
+    }
+    if (number_of_components <= 0)
+    {
+        OGS_FATAL(
+            "The number of components of the integration point data field "
+            "'%s' must be positive, got %d.",
+            name.c_str(), number_of_components);
+    }
+
+    _fields.push_back(
+        {std::move(name), number_of_components,
+         std::vector<double>(number_of_components *
+                             getNumberOfIntegrationPoints())});
+    return static_cast<int>(_fields.size()) - 1;
+}
+
+void IntegrationPointDataStore::copyField(int const source,
+                                          int const destination)
+{
+    auto const& from = _fields[source];
+    auto& to = _fields[destination];
+    if (from.number_of_components != to.number_of_components)
+    {
+        OGS_FATAL(
+            "Cannot copy the integration point data field '%s' with %d "
+            "components to the field '%s' with %d components.",
+            from.name.c_str(), from.number_of_components, to.name.c_str(),
+            to.number_of_components);
+    }
+    std::copy(from.values.begin(), from.values.end(), to.values.begin());
+}
+
+void IntegrationPointDataStore::writeFields(std::ostream& out) const
+{
+    BaseLib::writeValueBinary(out, static_cast<std::uint64_t>(_fields.size()));
+    for (auto const& field : _fields)
+    {
+        BaseLib::writeVectorBinary(
+            out, std::vector<char>(field.name.begin(), field.name.end()));
+        BaseLib::writeValueBinary(out, field.number_of_components);
+        BaseLib::writeVectorBinary(out, field.values);
+    }
+}
+
+void IntegrationPointDataStore::readFields(std::istream& in)
+{
+    auto const number_of_fields = BaseLib::readBinaryValue<std::uint64_t>(in);
+    if (!in || number_of_fields != _fields.size())
+    {
+        OGS_FATAL(
+            "Expected %d integration point data fields in the input, but read "
+            "%d.",
+            getNumberOfFields(), static_cast<int>(number_of_fields));
+    }
+    for (auto& field : _fields)
+    {
+        auto const name_chars = BaseLib::readBinaryVector<char>(in);
+        std::string const name(name_chars.begin(), name_chars.end());
+        auto const number_of_components = BaseLib::readBinaryValue<int>(in);
+        auto const values = BaseLib::readBinaryVector<double>(in);
+        if (!in || name != field.name ||
+            number_of_components != field.number_of_components ||
+            values.size() != field.values.size())
+        {
+            OGS_FATAL(
+                "The integration point data field '%s' read does not match "
+                "the field '%s' with %d components and %d values.",
+                name.c_str(), field.name.c_str(), field.number_of_components,
+                static_cast<int>(field.values.size()));
+        }
+        std::copy(values.begin(), values.end(), field.values.begin());
+    }
+}
+
+int IntegrationPointDataStore::findField(std::string const& name) const
+{
+    auto const it =
+        std::find_if(_fields.begin(), _fields.end(),
+                     [&name](Field const& f) { return f.name == name; });
+    return it == _fields.end() ? -1
+                               : static_cast<int>(
+                                     std::distance(_fields.begin(), it));
+}
+}  // namespace ProcessLib
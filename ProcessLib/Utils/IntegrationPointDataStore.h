@@ -0,0 +1,182 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace MeshLib
+{
+class Element;
+}
+
+namespace ProcessLib
+{
+/// Process-wide storage of integration point data in a structure-of-arrays
+/// layout.
+///
+/// Each field, e.g., the stresses, is stored in one contiguous array holding
+/// the values of all integration points of all elements. The values of one
+/// integration point are stored one after another, followed by the next
+/// integration point of the same element, and the elements are stored in the
+/// order of their ids. The local assemblers get views to their part of the
+/// fields. This saves the heap allocations and the padding of per integration
+/// point structures and allows operations on whole fields, e.g., copying the
+/// current state to the previous one.
+///
+/// All fields are allocated once on creation, hence the views stay valid
+/// during the lifetime of the store.
+class IntegrationPointDataStore final
+{
+public:
+    IntegrationPointDataStore() = default;
+
+    /// \param number_of_integration_points the number of integration points
+    ///        of each element indexed by the element id.
+    explicit IntegrationPointDataStore(
+        std::vector<unsigned> const& number_of_integration_points);
+
+    /// Creates a store for the given elements, which are integrated by the
+    /// Gauss-Legendre method of the given order,
+    /// cf. NumLib::getNumberOfGaussLegendreIntegrationPoints().
+    IntegrationPointDataStore(std::vector<MeshLib::Element*> const& elements,
+                              unsigned const integration_order);
+
+    /// Adds a zero initialized field with the given number of components per
+    /// integration point.
+    /// \return The index of the new field.
+    int addField(std::string name, int const number_of_components);
+
+    /// \return The index of the field with the given name or -1 if there is no
+    /// such field.
+    int findField(std::string const& name) const;
+
+    std::string const& getFieldName(int const field) const
+    {
+        return _fields[field].name;
+    }
+
+    int getNumberOfComponents(int const field) const
+    {
+        return _fields[field].number_of_components;
+    }
+
+    int getNumberOfFields() const { return static_cast<int>(_fields.size()); }
+
+    /// Total number of integration points of all elements.
+    std::size_t getNumberOfIntegrationPoints() const
+    {
+        return _offsets.empty() ? 0 : _offsets.back();
+    }
+
+    unsigned getNumberOfIntegrationPoints(std::size_t const element_id) const
+    {
+        return static_cast<unsigned>(_offsets[element_id + 1] -
+                                     _offsets[element_id]);
+    }
+
+    /// Pointer to the values of the given integration point.
+    double* data(int const field, std::size_t const element_id,
+                 unsigned const integration_point = 0)
+    {
+        return _fields[field].values.data() +
+               index(field, element_id, integration_point);
+    }
+
+    double const* data(int const field, std::size_t const element_id,
+                       unsigned const integration_point = 0) const
+    {
+        return _fields[field].values.data() +
+               index(field, element_id, integration_point);
+    }
+
+    /// View to the values of the given integration point as a column vector.
+    template <typename Vector>
+    Eigen::Map<Vector> value(int const field, std::size_t const element_id,
+                             unsigned const integration_point)
+    {
+        assert(Vector::SizeAtCompileTime ==
+               _fields[field].number_of_components);
+        return Eigen::Map<Vector>(data(field, element_id, integration_point));
+    }
+
+    /// View to the values of all integration points of the given element. The
+    /// columns correspond to the integration points.
+    template <int NumberOfComponents>
+    Eigen::Map<Eigen::Matrix<double, NumberOfComponents, Eigen::Dynamic>>
+    elementValues(int const field, std::size_t const element_id)
+    {
+        assert(NumberOfComponents == _fields[field].number_of_components);
+        return {data(field, element_id), NumberOfComponents,
+                getNumberOfIntegrationPoints(element_id)};
+    }
+
+    template <int NumberOfComponents>
+    Eigen::Map<Eigen::Matrix<double, NumberOfComponents, Eigen::Dynamic> const>
+    elementValues(int const field, std::size_t const element_id) const
+    {
+        assert(NumberOfComponents == _fields[field].number_of_components);
+        return {data(field, element_id), NumberOfComponents,
+                getNumberOfIntegrationPoints(element_id)};
+    }
+
+    /// The values of all integration points of all elements.
+    std::vector<double>& values(int const field)
+    {
+        return _fields[field].values;
+    }
+
+    std::vector<double> const& values(int const field) const
+    {
+        return _fields[field].values;
+    }
+
+    /// Copies the values of all integration points of the \c source field to
+    /// the \c destination field, e.g., the current state to the previous one.
+    /// Both fields must have the same number of components.
+    void copyField(int const source, int const destination);
+
+    /// Writes the names, the numbers of components and the values of all
+    /// fields as binary into the given stream, e.g. for a checkpoint.
+    void writeFields(std::ostream& out) const;
+
+    /// Restores the values of all fields written by writeFields(). The fields
+    /// read must match the fields of this store. The values are overwritten
+    /// in place, hence existing views stay valid.
+    void readFields(std::istream& in);
+
+private:
+    std::size_t index(int const field, std::size_t const element_id,
+                      unsigned const integration_point) const
+    {
+        assert(integration_point < getNumberOfIntegrationPoints(element_id));
+        return (_offsets[element_id] + integration_point) *
+               _fields[field].number_of_components;
+    }
+
+    struct Field
+    {
+        std::string name;
+        int number_of_components;
+        std::vector<double> values;
+    };
+
+    /// Index of the first integration point of each element and the total
+    /// number of integration points as last entry.
+    std::vector<std::size_t> _offsets;
+
+    std::vector<Field> _fields;
+};
+}  // namespace ProcessLib
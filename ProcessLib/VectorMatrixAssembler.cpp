@@ -12,6 +12,7 @@
 #include <cassert>
 #include <functional>  // for std::reference_wrapper.
 
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "LocalAssemblerInterface.h"
@@ -19,12 +20,62 @@
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "Process.h"
 
+namespace
+{
+/// Adds the local matrix at the positions cached for the DOF table if
+/// available, cf. MathLib::EigenMatrix::cacheLocalMatrixOffsets().
+void addToMatrix(GlobalMatrix& A,
+                 NumLib::LocalToGlobalIndexMap const& dof_table,
+                 std::size_t const mesh_item_id,
+                 NumLib::LocalToGlobalIndexMap::RowColumnIndices const& indices,
+                 std::vector<double> const& local_A_data)
+{
+    auto const num_r_c = indices.rows.size();
+    auto const local_A = MathLib::toMatrix(local_A_data, num_r_c, num_r_c);
+#ifndef USE_PETSC
+    if (auto const* const offsets = A.findLocalMatrixOffsets(&dof_table))
+    {
+        A.add(*offsets, mesh_item_id, local_A);
+        return;
+    }
+#else
+    (void)dof_table;
+    (void)mesh_item_id;
+#endif
+    A.add(indices, local_A);
+}
+}  // namespace
+
 namespace ProcessLib
 {
 VectorMatrixAssembler::VectorMatrixAssembler(
     std::unique_ptr<AbstractJacobianAssembler>&& jacobian_assembler)
-    : _jacobian_assembler(std::move(jacobian_assembler))
+    : _thread_local_data(1)
+{
+    _thread_local_data[0].jacobian_assembler = std::move(jacobian_assembler);
+}
+
+void VectorMatrixAssembler::setNumberOfThreads(int const number_of_threads)
+{
+    assert(number_of_threads > 0);
+    auto const& jacobian_assembler = *_thread_local_data[0].jacobian_assembler;
+
+    _thread_local_data.resize(number_of_threads);
+    for (auto& data : _thread_local_data)
+    {
+        if (!data.jacobian_assembler)
+        {
+            data.jacobian_assembler = jacobian_assembler.copy();
+        }
+    }
+}
+
+VectorMatrixAssembler::ThreadLocalData&
+VectorMatrixAssembler::getThreadLocalData()
 {
+    auto const thread_number = NumLib::getThreadNumber();
+    assert(thread_number < static_cast<int>(_thread_local_data.size()));
+    return _thread_local_data[thread_number];
 }
 
 void VectorMatrixAssembler::preAssemble(
@@ -53,18 +104,23 @@ void VectorMatrixAssembler::assemble(
             NumLib::getIndices(mesh_item_id, dof_table.get()));
     }
 
-    auto const& indices = (cpl_xs == nullptr)
-                              ? indices_of_processes[0]
-                              : indices_of_processes[cpl_xs->process_id];
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
+    auto const process_id = (cpl_xs == nullptr) ? 0 : cpl_xs->process_id;
+    auto const& dof_table = dof_tables[process_id].get();
+    auto const& indices = indices_of_processes[process_id];
+
+    auto& data = getThreadLocalData();
+    auto& local_M_data = data.local_M_data;
+    auto& local_K_data = data.local_K_data;
+    auto& local_b_data = data.local_b_data;
+    local_M_data.clear();
+    local_K_data.clear();
+    local_b_data.clear();
 
     if (cpl_xs == nullptr)
     {
         auto const local_x = x.get(indices);
-        local_assembler.assemble(t, local_x, _local_M_data, _local_K_data,
-                                 _local_b_data);
+        local_assembler.assemble(t, local_x, local_M_data, local_K_data,
+                                 local_b_data);
     }
     else
     {
@@ -77,29 +133,26 @@ void VectorMatrixAssembler::assemble(
             cpl_xs->dt, cpl_xs->process_id, std::move(local_coupled_xs0),
             std::move(local_coupled_xs));
 
-        local_assembler.assembleForStaggeredScheme(t, _local_M_data,
-                                                   _local_K_data, _local_b_data,
+        local_assembler.assembleForStaggeredScheme(t, local_M_data,
+                                                   local_K_data, local_b_data,
                                                    local_coupled_solutions);
     }
 
-    auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
+    if (!local_M_data.empty())
     {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
+        addToMatrix(M, dof_table, mesh_item_id, r_c_indices, local_M_data);
     }
-    if (!_local_K_data.empty())
+    if (!local_K_data.empty())
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
+        addToMatrix(K, dof_table, mesh_item_id, r_c_indices, local_K_data);
     }
-    if (!_local_b_data.empty())
+    if (!local_b_data.empty())
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        assert(local_b_data.size() == indices.size());
+        b.add(indices, local_b_data);
     }
 }
 
@@ -120,22 +173,32 @@ void VectorMatrixAssembler::assembleWithJacobian(
             NumLib::getIndices(mesh_item_id, dof_table.get()));
     }
 
-    auto const& indices = (cpl_xs == nullptr)
-                              ? indices_of_processes[0]
-                              : indices_of_processes[cpl_xs->process_id];
+    auto const process_id = (cpl_xs == nullptr) ? 0 : cpl_xs->process_id;
+    auto const& dof_table = dof_tables[process_id].get();
+    auto const& indices = indices_of_processes[process_id];
+
+    // The x passed by the time discretized ODE system is the current solution
+    // x_C, cf. NumLib::TimeDiscretization::getCurrentX(), e.g., the old
+    // timestep's solution for the forward Euler scheme. It is used for the
+    // local assembly and for the local residual alike.
+    auto const local_x = x.get(indices);
     auto const local_xdot = xdot.get(indices);
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
-    _local_Jac_data.clear();
+    auto& data = getThreadLocalData();
+    auto& local_M_data = data.local_M_data;
+    auto& local_K_data = data.local_K_data;
+    auto& local_b_data = data.local_b_data;
+    auto& local_Jac_data = data.local_Jac_data;
+    local_M_data.clear();
+    local_K_data.clear();
+    local_b_data.clear();
+    local_Jac_data.clear();
 
     if (cpl_xs == nullptr)
     {
-        auto const local_x = x.get(indices);
-        _jacobian_assembler->assembleWithJacobian(
+        data.jacobian_assembler->assembleWithJacobian(
             local_assembler, t, local_x, local_xdot, dxdot_dx, dx_dx,
-            _local_M_data, _local_K_data, _local_b_data, _local_Jac_data);
+            local_M_data, local_K_data, local_b_data, local_Jac_data);
     }
     else
     {
@@ -148,36 +211,55 @@ void VectorMatrixAssembler::assembleWithJacobian(
             cpl_xs->dt, cpl_xs->process_id, std::move(local_coupled_xs0),
             std::move(local_coupled_xs));
 
-        _jacobian_assembler->assembleWithJacobianForStaggeredScheme(
-            local_assembler, t, local_xdot, dxdot_dx, dx_dx, _local_M_data,
-            _local_K_data, _local_b_data, _local_Jac_data,
+        data.jacobian_assembler->assembleWithJacobianForStaggeredScheme(
+            local_assembler, t, local_xdot, dxdot_dx, dx_dx, local_M_data,
+            local_K_data, local_b_data, local_Jac_data,
             local_coupled_solutions);
     }
 
-    auto const num_r_c = indices.size();
+    if (_local_residual_assembly &&
+        !(local_M_data.empty() && local_K_data.empty()))
+    {
+        // b := b - M * xdot - K * x
+        auto const num_r_c = indices.size();
+        local_b_data.resize(num_r_c);
+        auto local_b = MathLib::toVector(local_b_data);
+        if (!local_M_data.empty())
+        {
+            local_b.noalias() -=
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c) *
+                MathLib::toVector(local_xdot);
+            local_M_data.clear();
+        }
+        if (!local_K_data.empty())
+        {
+            local_b.noalias() -=
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c) *
+                MathLib::toVector(local_x);
+            local_K_data.clear();
+        }
+    }
+
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
+    if (!local_M_data.empty())
     {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
+        addToMatrix(M, dof_table, mesh_item_id, r_c_indices, local_M_data);
     }
-    if (!_local_K_data.empty())
+    if (!local_K_data.empty())
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
+        addToMatrix(K, dof_table, mesh_item_id, r_c_indices, local_K_data);
     }
-    if (!_local_b_data.empty())
+    if (!local_b_data.empty())
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        assert(local_b_data.size() == indices.size());
+        b.add(indices, local_b_data);
     }
-    if (!_local_Jac_data.empty())
+    if (!local_Jac_data.empty())
     {
-        auto const local_Jac =
-            MathLib::toMatrix(_local_Jac_data, num_r_c, num_r_c);
-        Jac.add(r_c_indices, local_Jac);
+        addToMatrix(Jac, dof_table, mesh_item_id, r_c_indices,
+                    local_Jac_data);
     }
     else
     {
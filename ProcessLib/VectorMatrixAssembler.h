@@ -63,16 +63,47 @@ public:
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac,
         CoupledSolutionsForStaggeredScheme const* const cpl_xs);
 
+    //! Prepares the scratch data for assembly on the given number of threads.
+    //!
+    //! Afterwards assemble() and assembleWithJacobian() may be called
+    //! concurrently from different threads, cf. NumLib::ParallelExecutor, as
+    //! long as the global entries written by the concurrent calls do not
+    //! overlap.
+    void setNumberOfThreads(int const number_of_threads);
+
+    //! If enabled, assembleWithJacobian() subtracts the local
+    //! \f$ M \cdot \dot x + K \cdot x \f$ from the local \c b instead of
+    //! adding the local \c M and \c K to the global matrices.
+    //! \see NumLib::ODESystem::setLocalResidualAssembly()
+    void setLocalResidualAssembly(bool const enabled)
+    {
+        _local_residual_assembly = enabled;
+    }
+
+    bool isLocalResidualAssembly() const { return _local_residual_assembly; }
+
 private:
-    // temporary data only stored here in order to avoid frequent memory
-    // reallocations.
-    std::vector<double> _local_M_data;
-    std::vector<double> _local_K_data;
-    std::vector<double> _local_b_data;
-    std::vector<double> _local_Jac_data;
-
-    //! Used to assemble the Jacobian.
-    std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+    //! Scratch data of a single thread.
+    struct ThreadLocalData
+    {
+        // temporary data only stored here in order to avoid frequent memory
+        // reallocations.
+        std::vector<double> local_M_data;
+        std::vector<double> local_K_data;
+        std::vector<double> local_b_data;
+        std::vector<double> local_Jac_data;
+
+        //! Used to assemble the Jacobian.
+        std::unique_ptr<AbstractJacobianAssembler> jacobian_assembler;
+    };
+
+    //! Returns the scratch data of the calling thread.
+    ThreadLocalData& getThreadLocalData();
+
+    //! One entry per assembly thread.
+    std::vector<ThreadLocalData> _thread_local_data;
+
+    bool _local_residual_assembly = false;
 };
 
 }  // namespace ProcessLib
@@ -0,0 +1,104 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MaterialLib/SolidModels/MFront/MFront.h"
+#include "ParameterLib/ConstantParameter.h"
+
+namespace
+{
+constexpr int Dim = 2;
+using MFront = MaterialLib::Solids::MFront::MFront<Dim>;
+using KelvinVector = MFront::KelvinVector;
+
+//! Loads the Elasticity behaviour of the disc_with_hole benchmark.
+std::unique_ptr<MFront> createElasticity(
+    ParameterLib::Parameter<double> const& E,
+    ParameterLib::Parameter<double> const& nu)
+{
+    auto behaviour = mgis::behaviour::load(
+        BaseLib::BuildInfo::data_path +
+            "/Mechanics/Linear/MFront/disc_with_hole/libBehaviour.so",
+        "Elasticity", mgis::behaviour::Hypothesis::PLANESTRAIN);
+    return std::make_unique<MFront>(
+        std::move(behaviour),
+        std::vector<ParameterLib::Parameter<double> const*>{&E, &nu});
+}
+
+std::vector<double> toVector(KelvinVector const& v)
+{
+    return {v.data(), v.data() + v.size()};
+}
+}  // namespace
+
+// The previous state of the MGIS data holds the stresses at the beginning of
+// the time step, e.g. the initial stresses in the first time step.
+TEST(MaterialLib_MFront, IntegrateStressSeedsPreviousStress)
+{
+    ParameterLib::ConstantParameter<double> const E("E", 100e9);
+    ParameterLib::ConstantParameter<double> const nu("nu", 0.3);
+    auto const mfront = createElasticity(E, nu);
+
+    ParameterLib::SpatialPosition const x;
+    KelvinVector eps;
+    eps << 1e-3, -5e-4, 0, 2e-4;
+    KelvinVector sigma_prev;
+    sigma_prev << 1e6, 4e6, -3e6, 5e5;
+
+    auto const state = mfront->createMaterialStateVariables();
+    auto const solution = mfront->integrateStress(
+        0, x, 1, KelvinVector::Zero(), eps, sigma_prev, *state, 293.15);
+    ASSERT_TRUE(solution);
+
+    // The Kelvin vector component orders of OGS and MFront coincide in 2D.
+    auto const& data =
+        static_cast<MFront::MaterialStateVariables const&>(
+            *std::get<1>(*solution))
+            ._data;
+    EXPECT_EQ(toVector(sigma_prev), data.s0.thermodynamic_forces);
+    EXPECT_EQ(toVector(eps), data.s1.gradients);
+}
+
+TEST(MaterialLib_MFront, PushBackAndPopState)
+{
+    ParameterLib::ConstantParameter<double> const E("E", 100e9);
+    ParameterLib::ConstantParameter<double> const nu("nu", 0.3);
+    auto const mfront = createElasticity(E, nu);
+
+    ParameterLib::SpatialPosition const x;
+    auto state = mfront->createMaterialStateVariables();
+
+    KelvinVector const eps_accepted = KelvinVector::Constant(1e-3);
+    auto solution =
+        mfront->integrateStress(0, x, 1, KelvinVector::Zero(), eps_accepted,
+                                KelvinVector::Zero(), *state, 293.15);
+    ASSERT_TRUE(solution);
+    *state = *std::get<1>(*solution);
+    state->pushBackState();
+
+    auto const& data =
+        static_cast<MFront::MaterialStateVariables const&>(*state)._data;
+    EXPECT_EQ(toVector(eps_accepted), data.s0.gradients);
+
+    // A rejected time step is reverted to the accepted state.
+    solution = mfront->integrateStress(
+        1, x, 1, eps_accepted, KelvinVector::Constant(5e-3),
+        std::get<0>(*solution), *state, 293.15);
+    ASSERT_TRUE(solution);
+    *state = *std::get<1>(*solution);
+    EXPECT_EQ(toVector(KelvinVector::Constant(5e-3)), data.s1.gradients);
+    state->popState();
+
+    EXPECT_EQ(toVector(eps_accepted), data.s1.gradients);
+}
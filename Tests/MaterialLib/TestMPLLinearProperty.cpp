@@ -45,3 +45,42 @@ TEST(MaterialPropertyLib, LinearProperty)
               0.0);
 }
 
+
+TEST(MaterialPropertyLib, LinearPropertyScalarValue)
+{
+    double const y_ref = 1000.0;
+    double const m = -2e-4;
+    double const x_ref = 293.15;
+    MaterialPropertyLib::IndependentVariable const iv{
+        MaterialPropertyLib::Variable::temperature, x_ref, m};
+    MaterialPropertyLib::LinearProperty linear_property{y_ref, iv};
+
+    std::vector<MaterialPropertyLib::VariableArray> variable_arrays(5);
+    for (std::size_t i = 0; i < variable_arrays.size(); ++i)
+    {
+        variable_arrays[i][static_cast<int>(
+            MaterialPropertyLib::Variable::temperature)] = 290.0 + 5 * i;
+    }
+
+    std::vector<double> values;
+    linear_property.scalarValues(variable_arrays, values);
+    ASSERT_EQ(variable_arrays.size(), values.size());
+
+    for (std::size_t i = 0; i < variable_arrays.size(); ++i)
+    {
+        auto const& variable_array = variable_arrays[i];
+        double const expected =
+            boost::get<double>(linear_property.value(variable_array));
+        ASSERT_EQ(expected, linear_property.scalarValue(variable_array));
+        ASSERT_EQ(expected, values[i]);
+
+        for (auto const variable :
+             {MaterialPropertyLib::Variable::temperature,
+              MaterialPropertyLib::Variable::phase_pressure})
+        {
+            ASSERT_EQ(boost::get<double>(
+                          linear_property.dValue(variable_array, variable)),
+                      linear_property.dScalarValue(variable_array, variable));
+        }
+    }
+}
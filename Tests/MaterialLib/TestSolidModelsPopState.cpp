@@ -0,0 +1,186 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "MaterialLib/SolidModels/Ehlers.h"
+#include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
+#include "MaterialLib/SolidModels/Lubby2.h"
+#include "ParameterLib/ConstantParameter.h"
+
+namespace
+{
+constexpr int Dim = 3;
+using MaterialStateVariables =
+    MaterialLib::Solids::MechanicsBase<Dim>::MaterialStateVariables;
+using KelvinVector = MathLib::KelvinVector::KelvinVectorType<Dim>;
+using KelvinMatrix = MathLib::KelvinVector::KelvinMatrixType<Dim>;
+
+//! Material states of one integration point along an accepted time step, a
+//! rejected attempt of the next time step and its rollback.
+struct States
+{
+    std::unique_ptr<MaterialStateVariables> accepted;
+    std::unique_ptr<MaterialStateVariables> rejected;
+    std::unique_ptr<MaterialStateVariables> rolled_back;
+};
+
+//! Integrates an accepted time step, which is committed by pushBackState(),
+//! and a rejected attempt of the next time step, which is reverted by
+//! popState(). Then the next time step is repeated and its stress is
+//! compared to the one computed directly after the accepted step.
+//! The strains of all steps are multiplied by \c strain_scale.
+States integrateRejectedTimestep(
+    MaterialLib::Solids::MechanicsBase<Dim> const& material, double const dt,
+    double const strain_scale)
+{
+    ParameterLib::SpatialPosition const x;
+    double const T = 0;
+
+    KelvinVector const eps0 = KelvinVector::Zero();
+    KelvinVector eps1;
+    eps1 << -2, 1, 1, 0, 0, 0;
+    eps1 *= strain_scale;
+    KelvinVector eps_rejected;
+    eps_rejected << -6, 3, 3, 0, 0, 0;
+    eps_rejected *= strain_scale;
+    KelvinVector eps2;
+    eps2 << -3, 1.5, 1.5, 0, 0, 0;
+    eps2 *= strain_scale;
+
+    KelvinMatrix C;
+    States states;
+    states.rolled_back = material.createMaterialStateVariables();
+    auto& state = *states.rolled_back;
+    // The processes commit the initial state before the first time step.
+    state.pushBackState();
+
+    KelvinVector const sigma0 = KelvinVector::Zero();
+    KelvinVector sigma1;
+    EXPECT_TRUE(material.integrateStressInPlace(0, x, dt, eps0, eps1, sigma0,
+                                                state, T, sigma1, C));
+    state.pushBackState();
+    states.accepted = material.createMaterialStateVariables();
+    *states.accepted = state;
+
+    auto reference_state = material.createMaterialStateVariables();
+    *reference_state = state;
+    KelvinVector sigma2_reference;
+    EXPECT_TRUE(material.integrateStressInPlace(dt, x, dt, eps1, eps2, sigma1,
+                                                *reference_state, T,
+                                                sigma2_reference, C));
+
+    KelvinVector sigma_rejected;
+    EXPECT_TRUE(material.integrateStressInPlace(dt, x, dt, eps1, eps_rejected,
+                                                sigma1, state, T,
+                                                sigma_rejected, C));
+    states.rejected = material.createMaterialStateVariables();
+    *states.rejected = state;
+    state.popState();
+
+    auto repeated_state = material.createMaterialStateVariables();
+    *repeated_state = state;
+    KelvinVector sigma2;
+    EXPECT_TRUE(material.integrateStressInPlace(
+        dt, x, dt, eps1, eps2, sigma1, *repeated_state, T, sigma2, C));
+    EXPECT_LE((sigma2 - sigma2_reference).norm(),
+              1e-12 * sigma2_reference.norm());
+
+    return states;
+}
+}  // namespace
+
+TEST(MaterialLib_SolidModelsPopState, LinearElasticIsotropic)
+{
+    ParameterLib::ConstantParameter<double> const E("E", 1e9);
+    ParameterLib::ConstantParameter<double> const nu("nu", 0.25);
+    MaterialLib::Solids::LinearElasticIsotropic<Dim> const material{
+        MaterialLib::Solids::LinearElasticIsotropic<Dim>::MaterialProperties{
+            E, nu}};
+
+    integrateRejectedTimestep(material, 1.0, 1e-3);
+}
+
+TEST(MaterialLib_SolidModelsPopState, Lubby2)
+{
+    ParameterLib::ConstantParameter<double> const GK0("GK0", 0.8);
+    ParameterLib::ConstantParameter<double> const GM0("GM0", 0.8);
+    ParameterLib::ConstantParameter<double> const KM0("KM0", 0.8);
+    ParameterLib::ConstantParameter<double> const etaK0("etaK0", 0.5);
+    ParameterLib::ConstantParameter<double> const etaM0("etaM0", 0.5);
+    ParameterLib::ConstantParameter<double> const mK("mK", -0.2);
+    ParameterLib::ConstantParameter<double> const mvK("mvK", -0.2);
+    ParameterLib::ConstantParameter<double> const mvM("mvM", -0.3);
+    MaterialLib::Solids::Lubby2::Lubby2MaterialProperties material_properties{
+        GK0, GM0, KM0, etaK0, etaM0, mK, mvK, mvM};
+    MaterialLib::Solids::Lubby2::Lubby2<Dim> const material{
+        {20, 1e-10}, material_properties};
+
+    auto const states = integrateRejectedTimestep(material, 0.1, 1e-3);
+
+    using State =
+        MaterialLib::Solids::Lubby2::Lubby2<Dim>::MaterialStateVariables;
+    auto const& accepted = static_cast<State const&>(*states.accepted);
+    auto const& rejected = static_cast<State const&>(*states.rejected);
+    auto const& rolled_back = static_cast<State const&>(*states.rolled_back);
+
+    // The rejected step must have changed the state to make the test
+    // meaningful.
+    EXPECT_GT((rejected.eps_K_j - accepted.eps_K_j).norm(), 1e-6);
+    EXPECT_GT((rejected.eps_M_j - accepted.eps_M_j).norm(), 1e-6);
+
+    EXPECT_EQ(accepted.eps_K_t, rolled_back.eps_K_t);
+    EXPECT_EQ(accepted.eps_K_j, rolled_back.eps_K_j);
+    EXPECT_EQ(accepted.eps_M_t, rolled_back.eps_M_t);
+    EXPECT_EQ(accepted.eps_M_j, rolled_back.eps_M_j);
+}
+
+TEST(MaterialLib_SolidModelsPopState, Ehlers)
+{
+    ParameterLib::ConstantParameter<double> const G("G", 150.);
+    ParameterLib::ConstantParameter<double> const K("K", 200.);
+    ParameterLib::ConstantParameter<double> const kappa("kappa", 0.1);
+    ParameterLib::ConstantParameter<double> const beta("beta", 0.095);
+    ParameterLib::ConstantParameter<double> const gamma("gamma", 1.);
+    ParameterLib::ConstantParameter<double> const hard("hard", 0.);
+    ParameterLib::ConstantParameter<double> const alpha("alpha", 0.01);
+    ParameterLib::ConstantParameter<double> const delta("delta", 0.0078);
+    ParameterLib::ConstantParameter<double> const epsilon("epsilon", 0.1);
+    ParameterLib::ConstantParameter<double> const m("m", 0.54);
+    ParameterLib::ConstantParameter<double> const alphap("alphap", 0.01);
+    ParameterLib::ConstantParameter<double> const deltap("deltap", 0.0078);
+    ParameterLib::ConstantParameter<double> const epsilonp("epsilonp", 0.1);
+    ParameterLib::ConstantParameter<double> const mp("mp", 0.54);
+    ParameterLib::ConstantParameter<double> const betap("betap", 0.0608);
+    ParameterLib::ConstantParameter<double> const gammap("gammap", 1.);
+    MaterialLib::Solids::Ehlers::SolidEhlers<Dim> const material{
+        {100, 1e-14},
+        {G, K, alpha, beta, gamma, delta, epsilon, m, alphap, betap, gammap,
+         deltap, epsilonp, mp, kappa, hard},
+        nullptr,
+        MaterialLib::Solids::Ehlers::TangentType::Plastic};
+
+    auto const states = integrateRejectedTimestep(material, 1.0, 1e-4);
+
+    using State = MaterialLib::Solids::Ehlers::StateVariables<Dim>;
+    auto const& accepted = static_cast<State const&>(*states.accepted);
+    auto const& rejected = static_cast<State const&>(*states.rejected);
+    auto const& rolled_back = static_cast<State const&>(*states.rolled_back);
+
+    // The rejected step must have changed the state to make the test
+    // meaningful.
+    EXPECT_GT(rejected.eps_p.eff, accepted.eps_p.eff);
+
+    EXPECT_EQ(accepted.eps_p.D, rolled_back.eps_p.D);
+    EXPECT_EQ(accepted.eps_p.V, rolled_back.eps_p.V);
+    EXPECT_EQ(accepted.eps_p.eff, rolled_back.eps_p.eff);
+    EXPECT_EQ(accepted.eps_p_prev.D, rolled_back.eps_p_prev.D);
+    EXPECT_EQ(accepted.eps_p_prev.eff, rolled_back.eps_p_prev.eff);
+}
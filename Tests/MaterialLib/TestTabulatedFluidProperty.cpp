@@ -0,0 +1,185 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "BaseLib/BuildInfo.h"
+#include "MaterialLib/Fluid/Density/CreateFluidDensityModel.h"
+#include "MaterialLib/Fluid/Density/WaterDensityIAPWSIF97Region1.h"
+#include "MaterialLib/Fluid/Viscosity/CreateViscosityModel.h"
+#include "MaterialLib/Fluid/Viscosity/WaterViscosityIAPWS.h"
+#include "Tests/TestTools.h"
+
+using namespace MaterialLib::Fluid;
+using ArrayType = FluidProperty::ArrayType;
+
+namespace
+{
+std::unique_ptr<FluidProperty> createTabulatedDensity(
+    std::string const& interpolation, std::string const& file_name = "")
+{
+    std::string const xml =
+        "<density>"
+        "   <type>WaterDensityIAPWSIF97Region1</type>"
+        "   <tabulation>"
+        "       <temperature_min>280</temperature_min>"
+        "       <temperature_max>400</temperature_max>"
+        "       <number_of_temperature_points>41</number_of_temperature_points>"
+        "       <pressure_min>1e5</pressure_min>"
+        "       <pressure_max>2e7</pressure_max>"
+        "       <number_of_pressure_points>21</number_of_pressure_points>"
+        "       <interpolation>" +
+        interpolation + "</interpolation>" +
+        (file_name.empty() ? "" : "<file>" + file_name + "</file>") +
+        "   </tabulation>"
+        "</density>";
+    auto const ptree = readXml(xml.c_str());
+    BaseLib::ConfigTree conf(ptree, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    return createFluidDensityModel(conf.getConfigSubtree("density"));
+}
+
+/// Compares the tabulated and the exact property and its derivatives at
+/// points between the grid points. The error of the derivatives is measured
+/// relative to the value divided by the range of the variable.
+void checkTabulatedProperty(FluidProperty const& tabulated,
+                            FluidProperty const& exact,
+                            double const tolerance,
+                            double const derivative_tolerance)
+{
+    double const p_min = 1e5;
+    double const p_max = 2e7;
+    double const T_min = 280;
+    double const T_max = 400;
+    ArrayType vars = {};
+    for (double T = T_min + 1.3; T < T_max; T += 7.1)
+    {
+        for (double p = p_min + 0.037 * (p_max - p_min); p < p_max;
+             p += 0.061 * (p_max - p_min))
+        {
+            vars[static_cast<int>(PropertyVariableType::T)] = T;
+            vars[static_cast<int>(PropertyVariableType::p)] = p;
+            double const value = exact.getValue(vars);
+            ASSERT_NEAR(value, tabulated.getValue(vars),
+                        tolerance * std::abs(value));
+            ASSERT_NEAR(
+                exact.getdValue(vars, PropertyVariableType::T),
+                tabulated.getdValue(vars, PropertyVariableType::T),
+                derivative_tolerance * std::abs(value) / (T_max - T_min));
+            ASSERT_NEAR(
+                exact.getdValue(vars, PropertyVariableType::p),
+                tabulated.getdValue(vars, PropertyVariableType::p),
+                derivative_tolerance * std::abs(value) / (p_max - p_min));
+        }
+    }
+}
+}  // namespace
+
+TEST(MaterialFluidTabulatedProperty, BicubicWaterDensity)
+{
+    auto const rho = createTabulatedDensity("Bicubic");
+    WaterDensityIAPWSIF97Region1 const rho_exact;
+    checkTabulatedProperty(*rho, rho_exact, 1e-7, 1e-5);
+}
+
+TEST(MaterialFluidTabulatedProperty, BilinearWaterDensity)
+{
+    auto const rho = createTabulatedDensity("Bilinear");
+    WaterDensityIAPWSIF97Region1 const rho_exact;
+    checkTabulatedProperty(*rho, rho_exact, 1e-4, 1e-3);
+}
+
+// The IAPWS viscosity depends on temperature and density. It is tabulated on a
+// temperature-density grid and compared to the direct evaluation at the
+// densities of liquid water at the given temperatures and pressures.
+TEST(MaterialFluidTabulatedProperty, BicubicWaterViscosity)
+{
+    const char xml[] =
+        "<viscosity>"
+        "   <type>WaterViscosityIAPWS</type>"
+        "   <tabulation>"
+        "       <temperature_min>280</temperature_min>"
+        "       <temperature_max>400</temperature_max>"
+        "       <number_of_temperature_points>41</number_of_temperature_points>"
+        "       <density_min>930</density_min>"
+        "       <density_max>1010</density_max>"
+        "       <number_of_density_points>21</number_of_density_points>"
+        "       <max_relative_error>1e-5</max_relative_error>"
+        "   </tabulation>"
+        "</viscosity>";
+    auto const ptree = readXml(xml);
+    BaseLib::ConfigTree conf(ptree, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    auto const mu = createViscosityModel(conf.getConfigSubtree("viscosity"));
+    WaterViscosityIAPWS const mu_exact;
+    WaterDensityIAPWSIF97Region1 const rho_exact;
+
+    double const T_range = 400 - 280;
+    double const rho_range = 1010 - 930;
+    ArrayType vars = {};
+    for (double T = 281.3; T < 400; T += 7.1)
+    {
+        for (double p = 1e5; p <= 2e7; p += 1.3e6)
+        {
+            vars[static_cast<int>(PropertyVariableType::T)] = T;
+            vars[static_cast<int>(PropertyVariableType::p)] = p;
+            double const rho = rho_exact.getValue(vars);
+            ASSERT_LT(930, rho);
+            ASSERT_GT(1010, rho);
+            vars[static_cast<int>(PropertyVariableType::rho)] = rho;
+
+            double const value = mu_exact.getValue(vars);
+            ASSERT_NEAR(value, mu->getValue(vars), 1e-5 * value);
+            ASSERT_NEAR(mu_exact.getdValue(vars, PropertyVariableType::T),
+                        mu->getdValue(vars, PropertyVariableType::T),
+                        1e-3 * value / T_range);
+            ASSERT_NEAR(mu_exact.getdValue(vars, PropertyVariableType::rho),
+                        mu->getdValue(vars, PropertyVariableType::rho),
+                        1e-3 * value / rho_range);
+        }
+    }
+}
+
+TEST(MaterialFluidTabulatedProperty, OutsideOfTable)
+{
+    auto const rho = createTabulatedDensity("Bicubic");
+    WaterDensityIAPWSIF97Region1 const rho_exact;
+
+    ArrayType vars = {{473.15, 4.e+7}};
+    ASSERT_EQ(rho_exact.getValue(vars), rho->getValue(vars));
+    ASSERT_EQ(rho_exact.getdValue(vars, PropertyVariableType::T),
+              rho->getdValue(vars, PropertyVariableType::T));
+}
+
+TEST(MaterialFluidTabulatedProperty, ReadTableFromFile)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "TabulatedWaterDensity.bin";
+    std::remove(file_name.c_str());
+
+    // The first one writes the table, the second one reads it.
+    auto const rho_written = createTabulatedDensity("Bicubic", file_name);
+    auto const rho_read = createTabulatedDensity("Bicubic", file_name);
+    std::remove(file_name.c_str());
+
+    ArrayType vars = {};
+    for (double T = 285.; T < 400; T += 10.)
+    {
+        vars[static_cast<int>(PropertyVariableType::T)] = T;
+        vars[static_cast<int>(PropertyVariableType::p)] = 1.23e6;
+        ASSERT_EQ(rho_written->getValue(vars), rho_read->getValue(vars));
+        ASSERT_EQ(rho_written->getdValue(vars, PropertyVariableType::p),
+                  rho_read->getdValue(vars, PropertyVariableType::p));
+    }
+}
@@ -232,4 +232,63 @@ TEST(Math, CheckInterface_EigenMatrix)
     MathLib::EigenMatrix m(10);
     checkGlobalMatrixInterface(m);
 }
+
+TEST(Math, EigenMatrixAddAtCachedOffsets)
+{
+    // Three overlapping "elements" in a chain of six unknowns.
+    std::vector<std::vector<GlobalIndexType>> const element_indices{
+        {0, 1, 2}, {2, 3}, {5, 3, 4}};
+    auto const get_indices = [&](std::size_t const i) {
+        return element_indices[i];
+    };
+
+    MathLib::EigenMatrix expected(6);
+    MathLib::EigenMatrix m(6);
+
+    // Nothing is cached for an empty matrix.
+    m.cacheLocalMatrixOffsets(&element_indices, element_indices.size(),
+                              get_indices);
+    ASSERT_EQ(nullptr, m.findLocalMatrixOffsets(&element_indices));
+
+    m.add(0, 0, 1.0);
+    m.cacheLocalMatrixOffsets(&element_indices, element_indices.size(),
+                              get_indices);
+    auto const* const offsets = m.findLocalMatrixOffsets(&element_indices);
+    ASSERT_NE(nullptr, offsets);
+    m.setZero();
+
+    for (std::size_t e = 0; e < element_indices.size(); e++)
+    {
+        auto const n = element_indices[e].size();
+        Eigen::MatrixXd local_m(n, n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            for (std::size_t j = 0; j < n; j++)
+            {
+                local_m(i, j) = 10.0 * e + 3.0 * i + j;
+            }
+        }
+        expected.add(element_indices[e], local_m);
+        m.add(*offsets, e, local_m);
+    }
+
+    ASSERT_TRUE(m.getRawMatrix().isCompressed());
+    for (GlobalIndexType i = 0; i < 6; i++)
+    {
+        for (GlobalIndexType j = 0; j < 6; j++)
+        {
+            EXPECT_EQ(expected.get(i, j), m.get(i, j));
+        }
+    }
+
+    // The table is kept while the sparsity pattern is unchanged and dropped
+    // once the matrix is empty.
+    m.cacheLocalMatrixOffsets(&element_indices, element_indices.size(),
+                              get_indices);
+    EXPECT_EQ(offsets, m.findLocalMatrixOffsets(&element_indices));
+    m.getRawMatrix().resize(6, 6);
+    m.cacheLocalMatrixOffsets(&element_indices, element_indices.size(),
+                              get_indices);
+    EXPECT_EQ(nullptr, m.findLocalMatrixOffsets(&element_indices));
+}
 #endif
@@ -241,6 +241,121 @@ TEST(Math, CheckInterface_Eigen)
 }
 #endif
 
+#ifdef OGS_USE_EIGEN
+namespace
+{
+// Solves a sequence of five 1D Laplace systems with increasing diagonal shifts
+// with the same solver object. The sparsity pattern is extended by a coupling
+// of the first and the last unknown from the system with index
+// changed_pattern_index on.
+MathLib::EigenLinearSolverStatistics checkEigenSolverSequence(
+    boost::property_tree::ptree const& t_solver,
+    int const changed_pattern_index = 5)
+{
+    boost::property_tree::ptree t_root;
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    int const n = 20;
+    for (int k = 0; k < 5; k++)
+    {
+        MathLib::EigenMatrix A(n);
+        for (int i = 0; i < n; i++)
+        {
+            A.add(i, i, 2.0 + 0.1 * k);
+            if (i > 0)
+            {
+                A.add(i, i - 1, -1.0);
+            }
+            if (i < n - 1)
+            {
+                A.add(i, i + 1, -1.0);
+            }
+        }
+        if (k >= changed_pattern_index)
+        {
+            A.add(0, n - 1, -0.5);
+            A.add(n - 1, 0, -0.5);
+        }
+        MathLib::finalizeMatrixAssembly(A);
+
+        MathLib::EigenVector b(n);
+        b.getRawVector().setOnes();
+        MathLib::EigenVector x(n);
+        x.setZero();
+
+        Eigen::SparseLU<MathLib::EigenMatrix::RawMatrixType> lu(
+            A.getRawMatrix());
+        Eigen::VectorXd const x_expected = lu.solve(b.getRawVector());
+
+        EXPECT_TRUE(ls.solve(A, b, x));
+        EXPECT_NEAR(0., (x_expected - x.getRawVector()).cwiseAbs().maxCoeff(),
+                    1e-8);
+    }
+
+    return ls.getStatistics();
+}
+}  // namespace
+
+TEST(Math, EigenLinearSolverReuse)
+{
+    {
+        // The pattern is analyzed once, the matrix factorized per solve.
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "SparseLU");
+        auto const statistics = checkEigenSolverSequence(t_solver);
+        EXPECT_EQ(5, statistics.number_of_solves);
+        EXPECT_EQ(1, statistics.number_of_pattern_analyses);
+        EXPECT_EQ(5, statistics.number_of_factorizations);
+    }
+    {
+        // A changed pattern is analyzed again.
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "SparseLU");
+        auto const statistics = checkEigenSolverSequence(t_solver, 3);
+        EXPECT_EQ(2, statistics.number_of_pattern_analyses);
+        EXPECT_EQ(5, statistics.number_of_factorizations);
+    }
+    {
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "SparseLU");
+        t_solver.put("reuse_pattern_analysis", false);
+        auto const statistics = checkEigenSolverSequence(t_solver);
+        EXPECT_EQ(5, statistics.number_of_pattern_analyses);
+        EXPECT_EQ(5, statistics.number_of_factorizations);
+    }
+    {
+        // The preconditioner of the first solve is reused for three solves.
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "BiCGSTAB");
+        t_solver.put("precon_type", "ILUT");
+        t_solver.put("error_tolerance", 1e-14);
+        t_solver.put("max_iteration_step", 1000);
+        t_solver.put("precon_reuse_count", 3);
+        t_solver.put("precon_reuse_iteration_factor", 100.);
+        auto const statistics = checkEigenSolverSequence(t_solver);
+        EXPECT_EQ(5, statistics.number_of_solves);
+        EXPECT_EQ(1, statistics.number_of_pattern_analyses);
+        EXPECT_EQ(2, statistics.number_of_factorizations);
+    }
+    {
+        // A changed pattern forces a new preconditioner.
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "BiCGSTAB");
+        t_solver.put("precon_type", "ILUT");
+        t_solver.put("error_tolerance", 1e-14);
+        t_solver.put("max_iteration_step", 1000);
+        t_solver.put("precon_reuse_count", 3);
+        t_solver.put("precon_reuse_iteration_factor", 100.);
+        auto const statistics = checkEigenSolverSequence(t_solver, 2);
+        EXPECT_EQ(2, statistics.number_of_pattern_analyses);
+        EXPECT_EQ(2, statistics.number_of_factorizations);
+    }
+}
+#endif
+
 #if defined(OGS_USE_EIGEN) && defined(USE_LIS)
 TEST(Math, CheckInterface_EigenLis)
 {
@@ -447,6 +447,38 @@ TEST_F(MeshLibProperties, CopyConstructor)
     }
 }
 
+TEST_F(MeshLibProperties, CopyAssignment)
+{
+    ASSERT_TRUE(mesh != nullptr);
+    const std::size_t n_items(mesh_size*mesh_size*mesh_size);
+    auto* const p = mesh->getProperties().createNewPropertyVector<double>(
+        "p", MeshLib::MeshItemType::Cell);
+    p->resize(n_items, 1.0);
+
+    // The assigned to object holds vectors already, which are replaced.
+    MeshLib::Properties properties;
+    auto* const q = properties.createNewPropertyVector<double>(
+        "q", MeshLib::MeshItemType::Cell);
+    q->resize(n_items, 2.0);
+    properties.createNewPropertyVector<double>("p",
+                                               MeshLib::MeshItemType::Cell);
+
+    properties = mesh->getProperties();
+    ASSERT_TRUE(properties.hasPropertyVector("p"));
+    EXPECT_FALSE(properties.hasPropertyVector("q"));
+    auto const* const p_copy = properties.getPropertyVector<double>("p");
+    ASSERT_NE(p, p_copy);
+    ASSERT_EQ(n_items, p_copy->size());
+    EXPECT_EQ(1.0, (*p_copy)[0]);
+
+    // Move assignment.
+    MeshLib::Properties other;
+    other.createNewPropertyVector<double>("q", MeshLib::MeshItemType::Cell);
+    other = std::move(properties);
+    EXPECT_TRUE(other.hasPropertyVector("p"));
+    EXPECT_FALSE(other.hasPropertyVector("q"));
+}
+
 TEST_F(MeshLibProperties, AddDoublePropertiesTupleSize2)
 {
     ASSERT_TRUE(mesh != nullptr);
@@ -0,0 +1,150 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include <gtest/gtest.h>
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/NodeWiseMeshPartitioner.h"
+#include "BaseLib/BuildInfo.h"
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/MPI_IO/NodePartitionedMeshReader.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/NodePartitionedMesh.h"
+
+namespace
+{
+//! Partitions a quad mesh with a node and a cell property into stripes along
+//! the x axis and writes the partitions in the multi file binary format and
+//! in the single file binary format.
+void writePartitionedMesh(std::string const& file_name_base,
+                          int const number_of_partitions)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1., 6u));
+
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    for (auto const* element : mesh->getElements())
+    {
+        material_ids->push_back(element->getID() % 2);
+    }
+    auto* const coordinates =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "coordinates", MeshLib::MeshItemType::Node, 2);
+    for (auto const* node : mesh->getNodes())
+    {
+        coordinates->push_back((*node)[0]);
+        coordinates->push_back((*node)[1]);
+    }
+
+    std::vector<std::size_t> node_partition_ids;
+    node_partition_ids.reserve(mesh->getNumberOfNodes());
+    for (auto const* node : mesh->getNodes())
+    {
+        node_partition_ids.push_back(
+            std::min(number_of_partitions - 1,
+                     static_cast<int>((*node)[0] * number_of_partitions)));
+    }
+
+    ApplicationUtils::NodeWiseMeshPartitioner partitioner(number_of_partitions,
+                                                          std::move(mesh));
+    partitioner.resetPartitionIdsForNodes(std::move(node_partition_ids));
+    partitioner.partitionByMETIS(false);
+    partitioner.writeBinary(file_name_base + "_binary");
+    partitioner.writeSingleFileBinary(file_name_base + "_single_file");
+}
+
+std::unique_ptr<MeshLib::NodePartitionedMesh> readPartitionedMesh(
+    std::string const& file_name_base)
+{
+    MeshLib::IO::NodePartitionedMeshReader reader(MPI_COMM_WORLD);
+    return std::unique_ptr<MeshLib::NodePartitionedMesh>(
+        reader.read(file_name_base));
+}
+
+template <typename T>
+std::vector<T> propertyValues(MeshLib::Mesh const& mesh,
+                              std::string const& name)
+{
+    auto const* const pv = mesh.getProperties().getPropertyVector<T>(name);
+    return {pv->begin(), pv->end()};
+}
+}  // namespace
+
+// Every process reads its partition from the single file written by
+// partmesh --single-file and gets the same mesh as from the multi file binary
+// output of the same partitioning.
+TEST(MPITest_MeshLib, NodePartitionedMeshReaderSingleFileBinary)
+{
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    std::string const file_name_base = BaseLib::joinPaths(
+        BaseLib::BuildInfo::tests_tmp_path, "NodePartitionedMeshReader");
+    if (rank == 0)
+    {
+        writePartitionedMesh(file_name_base, size);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    auto const binary = readPartitionedMesh(file_name_base + "_binary");
+    auto const single_file =
+        readPartitionedMesh(file_name_base + "_single_file");
+    ASSERT_TRUE(binary);
+    ASSERT_TRUE(single_file);
+
+    ASSERT_EQ(binary->getNumberOfNodes(), single_file->getNumberOfNodes());
+    EXPECT_EQ(binary->getNumberOfBaseNodes(),
+              single_file->getNumberOfBaseNodes());
+    EXPECT_EQ(binary->getNumberOfActiveBaseNodes(),
+              single_file->getNumberOfActiveBaseNodes());
+    EXPECT_EQ(binary->getNumberOfActiveNodes(),
+              single_file->getNumberOfActiveNodes());
+    EXPECT_EQ(binary->getNumberOfGlobalBaseNodes(),
+              single_file->getNumberOfGlobalBaseNodes());
+    EXPECT_EQ(binary->getNumberOfGlobalNodes(),
+              single_file->getNumberOfGlobalNodes());
+    for (std::size_t i = 0; i < binary->getNumberOfNodes(); ++i)
+    {
+        EXPECT_EQ(binary->getGlobalNodeID(i), single_file->getGlobalNodeID(i));
+        for (int c = 0; c < 3; ++c)
+        {
+            EXPECT_EQ((*binary->getNode(i))[c], (*single_file->getNode(i))[c]);
+        }
+    }
+
+    ASSERT_EQ(binary->getNumberOfElements(),
+              single_file->getNumberOfElements());
+    for (std::size_t i = 0; i < binary->getNumberOfElements(); ++i)
+    {
+        auto const& e_binary = *binary->getElement(i);
+        auto const& e_single_file = *single_file->getElement(i);
+        ASSERT_EQ(e_binary.getCellType(), e_single_file.getCellType());
+        for (unsigned n = 0; n < e_binary.getNumberOfNodes(); ++n)
+        {
+            EXPECT_EQ(e_binary.getNodeIndex(n), e_single_file.getNodeIndex(n));
+        }
+    }
+
+    EXPECT_EQ(propertyValues<int>(*binary, "MaterialIDs"),
+              propertyValues<int>(*single_file, "MaterialIDs"));
+    EXPECT_EQ(propertyValues<double>(*binary, "coordinates"),
+              propertyValues<double>(*single_file, "coordinates"));
+}
@@ -0,0 +1,213 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex20.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeLine2.h"
+#include "NumLib/Fem/ShapeFunction/ShapePrism6.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet10.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTri3.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTri6.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+#include "ProcessLib/Utils/InitShapeMatrices.h"
+
+#include "MicroBenchmark.h"
+
+namespace
+{
+using MeshFactory = std::unique_ptr<MeshLib::Mesh> (*)();
+
+// The mesh sizes are chosen such that one repetition of the local assembly
+// takes some milliseconds.
+std::unique_ptr<MeshLib::Mesh> createLineMesh()
+{
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateLineMesh(100000u, 1e-3));
+}
+
+std::unique_ptr<MeshLib::Mesh> createTriMesh()
+{
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularTriMesh(200u, 200u, 1e-2));
+}
+
+std::unique_ptr<MeshLib::Mesh> createQuadMesh()
+{
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(200u, 200u, 1e-2));
+}
+
+std::unique_ptr<MeshLib::Mesh> createTetMesh()
+{
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularTetMesh(20u, 20u, 20u, 5e-2,
+                                                       5e-2, 5e-2));
+}
+
+std::unique_ptr<MeshLib::Mesh> createPrismMesh()
+{
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularPrismMesh(25u, 25u, 25u,
+                                                         4e-2));
+}
+
+std::unique_ptr<MeshLib::Mesh> createHexMesh()
+{
+    return std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularHexMesh(30u, 30u, 30u, 1. / 30));
+}
+
+std::unique_ptr<MeshLib::Mesh> createTri6Mesh()
+{
+    return MeshLib::createQuadraticOrderMesh(*createTriMesh());
+}
+
+std::unique_ptr<MeshLib::Mesh> createQuad8Mesh()
+{
+    return MeshLib::createQuadraticOrderMesh(*createQuadMesh());
+}
+
+std::unique_ptr<MeshLib::Mesh> createTet10Mesh()
+{
+    return MeshLib::createQuadraticOrderMesh(*createTetMesh());
+}
+
+std::unique_ptr<MeshLib::Mesh> createHex20Mesh()
+{
+    return MeshLib::createQuadraticOrderMesh(*createHexMesh());
+}
+
+template <typename ShapeFunction, unsigned GlobalDim>
+struct ShapeFunctionTraits
+{
+    using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+    using ShapeMatrices = typename ShapeMatricesType::ShapeMatrices;
+    using ShapeMatricesVector =
+        std::vector<ShapeMatrices, Eigen::aligned_allocator<ShapeMatrices>>;
+    using IntegrationMethod =
+        typename NumLib::GaussLegendreIntegrationPolicy<
+            typename ShapeFunction::MeshElement>::IntegrationMethod;
+
+    static ShapeMatricesVector initShapeMatrices(
+        MeshLib::Element const& element,
+        IntegrationMethod const& integration_method)
+    {
+        return ProcessLib::initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                                             IntegrationMethod, GlobalDim>(
+            element, false, integration_method);
+    }
+};
+
+unsigned const integration_order = 2;
+
+/// Computes the shape matrices at all integration points of all elements as
+/// done in the constructors of the local assemblers.
+template <typename ShapeFunction, unsigned GlobalDim, MeshFactory createMesh>
+void shapeMatrices(MicroBenchmarks::State& state)
+{
+    using Traits = ShapeFunctionTraits<ShapeFunction, GlobalDim>;
+
+    auto const mesh = createMesh();
+    typename Traits::IntegrationMethod const integration_method{
+        integration_order};
+
+    while (state.keepRunning())
+    {
+        double sum = 0;
+        for (auto const* element : mesh->getElements())
+        {
+            auto const shape_matrices =
+                Traits::initShapeMatrices(*element, integration_method);
+            sum += shape_matrices[0].detJ;
+        }
+        MicroBenchmarks::doNotOptimize(sum);
+    }
+    state.setItemsPerRepetition(mesh->getNumberOfElements());
+}
+
+/// Assembles the local mass and Laplace matrices of all elements using
+/// precomputed shape matrices, which resembles the local assembly of, e.g.,
+/// the groundwater flow process.
+template <typename ShapeFunction, unsigned GlobalDim, MeshFactory createMesh>
+void localAssembly(MicroBenchmarks::State& state)
+{
+    using Traits = ShapeFunctionTraits<ShapeFunction, GlobalDim>;
+    using NodalMatrixType =
+        typename Traits::ShapeMatricesType::NodalMatrixType;
+
+    auto const mesh = createMesh();
+    typename Traits::IntegrationMethod const integration_method{
+        integration_order};
+
+    std::vector<typename Traits::ShapeMatricesVector> shape_matrices;
+    shape_matrices.reserve(mesh->getNumberOfElements());
+    for (auto const* element : mesh->getElements())
+    {
+        shape_matrices.push_back(
+            Traits::initShapeMatrices(*element, integration_method));
+    }
+
+    NodalMatrixType M(ShapeFunction::NPOINTS, ShapeFunction::NPOINTS);
+    NodalMatrixType K(ShapeFunction::NPOINTS, ShapeFunction::NPOINTS);
+    unsigned const n_integration_points =
+        integration_method.getNumberOfPoints();
+
+    while (state.keepRunning())
+    {
+        double sum = 0;
+        for (auto const& element_shape_matrices : shape_matrices)
+        {
+            M.setZero();
+            K.setZero();
+            for (unsigned ip = 0; ip < n_integration_points; ++ip)
+            {
+                auto const& sm = element_shape_matrices[ip];
+                double const w =
+                    sm.detJ * sm.integralMeasure *
+                    integration_method.getWeightedPoint(ip).getWeight();
+                M.noalias() += sm.N.transpose() * sm.N * w;
+                K.noalias() += sm.dNdx.transpose() * sm.dNdx * w;
+            }
+            sum += M(0, 0) + K(0, 0);
+        }
+        MicroBenchmarks::doNotOptimize(sum);
+    }
+    state.setItemsPerRepetition(mesh->getNumberOfElements());
+}
+}  // namespace
+
+#define OGS_ASSEMBLY_BENCHMARKS(SHAPE, DIM, CREATE_MESH)                       \
+    OGS_MICRO_BENCHMARK("ShapeMatrices/" #SHAPE,                               \
+                        (&shapeMatrices<NumLib::Shape##SHAPE, DIM,             \
+                                        CREATE_MESH>));                        \
+    OGS_MICRO_BENCHMARK(                                                       \
+        "LocalAssembly/" #SHAPE,                                               \
+        (&localAssembly<NumLib::Shape##SHAPE, DIM, CREATE_MESH>))
+
+OGS_ASSEMBLY_BENCHMARKS(Line2, 1, &createLineMesh);
+OGS_ASSEMBLY_BENCHMARKS(Tri3, 2, &createTriMesh);
+OGS_ASSEMBLY_BENCHMARKS(Quad4, 2, &createQuadMesh);
+OGS_ASSEMBLY_BENCHMARKS(Tet4, 3, &createTetMesh);
+OGS_ASSEMBLY_BENCHMARKS(Prism6, 3, &createPrismMesh);
+OGS_ASSEMBLY_BENCHMARKS(Hex8, 3, &createHexMesh);
+OGS_ASSEMBLY_BENCHMARKS(Tri6, 2, &createTri6Mesh);
+OGS_ASSEMBLY_BENCHMARKS(Quad8, 2, &createQuad8Mesh);
+OGS_ASSEMBLY_BENCHMARKS(Tet10, 3, &createTet10Mesh);
+OGS_ASSEMBLY_BENCHMARKS(Hex20, 3, &createHex20Mesh);
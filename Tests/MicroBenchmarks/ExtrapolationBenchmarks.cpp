@@ -0,0 +1,128 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/Extrapolation/ExtrapolatableElementCollection.h"
+#include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/Utils/InitShapeMatrices.h"
+
+#include "MicroBenchmark.h"
+
+namespace
+{
+/// Provides the values of a linear field at the integration points of a Hex8
+/// element.
+class IntegrationPointValues final : public NumLib::ExtrapolatableElement
+{
+    using ShapeMatricesType = ShapeMatrixPolicyType<NumLib::ShapeHex8, 3>;
+    using ShapeMatrices = ShapeMatricesType::ShapeMatrices;
+    using IntegrationMethod = NumLib::GaussLegendreIntegrationPolicy<
+        NumLib::ShapeHex8::MeshElement>::IntegrationMethod;
+
+public:
+    explicit IntegrationPointValues(MeshLib::Element const& element)
+        : _shape_matrices(
+              ProcessLib::initShapeMatrices<NumLib::ShapeHex8,
+                                            ShapeMatricesType,
+                                            IntegrationMethod, 3>(
+                  element, false, IntegrationMethod{2}))
+    {
+        for (auto const& sm : _shape_matrices)
+        {
+            double x = 0;
+            for (unsigned n = 0; n < element.getNumberOfNodes(); ++n)
+            {
+                x += sm.N[n] * (*element.getNode(n))[0];
+            }
+            _values.push_back(x);
+        }
+    }
+
+    Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
+        const unsigned integration_point) const override
+    {
+        auto const& N = _shape_matrices[integration_point].N;
+        return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
+    }
+
+    std::vector<double> const& getValues(
+        const double /*t*/, GlobalVector const& /*current_solution*/,
+        NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
+        std::vector<double>& /*cache*/) const
+    {
+        return _values;
+    }
+
+private:
+    std::vector<ShapeMatrices, Eigen::aligned_allocator<ShapeMatrices>>
+        _shape_matrices;
+    std::vector<double> _values;
+};
+
+template <int NumberOfThreads>
+void extrapolation(MicroBenchmarks::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(30u, 30u, 30u,
+                                                       1. / 30));
+    MeshLib::MeshSubset const mesh_subset_all_nodes(*mesh, mesh->getNodes());
+    NumLib::LocalToGlobalIndexMap const dof_table(
+        {mesh_subset_all_nodes}, NumLib::ComponentOrder::BY_COMPONENT);
+
+    std::vector<std::unique_ptr<IntegrationPointValues>> local_assemblers;
+    local_assemblers.reserve(mesh->getNumberOfElements());
+    for (auto const* element : mesh->getElements())
+    {
+        local_assemblers.push_back(
+            std::make_unique<IntegrationPointValues>(*element));
+    }
+    auto const extrapolatables = NumLib::makeExtrapolatable(
+        local_assemblers, &IntegrationPointValues::getValues);
+
+    MathLib::MatrixSpecifications const spec{
+        dof_table.dofSizeWithoutGhosts(), dof_table.dofSizeWithoutGhosts(),
+        &dof_table.getGhostIndices(), nullptr};
+    auto const x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+
+    int const number_of_threads =
+        NumberOfThreads > 0 ? NumberOfThreads
+                            : static_cast<int>(std::max(
+                                  1u, std::thread::hardware_concurrency()));
+    NumLib::LocalLinearLeastSquaresExtrapolator extrapolator(dof_table,
+                                                             number_of_threads);
+
+    while (state.keepRunning())
+    {
+        extrapolator.extrapolate(1, extrapolatables, 0.0, *x, dof_table);
+    }
+    state.setItemsPerRepetition(mesh->getNumberOfElements());
+}
+}  // namespace
+
+OGS_MICRO_BENCHMARK("Extrapolation/LocalLinearLeastSquares/Hex8",
+                    &extrapolation<1>);
+// Uses as many threads as the hardware supports.
+OGS_MICRO_BENCHMARK("Extrapolation/LocalLinearLeastSquares/Hex8/Parallel",
+                    &extrapolation<0>);
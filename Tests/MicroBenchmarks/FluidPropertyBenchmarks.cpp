@@ -0,0 +1,73 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+
+#include "MaterialLib/Fluid/Density/WaterDensityIAPWSIF97Region1.h"
+#include "MaterialLib/Fluid/TabulatedFluidProperty.h"
+
+#include "MicroBenchmark.h"
+
+namespace
+{
+using namespace MaterialLib::Fluid;
+
+std::size_t const number_of_evaluations = 100000;
+
+std::unique_ptr<FluidProperty> createDensity(
+    bool const tabulated, TabulationInterpolation const interpolation)
+{
+    auto density = std::make_unique<WaterDensityIAPWSIF97Region1>();
+    if (!tabulated)
+    {
+        return density;
+    }
+    return std::make_unique<TabulatedFluidProperty>(
+        std::move(density),
+        TabulationGrid{280, 400, 121, TabulationVariable::Pressure, 1e5, 2e7,
+                       101},
+        interpolation, "");
+}
+
+/// Evaluates the water density and its pressure derivative at varying
+/// temperatures and pressures as done at the integration points of a
+/// thermo-hydraulic process.
+template <bool Tabulated, TabulationInterpolation Interpolation>
+void waterDensity(MicroBenchmarks::State& state)
+{
+    auto const density = createDensity(Tabulated, Interpolation);
+
+    FluidProperty::ArrayType vars = {};
+    while (state.keepRunning())
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < number_of_evaluations; ++i)
+        {
+            vars[static_cast<int>(PropertyVariableType::T)] =
+                290 + 1e-3 * (i % 100000);
+            vars[static_cast<int>(PropertyVariableType::p)] =
+                1e6 + 1e2 * (i % 10000);
+            sum += density->getValue(vars) +
+                   density->getdValue(vars, PropertyVariableType::p);
+        }
+        MicroBenchmarks::doNotOptimize(sum);
+    }
+    state.setItemsPerRepetition(number_of_evaluations);
+}
+}  // namespace
+
+OGS_MICRO_BENCHMARK(
+    "FluidProperty/WaterDensityIAPWSIF97Region1",
+    (&waterDensity<false, TabulationInterpolation::Bicubic>));
+OGS_MICRO_BENCHMARK(
+    "FluidProperty/WaterDensityIAPWSIF97Region1/TabulatedBicubic",
+    (&waterDensity<true, TabulationInterpolation::Bicubic>));
+OGS_MICRO_BENCHMARK(
+    "FluidProperty/WaterDensityIAPWSIF97Region1/TabulatedBilinear",
+    (&waterDensity<true, TabulationInterpolation::Bilinear>));
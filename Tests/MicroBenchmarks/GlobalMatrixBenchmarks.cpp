@@ -0,0 +1,237 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "MathLib/LinAlg/ApplyKnownSolution.h"
+#include "MathLib/LinAlg/FinalizeMatrixAssembly.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/Utils/InitShapeMatrices.h"
+
+#include "MicroBenchmark.h"
+
+namespace
+{
+using ShapeMatricesType = ShapeMatrixPolicyType<NumLib::ShapeHex8, 3>;
+using NodalMatrixType = ShapeMatricesType::NodalMatrixType;
+
+/// A steady-state diffusion problem on a regular hex mesh of the unit cube
+/// with Dirichlet boundary conditions on the bottom and top faces.
+struct LaplaceProblem
+{
+    explicit LaplaceProblem(unsigned const n_cells)
+        : mesh(MeshLib::MeshGenerator::generateRegularHexMesh(
+              n_cells, n_cells, n_cells, 1.0 / n_cells)),
+          mesh_subset_all_nodes(*mesh, mesh->getNodes()),
+          dof_table({mesh_subset_all_nodes},
+                    NumLib::ComponentOrder::BY_COMPONENT)
+    {
+        // All elements of the regular mesh have the same local matrix.
+        using IntegrationMethod = NumLib::GaussLegendreIntegrationPolicy<
+            NumLib::ShapeHex8::MeshElement>::IntegrationMethod;
+        IntegrationMethod const integration_method{2};
+        auto const shape_matrices =
+            ProcessLib::initShapeMatrices<NumLib::ShapeHex8, ShapeMatricesType,
+                                          IntegrationMethod, 3>(
+                *mesh->getElement(0), false, integration_method);
+        local_K.setZero();
+        for (unsigned ip = 0; ip < shape_matrices.size(); ++ip)
+        {
+            auto const& sm = shape_matrices[ip];
+            local_K.noalias() +=
+                sm.dNdx.transpose() * sm.dNdx * sm.detJ * sm.integralMeasure *
+                integration_method.getWeightedPoint(ip).getWeight();
+        }
+
+        for (auto const* node : mesh->getNodes())
+        {
+            double const z = (*node)[2];
+            if (z == 0.0 || z == 1.0)
+            {
+                MeshLib::Location const l(mesh->getID(),
+                                          MeshLib::MeshItemType::Node,
+                                          node->getID());
+                dirichlet_ids.push_back(dof_table.getGlobalIndex(l, 0));
+                dirichlet_values.push_back(z);
+            }
+        }
+    }
+
+    MathLib::MatrixSpecifications matrixSpecifications(
+        GlobalSparsityPattern const* const sparsity_pattern) const
+    {
+        return {dof_table.dofSizeWithoutGhosts(),
+                dof_table.dofSizeWithoutGhosts(), &dof_table.getGhostIndices(),
+                sparsity_pattern};
+    }
+
+    void scatter(GlobalMatrix& K) const
+    {
+        for (std::size_t id = 0; id < mesh->getNumberOfElements(); ++id)
+        {
+            auto const indices = NumLib::getIndices(id, dof_table);
+            K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices,
+                                                                  indices),
+                  local_K);
+        }
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    MeshLib::MeshSubset mesh_subset_all_nodes;
+    NumLib::LocalToGlobalIndexMap dof_table;
+    NodalMatrixType local_K;
+    std::vector<GlobalIndexType> dirichlet_ids;
+    std::vector<double> dirichlet_values;
+};
+
+void constructDofTable(MicroBenchmarks::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(40u, 40u, 40u,
+                                                       1. / 40));
+    MeshLib::MeshSubset const mesh_subset_all_nodes(*mesh, mesh->getNodes());
+
+    while (state.keepRunning())
+    {
+        // Three components as for a displacement in 3D.
+        std::vector<MeshLib::MeshSubset> mesh_subsets(3,
+                                                      mesh_subset_all_nodes);
+        NumLib::LocalToGlobalIndexMap const dof_table(
+            std::move(mesh_subsets), NumLib::ComponentOrder::BY_LOCATION);
+        MicroBenchmarks::doNotOptimize(dof_table.size());
+    }
+    state.setItemsPerRepetition(mesh->getNumberOfNodes());
+}
+
+void computeSparsityPattern(MicroBenchmarks::State& state)
+{
+    LaplaceProblem const problem(40);
+
+    while (state.keepRunning())
+    {
+        auto const sparsity_pattern =
+            NumLib::computeSparsityPattern(problem.dof_table, *problem.mesh);
+        MicroBenchmarks::doNotOptimize(sparsity_pattern.back());
+    }
+    state.setItemsPerRepetition(problem.mesh->getNumberOfElements());
+}
+
+void scatter(MicroBenchmarks::State& state)
+{
+    LaplaceProblem const problem(40);
+    auto const sparsity_pattern =
+        NumLib::computeSparsityPattern(problem.dof_table, *problem.mesh);
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(
+        problem.matrixSpecifications(&sparsity_pattern));
+
+    while (state.keepRunning())
+    {
+        problem.scatter(*K);
+    }
+    state.setItemsPerRepetition(problem.mesh->getNumberOfElements());
+}
+
+void applyKnownSolution(MicroBenchmarks::State& state)
+{
+    LaplaceProblem const problem(40);
+    auto const sparsity_pattern =
+        NumLib::computeSparsityPattern(problem.dof_table, *problem.mesh);
+    auto const spec = problem.matrixSpecifications(&sparsity_pattern);
+    auto K_assembled =
+        MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+    problem.scatter(*K_assembled);
+    MathLib::finalizeMatrixAssembly(*K_assembled);
+
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+    auto b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+
+    while (state.keepRunning())
+    {
+        // applyKnownSolution() modifies the matrix, so it is restored before
+        // each repetition.
+        state.pauseTiming();
+        MathLib::LinAlg::copy(*K_assembled, *K);
+        b->setZero();
+        x->setZero();
+        state.resumeTiming();
+
+        MathLib::applyKnownSolution(*K, *b, *x, problem.dirichlet_ids,
+                                    problem.dirichlet_values);
+    }
+    state.setItemsPerRepetition(problem.dirichlet_ids.size());
+}
+
+void linearSolve(MicroBenchmarks::State& state)
+{
+    LaplaceProblem const problem(30);
+    auto const sparsity_pattern =
+        NumLib::computeSparsityPattern(problem.dof_table, *problem.mesh);
+    auto const spec = problem.matrixSpecifications(&sparsity_pattern);
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+    auto b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    b->setZero();
+    x->setZero();
+    problem.scatter(*K);
+    MathLib::applyKnownSolution(*K, *b, *x, problem.dirichlet_ids,
+                                problem.dirichlet_values);
+    MathLib::finalizeMatrixAssembly(*K);
+
+    boost::property_tree::ptree t_root;
+    {
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "CG");
+        t_solver.put("precon_type", "DIAGONAL");
+        t_solver.put("error_tolerance", 1e-10);
+        t_solver.put("max_iteration_step", 10000);
+        t_root.put_child("eigen", t_solver);
+    }
+    t_root.put("lis", "-i cg -p jacobi -tol 1e-10 -maxiter 10000");
+    BaseLib::ConfigTree const config(t_root, "", BaseLib::ConfigTree::onerror,
+                                     BaseLib::ConfigTree::onwarning);
+    GlobalLinearSolver linear_solver("micro_benchmark", &config);
+
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        x->setZero();
+        state.resumeTiming();
+
+        linear_solver.solve(*K, *b, *x);
+    }
+    state.setItemsPerRepetition(problem.dof_table.dofSizeWithoutGhosts());
+}
+}  // namespace
+
+OGS_MICRO_BENCHMARK("DOFTable/Construct/Hex8", &constructDofTable);
+OGS_MICRO_BENCHMARK("GlobalMatrix/ComputeSparsityPattern/Hex8",
+                    &computeSparsityPattern);
+OGS_MICRO_BENCHMARK("GlobalMatrix/Scatter/Hex8", &scatter);
+OGS_MICRO_BENCHMARK("GlobalMatrix/ApplyKnownSolution/Hex8",
+                    &applyKnownSolution);
+OGS_MICRO_BENCHMARK("LinearSolver/CG_Diagonal/Hex8", &linearSolve);
@@ -0,0 +1,211 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MicroBenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <sstream>
+
+#include <nlohmann/json.hpp>
+
+#include "BaseLib/BuildInfo.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace
+{
+std::vector<MicroBenchmarks::Benchmark>& benchmarks()
+{
+    // Function-local static to be independent of the initialization order of
+    // the translation units registering benchmarks.
+    static std::vector<MicroBenchmarks::Benchmark> registered_benchmarks;
+    return registered_benchmarks;
+}
+
+double median(std::vector<double> values)
+{
+    auto const middle = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), middle, values.end());
+    if (values.size() % 2 == 1)
+    {
+        return *middle;
+    }
+    return 0.5 * (*middle + *std::max_element(values.begin(), middle));
+}
+
+std::string currentDateTime()
+{
+    std::time_t const now = std::time(nullptr);
+    std::ostringstream os;
+    os << std::put_time(std::gmtime(&now), "%Y-%m-%dT%H:%M:%SZ");
+    return os.str();
+}
+
+double itemsPerSecond(MicroBenchmarks::Result const& result)
+{
+    return result.median > 0 ? result.items_per_repetition / result.median
+                             : 0.0;
+}
+}  // namespace
+
+namespace MicroBenchmarks
+{
+State::State(double const min_time, std::size_t const min_repetitions)
+    : _min_time(min_time), _min_repetitions(min_repetitions)
+{
+}
+
+bool State::keepRunning()
+{
+    auto const now = Clock::now();
+    if (_running)
+    {
+        double const time =
+            std::chrono::duration<double>(now - _repetition_start - _paused)
+                .count();
+        _times.push_back(time);
+        _total_time += time;
+    }
+    _running = true;
+
+    if (_times.size() >= _min_repetitions && _total_time >= _min_time)
+    {
+        return false;
+    }
+
+    _paused = Clock::duration::zero();
+    _repetition_start = Clock::now();
+    return true;
+}
+
+void State::pauseTiming()
+{
+    _pause_start = Clock::now();
+}
+
+void State::resumeTiming()
+{
+    _paused += Clock::now() - _pause_start;
+}
+
+bool registerBenchmark(std::string name, BenchmarkFunction function)
+{
+    benchmarks().push_back({std::move(name), function});
+    return true;
+}
+
+std::vector<Benchmark> const& getRegisteredBenchmarks()
+{
+    return benchmarks();
+}
+
+Result runBenchmark(Benchmark const& benchmark, double const min_time,
+                    std::size_t const min_repetitions)
+{
+    State state(min_time, min_repetitions);
+    benchmark.function(state);
+
+    auto const& times = state.getRepetitionTimes();
+    Result result{benchmark.name,
+                  times.size(),
+                  0.0,
+                  0.0,
+                  0.0,
+                  0.0,
+                  state.getItemsPerRepetition()};
+    if (times.empty())
+    {
+        return result;
+    }
+
+    result.min = *std::min_element(times.begin(), times.end());
+    result.median = median(times);
+    result.mean =
+        std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    double sum_of_squares = 0;
+    for (double const t : times)
+    {
+        sum_of_squares += (t - result.mean) * (t - result.mean);
+    }
+    result.stddev = times.size() > 1
+                        ? std::sqrt(sum_of_squares / (times.size() - 1))
+                        : 0.0;
+    return result;
+}
+
+void writeTable(std::ostream& os, std::vector<Result> const& results)
+{
+    std::size_t name_width = 9;
+    for (auto const& result : results)
+    {
+        name_width = std::max(name_width, result.name.size());
+    }
+
+    os << std::left << std::setw(name_width) << "Benchmark" << std::right
+       << std::setw(12) << "Reps" << std::setw(14) << "Median [s]"
+       << std::setw(14) << "Min [s]" << std::setw(14) << "Stddev [s]"
+       << std::setw(14) << "Items/s" << '\n';
+    os << std::string(name_width + 68, '-') << '\n';
+
+    for (auto const& result : results)
+    {
+        os << std::left << std::setw(name_width) << result.name << std::right
+           << std::setw(12) << result.repetitions << std::scientific
+           << std::setprecision(4) << std::setw(14) << result.median
+           << std::setw(14) << result.min << std::setw(14) << result.stddev
+           << std::setw(14) << itemsPerSecond(result) << '\n';
+        os.unsetf(std::ios_base::floatfield);
+    }
+}
+
+void writeJson(std::ostream& os, std::vector<Result> const& results)
+{
+    nlohmann::json json;
+
+    auto& context = json["context"];
+    context["date"] = currentDateTime();
+    context["ogs_version"] = BaseLib::BuildInfo::ogs_version;
+    context["git_version_sha1"] = BaseLib::BuildInfo::git_version_sha1;
+    context["cmake_cxx_compiler"] = BaseLib::BuildInfo::cmake_cxx_compiler;
+    context["cmake_cxx_flags"] = BaseLib::BuildInfo::cmake_cxx_flags;
+    context["cmake_cxx_flags_release"] =
+        BaseLib::BuildInfo::cmake_cxx_flags_release;
+#ifdef _OPENMP
+    context["omp_max_threads"] = omp_get_max_threads();
+#else
+    context["omp_max_threads"] = 1;
+#endif
+    context["time_unit"] = "s";
+
+    auto& benchmarks = json["benchmarks"];
+    benchmarks = nlohmann::json::array();
+    for (auto const& result : results)
+    {
+        benchmarks.push_back({{"name", result.name},
+                              {"repetitions", result.repetitions},
+                              {"median", result.median},
+                              {"min", result.min},
+                              {"mean", result.mean},
+                              {"stddev", result.stddev},
+                              {"items_per_repetition",
+                               result.items_per_repetition},
+                              {"items_per_second", itemsPerSecond(result)}});
+    }
+
+    os << std::setw(4) << json << '\n';
+}
+
+}  // namespace MicroBenchmarks
@@ -0,0 +1,133 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace MicroBenchmarks
+{
+/// Controls the repetitions of a micro-benchmark and measures the duration of
+/// each of them.
+///
+/// A benchmark function sets up its data and then runs the measured kernel in
+/// a loop:
+/// \code
+/// void benchmark(MicroBenchmarks::State& state)
+/// {
+///     auto data = setUp();
+///     while (state.keepRunning())
+///     {
+///         kernel(data);
+///     }
+/// }
+/// \endcode
+class State final
+{
+public:
+    /// \param min_time        minimum total duration of all repetitions in
+    ///                        seconds.
+    /// \param min_repetitions minimum number of repetitions.
+    State(double const min_time, std::size_t const min_repetitions);
+
+    /// Returns true as long as another repetition shall be run. The duration of
+    /// the previous repetition is recorded.
+    bool keepRunning();
+
+    /// Excludes the time until resumeTiming() from the current repetition,
+    /// e.g., for restoring data modified by the kernel.
+    void pauseTiming();
+    void resumeTiming();
+
+    /// Sets the number of items, e.g., elements or matrix rows, processed by
+    /// one repetition. It is used to report the throughput.
+    void setItemsPerRepetition(std::size_t const items)
+    {
+        _items_per_repetition = items;
+    }
+
+    std::size_t getItemsPerRepetition() const { return _items_per_repetition; }
+
+    /// Durations of all repetitions in seconds.
+    std::vector<double> const& getRepetitionTimes() const { return _times; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    double const _min_time;
+    std::size_t const _min_repetitions;
+
+    std::size_t _items_per_repetition = 0;
+    std::vector<double> _times;
+    double _total_time = 0;
+
+    bool _running = false;
+    Clock::time_point _repetition_start;
+    Clock::time_point _pause_start;
+    Clock::duration _paused{};
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+struct Benchmark
+{
+    std::string name;
+    BenchmarkFunction function;
+};
+
+/// Summary of the repetition times of a benchmark in seconds.
+struct Result
+{
+    std::string name;
+    std::size_t repetitions;
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    std::size_t items_per_repetition;
+};
+
+/// Prevents the compiler from optimizing away the computation of \c value,
+/// which would otherwise be unused by a benchmark.
+inline void doNotOptimize(double const value)
+{
+    static volatile double sink;
+    sink = value;
+}
+
+/// Adds a benchmark to the list of benchmarks run by the micro-benchmark
+/// runner. Used by OGS_MICRO_BENCHMARK.
+bool registerBenchmark(std::string name, BenchmarkFunction function);
+
+std::vector<Benchmark> const& getRegisteredBenchmarks();
+
+Result runBenchmark(Benchmark const& benchmark, double const min_time,
+                    std::size_t const min_repetitions);
+
+/// Writes the results as a human-readable table.
+void writeTable(std::ostream& os, std::vector<Result> const& results);
+
+/// Writes the results together with information about the build to a JSON
+/// document, which can be stored for tracking performance regressions.
+void writeJson(std::ostream& os, std::vector<Result> const& results);
+
+}  // namespace MicroBenchmarks
+
+#define OGS_MICRO_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define OGS_MICRO_BENCHMARK_CONCAT(a, b) OGS_MICRO_BENCHMARK_CONCAT_IMPL(a, b)
+
+/// Registers the benchmark function \c function under the name \c name.
+#define OGS_MICRO_BENCHMARK(name, function)                              \
+    static bool const OGS_MICRO_BENCHMARK_CONCAT(registered_benchmark_, \
+                                                 __COUNTER__) =        \
+        ::MicroBenchmarks::registerBenchmark(name, function)
@@ -0,0 +1,80 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <vtkXMLWriter.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "BaseLib/Error.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+#include "MicroBenchmark.h"
+
+namespace
+{
+/// Writes a hex mesh with a scalar and a vectorial nodal field and a cell
+/// field, which is a typical output of a 3D process.
+template <int DataMode, bool Compressed>
+void vtuWrite(MicroBenchmarks::State& state)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(40u, 40u, 40u,
+                                                       1. / 40));
+
+    std::vector<double> pressure;
+    std::vector<double> displacement;
+    pressure.reserve(mesh->getNumberOfNodes());
+    displacement.reserve(3 * mesh->getNumberOfNodes());
+    for (auto const* node : mesh->getNodes())
+    {
+        pressure.push_back(std::sin((*node)[0]) * std::cos((*node)[1]));
+        for (int c = 0; c < 3; ++c)
+        {
+            displacement.push_back(1e-3 * (*node)[c] * (*node)[2]);
+        }
+    }
+    MeshLib::addPropertyToMesh(*mesh, "pressure", MeshLib::MeshItemType::Node,
+                               1, pressure);
+    MeshLib::addPropertyToMesh(*mesh, "displacement",
+                               MeshLib::MeshItemType::Node, 3, displacement);
+    MeshLib::addPropertyToMesh(
+        *mesh, "MaterialIDs", MeshLib::MeshItemType::Cell, 1,
+        std::vector<int>(mesh->getNumberOfElements(), 0));
+
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "MicroBenchmark_VtuWrite.vtu";
+
+    while (state.keepRunning())
+    {
+        MeshLib::IO::VtuInterface vtu_interface(mesh.get(), DataMode,
+                                                Compressed);
+        if (!vtu_interface.writeToFile(file_name))
+        {
+            OGS_FATAL("Could not write file `%s'.", file_name.c_str());
+        }
+    }
+    std::remove(file_name.c_str());
+    state.setItemsPerRepetition(mesh->getNumberOfElements());
+}
+}  // namespace
+
+OGS_MICRO_BENCHMARK("Output/VtuWrite/Hex8/Binary",
+                    (&vtuWrite<vtkXMLWriter::Binary, false>));
+OGS_MICRO_BENCHMARK("Output/VtuWrite/Hex8/BinaryCompressed",
+                    (&vtuWrite<vtkXMLWriter::Binary, true>));
+OGS_MICRO_BENCHMARK("Output/VtuWrite/Hex8/Appended",
+                    (&vtuWrite<vtkXMLWriter::Appended, false>));
@@ -0,0 +1,98 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/PropertyVector.h"
+#include "ParameterLib/MeshElementParameter.h"
+
+#include "MicroBenchmark.h"
+
+namespace
+{
+unsigned const n_integration_points = 8;
+
+std::unique_ptr<MeshLib::Mesh> createMeshWithElementProperty()
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(30u, 30u, 30u, 1. / 30));
+    std::vector<double> values(3 * mesh->getNumberOfElements());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 1e-3 * i;
+    }
+    MeshLib::addPropertyToMesh(*mesh, "values", MeshLib::MeshItemType::Cell,
+                               3, values);
+    return mesh;
+}
+
+/// Queries a three-component element parameter at each integration point of
+/// each element as done in the local assemblers.
+template <int Mode>
+void meshElementParameter(MicroBenchmarks::State& state)
+{
+    auto const mesh = createMeshWithElementProperty();
+    ParameterLib::MeshElementParameter<double> const parameter(
+        "values", *mesh,
+        *mesh->getProperties().getPropertyVector<double>("values"));
+
+    ParameterLib::SpatialPosition x;
+    double values[3];
+    ParameterLib::Parameter<double>::RowMajorMatrix ip_values(
+        n_integration_points, 3);
+    // The element parameter does not depend on the integration point
+    // positions.
+    ParameterLib::Parameter<double>::ShapeFunctionValues const N =
+        ParameterLib::Parameter<double>::ShapeFunctionValues::Constant(
+            n_integration_points, 8, 1. / 8);
+
+    while (state.keepRunning())
+    {
+        double sum = 0;
+        for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+        {
+            if (Mode == 2)
+            {
+                parameter.evaluateAtIntegrationPoints(
+                    0, *mesh->getElement(e), N, ip_values);
+                sum += ip_values.sum();
+                continue;
+            }
+
+            x.setElementID(e);
+            for (unsigned ip = 0; ip < n_integration_points; ++ip)
+            {
+                x.setIntegrationPoint(ip);
+                if (Mode == 0)
+                {
+                    auto const v = parameter(0, x);
+                    sum += v[0] + v[1] + v[2];
+                }
+                else
+                {
+                    parameter.evaluate(0, x, values);
+                    sum += values[0] + values[1] + values[2];
+                }
+            }
+        }
+        MicroBenchmarks::doNotOptimize(sum);
+    }
+    state.setItemsPerRepetition(mesh->getNumberOfElements());
+}
+}  // namespace
+
+OGS_MICRO_BENCHMARK("Parameter/MeshElement/Operator",
+                    &meshElementParameter<0>);
+OGS_MICRO_BENCHMARK("Parameter/MeshElement/Evaluate",
+                    &meshElementParameter<1>);
+OGS_MICRO_BENCHMARK("Parameter/MeshElement/EvaluateAtIntegrationPoints",
+                    &meshElementParameter<2>);
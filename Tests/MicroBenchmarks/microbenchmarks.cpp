@@ -0,0 +1,114 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/BuildInfo.h"
+#include "MicroBenchmark.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Runs micro-benchmarks of performance-critical kernels, e.g., local "
+        "assembly, global matrix scatter, linear solver and output, on "
+        "generated meshes.\n\n"
+        "OpenGeoSys-6 software, version " +
+            BaseLib::BuildInfo::ogs_version +
+            ".\n"
+            "Copyright (c) 2012-2019, OpenGeoSys Community "
+            "(http://www.opengeosys.org)",
+        ' ', BaseLib::BuildInfo::ogs_version);
+
+    TCLAP::ValueArg<std::string> filter_arg(
+        "f", "filter",
+        "regular expression; only benchmarks with a matching name are run",
+        false, ".*", "regex");
+    cmd.add(filter_arg);
+    TCLAP::ValueArg<double> min_time_arg(
+        "t", "min-time",
+        "minimum total run time of each benchmark in seconds (default 0.5)",
+        false, 0.5, "seconds");
+    cmd.add(min_time_arg);
+    TCLAP::ValueArg<std::size_t> min_repetitions_arg(
+        "r", "min-repetitions",
+        "minimum number of repetitions of each benchmark (default 3)", false,
+        3, "number");
+    cmd.add(min_repetitions_arg);
+    TCLAP::ValueArg<std::string> json_arg(
+        "o", "output", "write the results to the given JSON file", false, "",
+        "file");
+    cmd.add(json_arg);
+    TCLAP::SwitchArg list_arg("l", "list",
+                              "list the benchmark names and exit");
+    cmd.add(list_arg);
+    TCLAP::ValueArg<std::string> log_level_arg(
+        "", "log-level",
+        "the verbosity of logging messages: none, error, warn, info, debug, "
+        "all (default warn)",
+        false, "warn", "log level");
+    cmd.add(log_level_arg);
+
+    cmd.parse(argc, argv);
+
+    logog_setup.setLevel(log_level_arg.getValue());
+
+    std::regex const filter(filter_arg.getValue());
+    std::vector<MicroBenchmarks::Benchmark> selected_benchmarks;
+    for (auto const& benchmark : MicroBenchmarks::getRegisteredBenchmarks())
+    {
+        if (std::regex_search(benchmark.name, filter))
+        {
+            selected_benchmarks.push_back(benchmark);
+        }
+    }
+
+    if (list_arg.getValue())
+    {
+        for (auto const& benchmark : selected_benchmarks)
+        {
+            std::cout << benchmark.name << '\n';
+        }
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<MicroBenchmarks::Result> results;
+    for (auto const& benchmark : selected_benchmarks)
+    {
+        INFO("Running benchmark %s.", benchmark.name.c_str());
+        results.push_back(MicroBenchmarks::runBenchmark(
+            benchmark, min_time_arg.getValue(),
+            min_repetitions_arg.getValue()));
+    }
+
+    MicroBenchmarks::writeTable(std::cout, results);
+
+    if (!json_arg.getValue().empty())
+    {
+        std::ofstream json_file(json_arg.getValue());
+        if (!json_file)
+        {
+            ERR("Could not open file `%s' for writing.",
+                json_arg.getValue().c_str());
+            return EXIT_FAILURE;
+        }
+        MicroBenchmarks::writeJson(json_file, results);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include <type_traits>
 
 #include "NumLib/NewtonRaphson.h"
 TEST(NumLibNewtonRaphson, Sqrt3)
@@ -51,3 +52,50 @@ TEST(NumLibNewtonRaphson, Sqrt3)
     EXPECT_LE(*success_iterations, maximum_iterations);
     ASSERT_LE(state - std::sqrt(3), std::numeric_limits<double>::epsilon());
 }
+
+TEST(NumLibNewtonRaphson, LocalLinearSolverTypes)
+{
+    static const int N = 2;  // Problem's size.
+
+    using LocalJacobianMatrix = Eigen::Matrix<double, N, N, Eigen::RowMajor>;
+    using LocalResidualVector = Eigen::Matrix<double, N, 1>;
+
+    // Solve f(x, y) = (x^2 + y^2 - 4, x - y) == 0 with the solution
+    // x = y = sqrt(2).
+    for (auto const type : {NumLib::LocalLinearSolverType::FullPivLU,
+                            NumLib::LocalLinearSolverType::PartialPivLU})
+    {
+        LocalResidualVector state{1, 2};
+
+        auto const update_jacobian = [&state](LocalJacobianMatrix& jacobian) {
+            jacobian << 2 * state[0], 2 * state[1], 1, -1;
+        };
+
+        auto const update_residual = [&state](LocalResidualVector& residual) {
+            residual << state.squaredNorm() - 4, state[0] - state[1];
+        };
+
+        auto const update_solution =
+            [&state](LocalResidualVector const& increment) {
+                state += increment;
+            };
+
+        auto const success_iterations =
+            NumLib::invokeWithLocalLinearSolver<LocalJacobianMatrix>(
+                type, [&](auto& linear_solver) {
+                    auto const newton_solver = NumLib::NewtonRaphson<
+                        std::remove_reference_t<decltype(linear_solver)>,
+                        LocalJacobianMatrix, decltype(update_jacobian),
+                        LocalResidualVector, decltype(update_residual),
+                        decltype(update_solution)>(
+                        linear_solver, update_jacobian, update_residual,
+                        update_solution, {10, 1e-14, type});
+                    LocalJacobianMatrix jacobian;
+                    return newton_solver.solve(jacobian);
+                });
+
+        ASSERT_TRUE(static_cast<bool>(success_iterations));
+        EXPECT_NEAR(std::sqrt(2), state[0], 1e-14);
+        EXPECT_NEAR(std::sqrt(2), state[1], 1e-14);
+    }
+}
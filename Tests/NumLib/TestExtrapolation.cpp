@@ -149,7 +149,8 @@ public:
         NumLib::LocalLinearLeastSquaresExtrapolator;
 
     ExtrapolationTestProcess(MeshLib::Mesh const& mesh,
-                             unsigned const integration_order)
+                             unsigned const integration_order,
+                             int const number_of_threads)
         : _integration_order(integration_order),
           _mesh_subset_all_nodes(mesh, mesh.getNodes())
     {
@@ -161,8 +162,8 @@ public:
 
         // Passing _dof_table works, because this process has only one variable
         // and the variable has exactly one component.
-        _extrapolator =
-            std::make_unique<ExtrapolatorImplementation>(*_dof_table);
+        _extrapolator = std::make_unique<ExtrapolatorImplementation>(
+            *_dof_table, number_of_threads);
 
         // createAssemblers(mesh);
         ProcessLib::createLocalAssemblers<LocalAssemblerData>(
@@ -280,8 +281,9 @@ TEST(NumLib, DISABLED_Extrapolation)
         DBUG("number of nodes: %lu, number of elements: %lu", nnodes,
              nelements);
 
-        ExtrapolationTest::ExtrapolationTestProcess pcs(*mesh,
-                                                        integration_order);
+        int const number_of_threads = 1;
+        ExtrapolationTest::ExtrapolationTestProcess pcs(
+            *mesh, integration_order, number_of_threads);
 
         // generate random nodal values
         MathLib::MatrixSpecifications spec{nnodes, nnodes, nullptr, nullptr};
@@ -310,3 +312,49 @@ TEST(NumLib, DISABLED_Extrapolation)
             *two_x, nnodes, nelements);
     }
 }
+
+#ifndef USE_PETSC
+TEST(NumLib, ExtrapolationMultiThreaded)
+#else
+TEST(NumLib, DISABLED_ExtrapolationMultiThreaded)
+#endif
+{
+    // Same as the Extrapolation test, but with more elements than extrapolated
+    // by one thread at a time, such that several batches are processed
+    // concurrently.
+    const double mesh_length = 1.0;
+    const std::size_t mesh_elements_in_each_direction = 12;
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(
+            mesh_length, mesh_elements_in_each_direction));
+
+    namespace LinAlg = MathLib::LinAlg;
+
+    auto const nnodes = mesh->getNumberOfNodes();
+    auto const nelements = mesh->getNumberOfElements();
+
+    unsigned const integration_order = 2;
+    int const number_of_threads = 3;
+    ExtrapolationTest::ExtrapolationTestProcess pcs(*mesh, integration_order,
+                                                    number_of_threads);
+
+    MathLib::MatrixSpecifications spec{nnodes, nnodes, nullptr, nullptr};
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+
+    fillVectorRandomly(*x);
+
+    pcs.interpolateNodalValuesToIntegrationPoints(*x);
+
+    ExtrapolationTest::extrapolate(
+        pcs, &ExtrapolationTest::LocalAssemblerDataInterface::getStoredQuantity,
+        *x, nnodes, nelements);
+
+    auto two_x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(*x);
+    LinAlg::axpy(*two_x, 1.0, *x);  // two_x = x + x
+
+    ExtrapolationTest::extrapolate(
+        pcs,
+        &ExtrapolationTest::LocalAssemblerDataInterface::getDerivedQuantity,
+        *two_x, nnodes, nelements);
+}
@@ -292,6 +292,107 @@ TYPED_TEST(NumLibODEIntTyped, DISABLED_T1)
     TestFixture::test();
 }
 
+namespace
+{
+// Same equations as ODE1, but able to assemble the residual element-wise.
+class ODE1LocalResidual final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Newton>
+{
+public:
+    void preAssemble(const double /*t*/, GlobalVector const& /*x*/) override {}
+
+    void assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
+                  GlobalMatrix& K, GlobalVector& b) override
+    {
+        _ode1.assemble(t, x, M, K, b);
+    }
+
+    void assembleWithJacobian(const double t, GlobalVector const& x,
+                              GlobalVector const& xdot, const double dxdot_dx,
+                              const double dx_dx, GlobalMatrix& M,
+                              GlobalMatrix& K, GlobalVector& b,
+                              GlobalMatrix& Jac) override
+    {
+        if (!_local_residual_assembly)
+        {
+            _ode1.assembleWithJacobian(t, x, xdot, dxdot_dx, dx_dx, M, K, b,
+                                       Jac);
+            return;
+        }
+
+        // b = -(M * xdot + K * x) with M = I and K = [0, 1; -1, 0].
+        MathLib::setVector(
+            b, {-xdot.get(0) - x.get(1), -xdot.get(1) + x.get(0)});
+        MathLib::setMatrix(Jac, {dxdot_dx, dx_dx, -dx_dx, dxdot_dx});
+    }
+
+    void setLocalResidualAssembly(bool const enabled) override
+    {
+        _local_residual_assembly = enabled;
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications(
+        const int process_id) const override
+    {
+        return _ode1.getMatrixSpecifications(process_id);
+    }
+
+    bool isLinear() const override { return true; }
+
+private:
+    ODE1 _ode1;
+    bool _local_residual_assembly = false;
+};
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, LocalResidualAssembly)
+#else
+TEST(NumLibODEInt, DISABLED_LocalResidualAssembly)
+#endif
+{
+    ODE1LocalResidual ode;
+    NumLib::BackwardEuler time_disc;
+
+    GlobalVector x0(2);
+    ODETraits<ODE1>::setIC(x0);
+    time_disc.setInitialState(0.0, x0);
+    time_disc.nextTimestep(0.1, 0.1);
+
+    GlobalVector x(2);
+    MathLib::setVector(x, {0.9, 0.2});
+    MathLib::LinAlg::finalizeAssembly(x);
+
+    auto residual_and_jacobian = [&](bool const local_residual_assembly) {
+        NumLib::TimeDiscretizedODESystem<
+            NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+            NumLib::NonlinearSolverTag::Newton>
+            sys(0, ode, time_disc, local_residual_assembly);
+        sys.assemble(x);
+
+        GlobalVector res(2);
+        sys.getResidual(x, res);
+        GlobalMatrix Jac(2);
+        sys.getJacobian(Jac);
+        return std::make_pair(res, Jac);
+    };
+
+    auto const global = residual_and_jacobian(false);
+    auto const local = residual_and_jacobian(true);
+
+    for (GlobalIndexType i = 0; i < 2; i++)
+    {
+        EXPECT_NEAR(global.first.get(i), local.first.get(i), 1e-15);
+        for (GlobalIndexType j = 0; j < 2; j++)
+        {
+            EXPECT_NEAR(global.second.get(i, j), local.second.get(i, j),
+                        1e-15);
+        }
+    }
+}
+
 
 /* TODO Other possible test cases:
  *
@@ -0,0 +1,149 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Assembler/ElementColoring.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
+
+namespace
+{
+// Adds one to the counter of each node of the given element, emulating the
+// scatter of a local vector into a global one.
+struct NodeCounter
+{
+    void count(std::size_t const /*id*/, MeshLib::Element const& element)
+    {
+        for (unsigned n = 0; n < element.getNumberOfNodes(); ++n)
+        {
+            counts[element.getNodeIndex(n)]++;
+        }
+    }
+
+    std::vector<std::size_t> counts;
+};
+}  // namespace
+
+TEST(NumLib_ElementColoring, NeighborsHaveDifferentColors)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1., 5u));
+
+    auto const colors = NumLib::computeElementColors(*mesh);
+    ASSERT_EQ(mesh->getNumberOfElements(), colors.size());
+
+    // Each element of a regular hex mesh has at most 26 neighbors.
+    EXPECT_GE(27u, *std::max_element(colors.begin(), colors.end()) + 1);
+
+    for (auto const* e : mesh->getElements())
+    {
+        for (unsigned n = 0; n < e->getNumberOfNodes(); ++n)
+        {
+            for (auto const* neighbor : e->getNode(n)->getElements())
+            {
+                if (neighbor != e)
+                {
+                    EXPECT_NE(colors[e->getID()], colors[neighbor->getID()]);
+                }
+            }
+        }
+    }
+}
+
+TEST(NumLib_ElementColoring, GroupsHaveDisjointColors)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1., 10u));
+    auto const& elements = mesh->getElements();
+
+    // Split the elements into two interleaved groups.
+    std::vector<MeshLib::Element*> even_elements;
+    std::vector<MeshLib::Element*> odd_elements;
+    for (auto* e : elements)
+    {
+        (e->getID() % 2 == 0 ? even_elements : odd_elements).push_back(e);
+    }
+
+    std::vector<std::size_t> colors(elements.size(),
+                                    NumLib::no_element_color);
+    auto const number_of_even_colors =
+        NumLib::colorElements(even_elements, 0, colors);
+    auto const number_of_colors =
+        NumLib::colorElements(odd_elements, number_of_even_colors, colors);
+    ASSERT_LT(number_of_even_colors, number_of_colors);
+
+    for (auto const* e : elements)
+    {
+        auto const color = colors[e->getID()];
+        EXPECT_EQ(e->getID() % 2 == 0, color < number_of_even_colors);
+        EXPECT_GT(number_of_colors, color);
+
+        for (unsigned n = 0; n < e->getNumberOfNodes(); ++n)
+        {
+            for (auto const* neighbor : e->getNode(n)->getElements())
+            {
+                if (neighbor != e)
+                {
+                    EXPECT_NE(color, colors[neighbor->getID()]);
+                }
+            }
+        }
+    }
+}
+
+TEST(NumLib_ParallelExecutor, ScatterIsConflictFree)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1., 50u));
+    auto const& elements = mesh->getElements();
+
+    std::vector<std::size_t> expected_counts(mesh->getNumberOfNodes());
+    for (auto const* node : mesh->getNodes())
+    {
+        expected_counts[node->getID()] = node->getNumberOfElements();
+    }
+
+    NumLib::ParallelExecutor const executor(
+        4, NumLib::computeElementColors(*mesh));
+
+    {
+        NodeCounter counter{std::vector<std::size_t>(mesh->getNumberOfNodes())};
+        executor.executeMemberDereferenced(counter, &NodeCounter::count,
+                                           elements);
+        EXPECT_EQ(expected_counts, counter.counts);
+    }
+
+    {
+        // Every third element is selected.
+        std::vector<std::size_t> active_ids;
+        std::vector<std::size_t> expected_active_counts(
+            mesh->getNumberOfNodes());
+        for (std::size_t id = 0; id < elements.size(); id += 3)
+        {
+            active_ids.push_back(id);
+            for (unsigned n = 0; n < elements[id]->getNumberOfNodes(); ++n)
+            {
+                expected_active_counts[elements[id]->getNodeIndex(n)]++;
+            }
+        }
+
+        NodeCounter counter{std::vector<std::size_t>(mesh->getNumberOfNodes())};
+        executor.executeSelectedMemberDereferenced(
+            counter, &NodeCounter::count, elements, active_ids);
+        EXPECT_EQ(expected_active_counts, counter.counts);
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
 #include <utility>
 #include <vector>
 
@@ -101,3 +102,40 @@ TEST(NumLib, TimeSteppingIterationNumberBased2)
     ASSERT_EQ(1u, alg.getNumberOfRepeatedSteps());
     ASSERT_ARRAY_NEAR(expected_vec_t, vec_t, expected_vec_t.size(), std::numeric_limits<double>::epsilon());
 }
+
+TEST(NumLib, TimeSteppingIterationNumberBasedRestart)
+{
+    auto create_algorithm = []() {
+        return NumLib::IterationNumberBasedTimeStepping(
+            1, 31, 1, 10, 1, {0, 3, 5, 7}, {2.0, 1.0, 0.5, 0.25});
+    };
+    auto alg = create_algorithm();
+
+    const double solution_error = 0.;
+    for (int const iterations : {2, 2, 8})
+    {
+        alg.next(solution_error, iterations);
+    }
+
+    std::stringstream state;
+    alg.writeState(state);
+
+    auto restarted_alg = create_algorithm();
+    restarted_alg.readState(state);
+    ASSERT_TRUE(static_cast<bool>(state));
+
+    ASSERT_EQ(alg.getNumberOfRepeatedSteps(),
+              restarted_alg.getNumberOfRepeatedSteps());
+    for (int const iterations : {4, 4, 2, 6})
+    {
+        ASSERT_EQ(alg.next(solution_error, iterations),
+                  restarted_alg.next(solution_error, iterations));
+        auto const ts = alg.getTimeStep();
+        auto const restarted_ts = restarted_alg.getTimeStep();
+        ASSERT_EQ(ts.steps(), restarted_ts.steps());
+        ASSERT_EQ(ts.previous(), restarted_ts.previous());
+        ASSERT_EQ(ts.current(), restarted_ts.current());
+        ASSERT_EQ(ts.dt(), restarted_ts.dt());
+        ASSERT_EQ(alg.accepted(), restarted_alg.accepted());
+    }
+}
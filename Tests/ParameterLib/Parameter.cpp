@@ -24,6 +24,7 @@
 #include "MeshLib/PropertyVector.h"
 
 #include "ParameterLib/CurveScaledParameter.h"
+#include "ParameterLib/FunctionParameter.h"
 #include "ParameterLib/GroupBasedParameter.h"
 
 using namespace ParameterLib;
@@ -255,3 +256,285 @@ TEST_F(ParameterLibParameter, GetNodalValuesOnElement_curveScaledNode)
     ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
                                          expected_value, *parameter, t));
 }
+
+// Shape function values of three integration points of a line element.
+Parameter<double>::ShapeFunctionValues lineShapeFunctionValues()
+{
+    Parameter<double>::ShapeFunctionValues N(3, 2);
+    N << 1, 0, 0.5, 0.5, 0.25, 0.75;
+    return N;
+}
+
+// Checks that the allocation-free evaluation methods give the same values as
+// the operator() for all line elements and for three integration points each.
+bool testEvaluateMatchesOperator(std::vector<MeshLib::Element*> const& elements,
+                                 Parameter<double> const& parameter,
+                                 double const t)
+{
+    int const n_components = parameter.getNumberOfComponents();
+    auto const N = lineShapeFunctionValues();
+    int const n_integration_points = N.rows();
+    std::vector<double> values(n_components);
+    Parameter<double>::RowMajorMatrix ip_values(n_integration_points,
+                                                n_components);
+
+    return std::all_of(
+        begin(elements), end(elements), [&](MeshLib::Element* const e) {
+            parameter.evaluateAtIntegrationPoints(t, *e, N, ip_values);
+
+            SpatialPosition x;
+            x.setElementID(e->getID());
+            for (int ip = 0; ip < n_integration_points; ++ip)
+            {
+                x.setIntegrationPoint(ip);
+                x.setCoordinates(MathLib::TemplatePoint<double, 3>{
+                    {N(ip, 0) * (*e->getNode(0))[0] +
+                         N(ip, 1) * (*e->getNode(1))[0],
+                     0, 0}});
+                auto const expected_values = parameter(t, x);
+                parameter.evaluate(t, x, values.data());
+                for (int c = 0; c < n_components; ++c)
+                {
+                    if (expected_values[c] != values[c] ||
+                        expected_values[c] != ip_values(ip, c))
+                    {
+                        ERR("Mismatch for element %d, integration point %d, "
+                            "component %d; Expected %g, got %g and %g.",
+                            e->getID(), ip, c, expected_values[c], values[c],
+                            ip_values(ip, c));
+                        return false;
+                    }
+                }
+            }
+            return true;
+        });
+}
+
+TEST_F(ParameterLibParameter, Evaluate_constant)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Constant</type>"
+        "<values>42.23 -1 3</values>",
+        meshes);
+
+    ASSERT_TRUE(
+        testEvaluateMatchesOperator(meshes[0]->getElements(), *parameter, 0));
+}
+
+TEST_F(ParameterLibParameter, Evaluate_element)
+{
+    std::vector<double> element_values({0, 1, 2, 3, 4, 5, 6, 7});
+    MeshLib::addPropertyToMesh(*meshes[0], "ElementValues",
+                               MeshLib::MeshItemType::Cell, 2, element_values);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>MeshElement</type>"
+        "<field_name>ElementValues</field_name>",
+        meshes);
+
+    ASSERT_TRUE(
+        testEvaluateMatchesOperator(meshes[0]->getElements(), *parameter, 0));
+}
+
+TEST_F(ParameterLibParameter, Evaluate_groupBasedElement)
+{
+    std::vector<int> mat_ids({0, 1, 1, 0});
+    MeshLib::addPropertyToMesh(*meshes[0], "MaterialIDs",
+                               MeshLib::MeshItemType::Cell, 1, mat_ids);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Group</type>"
+        "<group_id_property>MaterialIDs</group_id_property>"
+        "<index_values><index>0</index><value>10</value></index_values>"
+        "<index_values><index>1</index><value>100</value></index_values>",
+        meshes);
+
+    ASSERT_TRUE(
+        testEvaluateMatchesOperator(meshes[0]->getElements(), *parameter, 0));
+}
+
+TEST_F(ParameterLibParameter, Evaluate_curveScaledElement)
+{
+    std::vector<double> element_ids({0, 1, 2, 3});
+    MeshLib::addPropertyToMesh(*meshes[0], "ElementIDs",
+                               MeshLib::MeshItemType::Cell, 1, element_ids);
+
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    parameters.emplace_back(
+        constructParameterFromString("<name>ElementIDs</name>"
+                                     "<type>MeshElement</type>"
+                                     "<field_name>ElementIDs</field_name>",
+                                     meshes));
+
+    std::map<std::string,
+             std::unique_ptr<MathLib::PiecewiseLinearInterpolation>>
+        curves;
+    curves["linear_curve"] =
+        std::make_unique<MathLib::PiecewiseLinearInterpolation>(
+            std::vector<double>{0, 1}, std::vector<double>{0, 1}, true);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>ElementIDs</parameter>",
+        meshes, curves);
+
+    parameter->initialize(parameters);
+
+    ASSERT_TRUE(testEvaluateMatchesOperator(meshes[0]->getElements(),
+                                            *parameter, 0.5));
+}
+
+TEST_F(ParameterLibParameter, Evaluate_function)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Function</type>"
+        "<expression>2*x + 1</expression>"
+        "<expression>x*t</expression>",
+        meshes);
+
+    ASSERT_TRUE(
+        testEvaluateMatchesOperator(meshes[0]->getElements(), *parameter, 2));
+}
+
+// The nodal values are interpolated to the integration points.
+TEST_F(ParameterLibParameter, Evaluate_node)
+{
+    std::vector<double> node_values({0, 10, 20, 30, 40});
+    MeshLib::addPropertyToMesh(*meshes[0], "NodeValues",
+                               MeshLib::MeshItemType::Node, 1, node_values);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>MeshNode</type>"
+        "<field_name>NodeValues</field_name>",
+        meshes);
+
+    auto const N = lineShapeFunctionValues();
+    Parameter<double>::RowMajorMatrix ip_values(N.rows(), 1);
+    for (auto const* const e : meshes[0]->getElements())
+    {
+        parameter->evaluateAtIntegrationPoints(0, *e, N, ip_values);
+        for (int ip = 0; ip < N.rows(); ++ip)
+        {
+            EXPECT_DOUBLE_EQ(
+                N(ip, 0) * node_values[e->getNode(0)->getID()] +
+                    N(ip, 1) * node_values[e->getNode(1)->getID()],
+                ip_values(ip, 0));
+        }
+    }
+}
+
+TEST_F(ParameterLibParameter, FunctionParameter_nodes)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Function</type>"
+        "<expression>2*x + 1</expression>",
+        meshes);
+    ASSERT_FALSE(parameter->isTimeDependent());
+
+    // For all elements all nodes have the value 2x + 1.
+    auto expected_value = [](MeshLib::Element* const e,
+                             std::size_t const local_node_id) {
+        return 2 * (*e->getNode(local_node_id))[0] + 1;
+    };
+
+    ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
+                                         expected_value, *parameter, 0));
+
+    SpatialPosition x;
+    x.setNodeID(3);
+    ASSERT_EQ(2 * 3 + 1, (*parameter)(0, x)[0]);
+}
+
+TEST_F(ParameterLibParameter, FunctionParameter_tabulatedNodes)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Function</type>"
+        "<expression>2*x + 1</expression>"
+        "<tabulate_nodal_values>true</tabulate_nodal_values>",
+        meshes);
+
+    auto expected_value = [](MeshLib::Element* const e,
+                             std::size_t const local_node_id) {
+        return 2 * (*e->getNode(local_node_id))[0] + 1;
+    };
+
+    ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
+                                         expected_value, *parameter, 0));
+
+    SpatialPosition x;
+    x.setNodeID(3);
+    ASSERT_EQ(2 * 3 + 1, (*parameter)(0, x)[0]);
+}
+
+TEST_F(ParameterLibParameter, FunctionParameter_timeDependent)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Function</type>"
+        "<expression>x*t</expression>"
+        "<expression>y - t</expression>",
+        meshes);
+    ASSERT_TRUE(parameter->isTimeDependent());
+
+    SpatialPosition x;
+    x.setCoordinates(MathLib::TemplatePoint<double, 3>{{0.5, 2, 0}});
+    auto const values = (*parameter)(3, x);
+    ASSERT_EQ(1.5, values[0]);
+    ASSERT_EQ(-1, values[1]);
+}
+
+// Evaluates the function at many points in parallel and batched, which must
+// give the same results as the serial evaluation.
+TEST_F(ParameterLibParameter, FunctionParameter_parallelAndBatched)
+{
+    auto const parameter_base = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Function</type>"
+        "<expression>x*x + y*z</expression>"
+        "<expression>t*(x - z)</expression>",
+        meshes);
+    auto const& parameter =
+        dynamic_cast<FunctionParameter<double> const&>(*parameter_base);
+
+    int const n_points = 1000;
+    double const t = 2;
+    Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::RowMajor> coordinates(
+        n_points, 3);
+    for (int p = 0; p < n_points; ++p)
+    {
+        coordinates.row(p) << 1e-3 * p, 2 - 1e-3 * p, 0.5 + 1e-3 * p;
+    }
+
+    Parameter<double>::RowMajorMatrix parallel_values(n_points, 2);
+#pragma omp parallel for
+    for (int p = 0; p < n_points; ++p)
+    {
+        SpatialPosition x;
+        x.setCoordinates(MathLib::TemplatePoint<double, 3>{
+            {coordinates(p, 0), coordinates(p, 1), coordinates(p, 2)}});
+        parameter.evaluate(t, x, parallel_values.row(p).data());
+    }
+
+    Parameter<double>::RowMajorMatrix batched_values(n_points, 2);
+    parameter.evaluateAtPoints(t, coordinates, batched_values);
+
+    for (int p = 0; p < n_points; ++p)
+    {
+        double const x = coordinates(p, 0);
+        double const y = coordinates(p, 1);
+        double const z = coordinates(p, 2);
+        ASSERT_DOUBLE_EQ(x * x + y * z, parallel_values(p, 0));
+        ASSERT_DOUBLE_EQ(t * (x - z), parallel_values(p, 1));
+        ASSERT_EQ(parallel_values(p, 0), batched_values(p, 0));
+        ASSERT_EQ(parallel_values(p, 1), batched_values(p, 1));
+    }
+}
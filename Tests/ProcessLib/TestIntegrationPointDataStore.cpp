@@ -0,0 +1,144 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <sstream>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/Hex.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "ProcessLib/Utils/IntegrationPointDataStore.h"
+
+TEST(ProcessLib_IntegrationPointDataStore, Layout)
+{
+    ProcessLib::IntegrationPointDataStore store({2, 0, 3});
+    int const vector_field = store.addField("vector", 2);
+    int const scalar_field = store.addField("scalar", 1);
+
+    ASSERT_EQ(5u, store.getNumberOfIntegrationPoints());
+    EXPECT_EQ(2u, store.getNumberOfIntegrationPoints(0));
+    EXPECT_EQ(0u, store.getNumberOfIntegrationPoints(1));
+    EXPECT_EQ(3u, store.getNumberOfIntegrationPoints(2));
+
+    EXPECT_EQ(vector_field, store.findField("vector"));
+    EXPECT_EQ(scalar_field, store.findField("scalar"));
+    EXPECT_EQ(-1, store.findField("unknown"));
+    EXPECT_EQ(10u, store.values(vector_field).size());
+    EXPECT_EQ(5u, store.values(scalar_field).size());
+
+    // Fields are zero initialized.
+    for (auto const v : store.values(vector_field))
+    {
+        EXPECT_EQ(0., v);
+    }
+
+    store.value<Eigen::Vector2d>(vector_field, 2, 1) << 3., 4.;
+    *store.data(scalar_field, 2, 2) = 5.;
+
+    std::vector<double> const expected_vector_values = {0, 0, 0, 0, 0,
+                                                        0, 3, 4, 0, 0};
+    EXPECT_EQ(expected_vector_values, store.values(vector_field));
+    EXPECT_EQ(5., store.values(scalar_field)[4]);
+
+    auto const element_values = store.elementValues<2>(vector_field, 2);
+    ASSERT_EQ(3, element_values.cols());
+    EXPECT_EQ(3., element_values(0, 1));
+    EXPECT_EQ(4., element_values(1, 1));
+}
+
+TEST(ProcessLib_IntegrationPointDataStore, CopyField)
+{
+    ProcessLib::IntegrationPointDataStore store({1, 2});
+    int const current = store.addField("current", 2);
+    int const previous = store.addField("previous", 2);
+    store.addField("scalar", 1);
+
+    // Views into the destination field stay valid after the copy.
+    auto const previous_view =
+        store.value<Eigen::Vector2d>(previous, 1, 1);
+    store.value<Eigen::Vector2d>(current, 1, 1) << 1., 2.;
+    store.copyField(current, previous);
+
+    EXPECT_EQ(store.values(current), store.values(previous));
+    EXPECT_EQ(1., previous_view[0]);
+    EXPECT_EQ(2., previous_view[1]);
+}
+
+TEST(ProcessLib_IntegrationPointDataStore, WriteAndReadFields)
+{
+    auto create_store = [] {
+        ProcessLib::IntegrationPointDataStore store({1, 2});
+        store.addField("vector", 2);
+        store.addField("scalar", 1);
+        return store;
+    };
+
+    auto store = create_store();
+    std::iota(store.values(0).begin(), store.values(0).end(), 1.);
+    std::iota(store.values(1).begin(), store.values(1).end(), -3.);
+    std::stringstream stream;
+    store.writeFields(stream);
+
+    // Views into the fields stay valid while reading.
+    auto restored = create_store();
+    auto const view = restored.value<Eigen::Vector2d>(0, 1, 1);
+    restored.readFields(stream);
+
+    EXPECT_EQ(store.values(0), restored.values(0));
+    EXPECT_EQ(store.values(1), restored.values(1));
+    EXPECT_EQ(5., view[0]);
+    EXPECT_EQ(6., view[1]);
+
+    // Fields not matching the store are rejected.
+    ProcessLib::IntegrationPointDataStore other({1, 2});
+    other.addField("scalar", 1);
+    other.addField("vector", 2);
+    std::stringstream other_stream;
+    store.writeFields(other_stream);
+    EXPECT_ANY_THROW(other.readFields(other_stream));
+}
+
+template <typename MeshElement>
+void checkGaussLegendreIntegrationPoints(MeshLib::Mesh const& mesh)
+{
+    using IntegrationMethod =
+        typename NumLib::GaussLegendreIntegrationPolicy<
+            MeshElement>::IntegrationMethod;
+
+    for (unsigned order = 1; order <= 3; ++order)
+    {
+        ProcessLib::IntegrationPointDataStore const store(mesh.getElements(),
+                                                          order);
+
+        auto const n = IntegrationMethod{order}.getNumberOfPoints();
+        EXPECT_EQ(mesh.getNumberOfElements() * n,
+                  store.getNumberOfIntegrationPoints());
+        for (auto const* e : mesh.getElements())
+        {
+            EXPECT_EQ(n, store.getNumberOfIntegrationPoints(e->getID()));
+        }
+    }
+}
+
+TEST(ProcessLib_IntegrationPointDataStore, GaussLegendreIntegrationPoints)
+{
+    std::unique_ptr<MeshLib::Mesh> const hex_mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1., 3u));
+    checkGaussLegendreIntegrationPoints<MeshLib::Hex>(*hex_mesh);
+
+    std::unique_ptr<MeshLib::Mesh> const tri_mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(1., 3u));
+    checkGaussLegendreIntegrationPoints<MeshLib::Tri>(*tri_mesh);
+}
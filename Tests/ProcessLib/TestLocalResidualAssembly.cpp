@@ -0,0 +1,198 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/NumericsConfig.h"
+#include "NumLib/ODESolver/TimeDiscretization.h"
+#include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/VectorMatrixAssembler.h"
+
+namespace
+{
+//! Assembles constant local matrices of a line element with two nodes.
+class LinearLineLocalAssembler final
+    : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    void assembleWithJacobian(double const /*t*/,
+                              std::vector<double> const& /*local_x*/,
+                              std::vector<double> const& /*local_xdot*/,
+                              const double dxdot_dx, const double dx_dx,
+                              std::vector<double>& local_M_data,
+                              std::vector<double>& local_K_data,
+                              std::vector<double>& local_b_data,
+                              std::vector<double>& local_Jac_data) override
+    {
+        local_M_data = {2.0, 1.0, 1.0, 2.0};
+        local_K_data = {1.0, -1.0, -1.0, 1.0};
+        local_b_data = {0.5, 1.0};
+
+        local_Jac_data.resize(4);
+        auto local_Jac = MathLib::toMatrix(local_Jac_data, 2, 2);
+        local_Jac.noalias() = dxdot_dx * MathLib::toMatrix(local_M_data, 2, 2) +
+                              dx_dx * MathLib::toMatrix(local_K_data, 2, 2);
+    }
+};
+
+//! Assembles the line elements of a mesh through the VectorMatrixAssembler
+//! like ProcessLib::Process does.
+class LineMeshODE final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Newton>
+{
+public:
+    explicit LineMeshODE(MeshLib::Mesh const& mesh)
+        : _mesh_subset_all_nodes(mesh, mesh.getNodes()),
+          _dof_table({_mesh_subset_all_nodes},
+                     NumLib::ComponentOrder::BY_COMPONENT),
+          _sparsity_pattern(NumLib::computeSparsityPattern(_dof_table, mesh)),
+          _global_assembler(
+              std::make_unique<ProcessLib::AnalyticalJacobianAssembler>())
+    {
+        for (std::size_t i = 0; i < mesh.getNumberOfElements(); ++i)
+        {
+            _local_assemblers.push_back(
+                std::make_unique<LinearLineLocalAssembler>());
+        }
+    }
+
+    void preAssemble(const double /*t*/, GlobalVector const& /*x*/) override {}
+
+    void assemble(const double /*t*/, GlobalVector const& /*x*/,
+                  GlobalMatrix& /*M*/, GlobalMatrix& /*K*/,
+                  GlobalVector& /*b*/) override
+    {
+        OGS_FATAL("Only the Newton method is tested.");
+    }
+
+    void assembleWithJacobian(const double t, GlobalVector const& x,
+                              GlobalVector const& xdot, const double dxdot_dx,
+                              const double dx_dx, GlobalMatrix& M,
+                              GlobalMatrix& K, GlobalVector& b,
+                              GlobalMatrix& Jac) override
+    {
+        std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
+            dof_tables{_dof_table};
+        for (std::size_t i = 0; i < _local_assemblers.size(); ++i)
+        {
+            _global_assembler.assembleWithJacobian(
+                i, *_local_assemblers[i], dof_tables, t, x, xdot, dxdot_dx,
+                dx_dx, M, K, b, Jac, nullptr);
+        }
+    }
+
+    void setLocalResidualAssembly(bool const enabled) override
+    {
+        _global_assembler.setLocalResidualAssembly(enabled);
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications(
+        const int /*process_id*/) const override
+    {
+        return {_dof_table.dofSizeWithoutGhosts(),
+                _dof_table.dofSizeWithoutGhosts(), nullptr,
+                &_sparsity_pattern};
+    }
+
+    bool isLinear() const override { return false; }
+
+private:
+    MeshLib::MeshSubset const _mesh_subset_all_nodes;
+    NumLib::LocalToGlobalIndexMap _dof_table;
+    GlobalSparsityPattern const _sparsity_pattern;
+    ProcessLib::VectorMatrixAssembler _global_assembler;
+    std::vector<std::unique_ptr<ProcessLib::LocalAssemblerInterface>>
+        _local_assemblers;
+};
+
+//! Compares the residual and the Jacobian of the global and the local
+//! residual assembly at a state differing from the previous timestep's one.
+void testLocalResidualAssembly(NumLib::TimeDiscretization& time_disc)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateLineMesh(3u, 1.0));
+    LineMeshODE ode(*mesh);
+
+    GlobalVector x0(4);
+    MathLib::setVector(x0, {1.0, 0.5, 0.25, 0.125});
+    MathLib::LinAlg::finalizeAssembly(x0);
+    time_disc.setInitialState(0.0, x0);
+    time_disc.nextTimestep(0.1, 0.1);
+
+    GlobalVector x(4);
+    MathLib::setVector(x, {0.9, 0.7, -0.2, 0.3});
+    MathLib::LinAlg::finalizeAssembly(x);
+
+    auto residual_and_jacobian = [&](bool const local_residual_assembly) {
+        NumLib::TimeDiscretizedODESystem<
+            NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+            NumLib::NonlinearSolverTag::Newton>
+            sys(0, ode, time_disc, local_residual_assembly);
+        sys.assemble(x);
+
+        GlobalVector res(4);
+        sys.getResidual(x, res);
+        GlobalMatrix Jac(4);
+        sys.getJacobian(Jac);
+        return std::make_pair(res, Jac);
+    };
+
+    auto const global = residual_and_jacobian(false);
+    auto const local = residual_and_jacobian(true);
+
+    for (GlobalIndexType i = 0; i < 4; i++)
+    {
+        EXPECT_NEAR(global.first.get(i), local.first.get(i), 1e-14);
+        for (GlobalIndexType j = 0; j < 4; j++)
+        {
+            EXPECT_NEAR(global.second.get(i, j), local.second.get(i, j),
+                        1e-14);
+        }
+    }
+}
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(ProcessLibVectorMatrixAssembler, LocalResidualAssemblyBackwardEuler)
+#else
+TEST(ProcessLibVectorMatrixAssembler,
+     DISABLED_LocalResidualAssemblyBackwardEuler)
+#endif
+{
+    NumLib::BackwardEuler time_disc;
+    testLocalResidualAssembly(time_disc);
+}
+
+#ifndef USE_PETSC
+TEST(ProcessLibVectorMatrixAssembler, LocalResidualAssemblyForwardEuler)
+#else
+TEST(ProcessLibVectorMatrixAssembler,
+     DISABLED_LocalResidualAssemblyForwardEuler)
+#endif
+{
+    // The residual is evaluated at the old timestep's solution, which differs
+    // from the current iterate.
+    NumLib::ForwardEuler time_disc;
+    testLocalResidualAssembly(time_disc);
+}
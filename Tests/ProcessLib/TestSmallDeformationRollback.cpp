@@ -0,0 +1,309 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <map>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MaterialLib/SolidModels/Ehlers.h"
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreRegular.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "ParameterLib/ConstantParameter.h"
+#include "ProcessLib/SmallDeformation/IntegrationPointState.h"
+#include "ProcessLib/SmallDeformation/SmallDeformationFEM.h"
+
+namespace
+{
+constexpr int Dim = 3;
+using LocalAssembler = ProcessLib::SmallDeformation::
+    SmallDeformationLocalAssembler<NumLib::ShapeHex8,
+                                   NumLib::IntegrationGaussLegendreRegular<Dim>,
+                                   Dim>;
+using ProcessData =
+    ProcessLib::SmallDeformation::SmallDeformationProcessData<Dim>;
+
+//! The part of a SmallDeformationProcess holding the state of one element.
+struct ElementState
+{
+    std::unique_ptr<ProcessData> process_data;
+    /// The local assembler of the only element.
+    std::vector<std::unique_ptr<LocalAssembler>> local_assemblers;
+
+    LocalAssembler& localAssembler() const { return *local_assemblers[0]; }
+};
+
+class SmallDeformationRollback : public ::testing::Test
+{
+public:
+    SmallDeformationRollback()
+        : _mesh(MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 1)),
+          _mesh_subset_all_nodes(*_mesh, _mesh->getNodes()),
+          _dof_table(std::vector<MeshLib::MeshSubset>(
+                         Dim, _mesh_subset_all_nodes),
+                     NumLib::ComponentOrder::BY_LOCATION)
+    {
+    }
+
+protected:
+    //! Creates process data and a local assembler of the only element like
+    //! the SmallDeformationProcess does, using the Ehlers material model.
+    ElementState createElementState() const
+    {
+        std::map<int, std::unique_ptr<
+                          MaterialLib::Solids::MechanicsBase<Dim>>>
+            solid_materials;
+        solid_materials[0] =
+            std::make_unique<MaterialLib::Solids::Ehlers::SolidEhlers<Dim>>(
+                NumLib::NewtonRaphsonSolverParameters{100, 1e-14},
+                MaterialLib::Solids::Ehlers::MaterialPropertiesParameters{
+                    _G, _K, _alpha, _beta, _gamma, _delta, _epsilon, _m,
+                    _alpha, _beta_p, _gamma, _delta, _epsilon, _m, _kappa,
+                    _hardening},
+                nullptr, MaterialLib::Solids::Ehlers::TangentType::Plastic);
+
+        auto process_data = std::make_unique<ProcessData>(
+            nullptr, std::move(solid_materials), _rho,
+            Eigen::Matrix<double, Dim, 1>::Zero(), 0.0);
+        process_data->dt = 1;
+
+        auto const kelvin_vector_size =
+            MathLib::KelvinVector::KelvinVectorDimensions<Dim>::value;
+        auto& ip_data_store = process_data->integration_point_data;
+        ip_data_store = ProcessLib::IntegrationPointDataStore(
+            _mesh->getElements(), _integration_order);
+        auto& fields = process_data->integration_point_data_fields;
+        fields.sigma = ip_data_store.addField("sigma", kelvin_vector_size);
+        fields.sigma_prev =
+            ip_data_store.addField("sigma_prev", kelvin_vector_size);
+        fields.eps = ip_data_store.addField("epsilon", kelvin_vector_size);
+        fields.eps_prev =
+            ip_data_store.addField("epsilon_prev", kelvin_vector_size);
+        fields.free_energy_density =
+            ip_data_store.addField("free_energy_density", 1);
+
+        std::vector<std::unique_ptr<LocalAssembler>> local_assemblers;
+        local_assemblers.push_back(std::make_unique<LocalAssembler>(
+            *_mesh->getElement(0), Dim * 8, false, _integration_order,
+            *process_data));
+        return {std::move(process_data), std::move(local_assemblers)};
+    }
+
+    void preTimestep(ElementState& state, double const t) const
+    {
+        GlobalVector const x(_dof_table.dofSizeWithoutGhosts());
+        ProcessLib::SmallDeformation::pushBackIntegrationPointState(
+            *state.process_data, state.local_assemblers, {}, _dof_table, x, t,
+            state.process_data->dt);
+    }
+
+    //! Displacements of a uniaxial compression with lateral expansion, which
+    //! are ordered by component like the local assemblers expect them.
+    std::vector<double> displacements(double const compression) const
+    {
+        std::vector<double> local_x;
+        for (int component = 0; component < Dim; ++component)
+        {
+            double const strain =
+                component == 0 ? -compression : compression / 2;
+            auto const& element = *_mesh->getElement(0);
+            for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+            {
+                local_x.push_back(strain * (*element.getNode(i))[component]);
+            }
+        }
+        return local_x;
+    }
+
+    //! Returns the local residual and the local Jacobian.
+    static std::pair<std::vector<double>, std::vector<double>> assemble(
+        ElementState& state, double const t,
+        std::vector<double> const& local_x)
+    {
+        std::vector<double> local_M_data;
+        std::vector<double> local_K_data;
+        std::vector<double> local_b_data;
+        std::vector<double> local_Jac_data;
+        std::vector<double> const local_xdot(local_x.size(), 0.0);
+        state.localAssembler().assembleWithJacobian(
+            t, local_x, local_xdot, 0.0, 1.0, local_M_data, local_K_data,
+            local_b_data, local_Jac_data);
+        return {local_b_data, local_Jac_data};
+    }
+
+    static double relativeDifference(std::vector<double> const& a,
+                                     std::vector<double> const& b)
+    {
+        return (MathLib::toVector(a) - MathLib::toVector(b)).norm() /
+               MathLib::toVector(b).norm();
+    }
+
+    std::unique_ptr<MeshLib::Mesh> const _mesh;
+    MeshLib::MeshSubset const _mesh_subset_all_nodes;
+    NumLib::LocalToGlobalIndexMap const _dof_table;
+    unsigned const _integration_order = 2;
+
+    // Parameters of the Ehlers benchmark cube_1e0.
+    ParameterLib::ConstantParameter<double> const _G{"G", 150.};
+    ParameterLib::ConstantParameter<double> const _K{"K", 200.};
+    ParameterLib::ConstantParameter<double> const _kappa{"kappa", 0.1};
+    ParameterLib::ConstantParameter<double> const _beta{"beta", 0.095};
+    ParameterLib::ConstantParameter<double> const _beta_p{"betap", 0.0608};
+    ParameterLib::ConstantParameter<double> const _gamma{"gamma", 1.};
+    ParameterLib::ConstantParameter<double> const _hardening{"hard", 0.};
+    ParameterLib::ConstantParameter<double> const _alpha{"alpha", 0.01};
+    ParameterLib::ConstantParameter<double> const _delta{"delta", 0.0078};
+    ParameterLib::ConstantParameter<double> const _epsilon{"epsilon", 0.1};
+    ParameterLib::ConstantParameter<double> const _m{"m", 0.54};
+    ParameterLib::ConstantParameter<double> const _rho{"rho", 1.};
+};
+}  // namespace
+
+// A rejected and repeated time step yields the same stresses, residual and
+// Jacobian as the time step solved directly after the accepted one.
+#ifndef USE_PETSC
+TEST_F(SmallDeformationRollback, RepeatedTimestepAfterRejection)
+#else
+TEST_F(SmallDeformationRollback, DISABLED_RepeatedTimestepAfterRejection)
+#endif
+{
+    auto const x1 = displacements(2e-4);
+    auto const x_rejected = displacements(6e-4);
+    auto const x2 = displacements(3e-4);
+
+    auto reference = createElementState();
+    auto state = createElementState();
+
+    // Accepted first time step.
+    preTimestep(reference, 0);
+    assemble(reference, 1, x1);
+    preTimestep(state, 0);
+    assemble(state, 1, x1);
+
+    // Second time step without rejection.
+    preTimestep(reference, 1);
+    auto const reference_result = assemble(reference, 2, x2);
+
+    // Rejected and repeated second time step.
+    preTimestep(state, 1);
+    auto const rejected_result = assemble(state, 2, x_rejected);
+    ASSERT_GT(
+        relativeDifference(rejected_result.first, reference_result.first),
+        1e-3);
+
+    ProcessLib::SmallDeformation::popIntegrationPointState(
+        *state.process_data, state.local_assemblers);
+    preTimestep(state, 1);
+    auto const result = assemble(state, 2, x2);
+
+    EXPECT_LE(relativeDifference(result.first, reference_result.first),
+              1e-12);
+    EXPECT_LE(relativeDifference(result.second, reference_result.second),
+              1e-12);
+
+    auto const& ip_data = state.process_data->integration_point_data;
+    auto const& reference_ip_data =
+        reference.process_data->integration_point_data;
+    auto const& fields = state.process_data->integration_point_data_fields;
+    for (int const field :
+         {fields.sigma, fields.sigma_prev, fields.eps, fields.eps_prev})
+    {
+        EXPECT_LE(relativeDifference(ip_data.values(field),
+                                     reference_ip_data.values(field)),
+                  1e-12);
+    }
+
+    // The plastic strains are compared through the material's internal
+    // variables.
+    auto const internal_variables =
+        state.process_data->solid_materials.at(0)->getInternalVariables();
+    ASSERT_FALSE(internal_variables.empty());
+    unsigned const n_integration_points =
+        reference_ip_data.getNumberOfIntegrationPoints(0);
+    for (auto const& internal_variable : internal_variables)
+    {
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            std::vector<double> cache;
+            std::vector<double> reference_cache;
+            EXPECT_EQ(
+                internal_variable.getter(
+                    reference.localAssembler().getMaterialStateVariablesAt(ip),
+                    reference_cache),
+                internal_variable.getter(
+                    state.localAssembler().getMaterialStateVariablesAt(ip),
+                    cache))
+                << internal_variable.name << " at integration point " << ip;
+        }
+    }
+}
+
+// A time step after restoring a checkpoint yields the same stresses, residual,
+// Jacobian and material state as the time step solved without interruption.
+#ifndef USE_PETSC
+TEST_F(SmallDeformationRollback, TimestepAfterCheckpointRestart)
+#else
+TEST_F(SmallDeformationRollback, DISABLED_TimestepAfterCheckpointRestart)
+#endif
+{
+    auto const x1 = displacements(6e-4);
+    auto const x2 = displacements(8e-4);
+
+    auto reference = createElementState();
+    preTimestep(reference, 0);
+    assemble(reference, 1, x1);
+
+    std::stringstream checkpoint;
+    ProcessLib::SmallDeformation::writeIntegrationPointState(
+        *reference.process_data, reference.local_assemblers, checkpoint);
+
+    // The plastic strain of the first time step must be restored to make the
+    // test meaningful.
+    auto const& reference_state = static_cast<
+        MaterialLib::Solids::Ehlers::StateVariables<Dim> const&>(
+        reference.localAssembler().getMaterialStateVariablesAt(0));
+    ASSERT_GT(reference_state.eps_p.eff, 0);
+
+    auto state = createElementState();
+    ProcessLib::SmallDeformation::readIntegrationPointState(
+        *state.process_data, state.local_assemblers, checkpoint);
+    ASSERT_TRUE(checkpoint.good());
+
+    preTimestep(reference, 1);
+    auto const reference_result = assemble(reference, 2, x2);
+    preTimestep(state, 1);
+    auto const result = assemble(state, 2, x2);
+
+    EXPECT_EQ(reference_result.first, result.first);
+    EXPECT_EQ(reference_result.second, result.second);
+
+    auto const& ip_data = state.process_data->integration_point_data;
+    auto const& reference_ip_data =
+        reference.process_data->integration_point_data;
+    for (int field = 0; field < ip_data.getNumberOfFields(); ++field)
+    {
+        EXPECT_EQ(reference_ip_data.values(field), ip_data.values(field))
+            << ip_data.getFieldName(field);
+    }
+
+    std::stringstream reference_material_state;
+    reference.localAssembler().writeMaterialState(reference_material_state);
+    std::stringstream material_state;
+    state.localAssembler().writeMaterialState(material_state);
+    EXPECT_EQ(reference_material_state.str(), material_state.str());
+}
@@ -23,6 +23,7 @@ include_directories(BEFORE ${METIS_PATH}/libmetis)
 file(GLOB metis_sources ${METIS_PATH}/libmetis/*.c)
 # Build libmetis.
 add_library(metis ${GKlib_sources} ${metis_sources})
+target_include_directories(metis PUBLIC ${METIS_PATH}/include)
 if(OPENMP_FOUND)
     target_link_libraries(metis OpenMP::OpenMP_C)
 endif()